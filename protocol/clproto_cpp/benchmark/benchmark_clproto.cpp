@@ -0,0 +1,59 @@
+#include <benchmark/benchmark.h>
+
+#include <clproto.hpp>
+#include <state_representation/space/cartesian/CartesianState.hpp>
+#include <state_representation/space/joint/JointState.hpp>
+
+using namespace state_representation;
+
+/*
+ * Decoding alternating Cartesian and joint state messages of unknown type, by checking the type of each message
+ * and decoding it with the free functions, which parse the string twice, against parsing it once into a Message.
+ */
+static std::vector<std::string> alternating_messages() {
+  return {clproto::encode(CartesianState::Random("tool", "base")), clproto::encode(JointState::Random("robot", 7))};
+}
+
+static void BM_CheckTypeAndDecode(benchmark::State& state) {
+  auto messages = alternating_messages();
+  auto cartesian_state = CartesianState::Identity("tool", "base");
+  auto joint_state = JointState::Zero("robot", 7);
+  std::size_t index = 0;
+  for (auto _: state) {
+    const auto& msg = messages[index++ % messages.size()];
+    if (clproto::check_message_type(msg) == clproto::CARTESIAN_STATE_MESSAGE) {
+      benchmark::DoNotOptimize(clproto::decode(msg, cartesian_state));
+    } else {
+      benchmark::DoNotOptimize(clproto::decode(msg, joint_state));
+    }
+  }
+}
+BENCHMARK(BM_CheckTypeAndDecode);
+
+static void BM_ParseOnceAndDecode(benchmark::State& state) {
+  auto messages = alternating_messages();
+  auto cartesian_state = CartesianState::Identity("tool", "base");
+  auto joint_state = JointState::Zero("robot", 7);
+  clproto::Message message;
+  std::size_t index = 0;
+  for (auto _: state) {
+    message.parse(messages[index++ % messages.size()]);
+    if (message.get_type() == clproto::CARTESIAN_STATE_MESSAGE) {
+      benchmark::DoNotOptimize(message.decode(cartesian_state));
+    } else {
+      benchmark::DoNotOptimize(message.decode(joint_state));
+    }
+  }
+}
+BENCHMARK(BM_ParseOnceAndDecode);
+
+static void BM_DecodeSharedState(benchmark::State& state) {
+  auto messages = alternating_messages();
+  std::size_t index = 0;
+  for (auto _: state) {
+    benchmark::DoNotOptimize(clproto::decode<std::shared_ptr<State>>(messages[index++ % messages.size()]));
+  }
+}
+BENCHMARK(BM_DecodeSharedState);
+
+BENCHMARK_MAIN();
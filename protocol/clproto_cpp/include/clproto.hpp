@@ -2,6 +2,7 @@
 
 #include <cstdint>
 #include <chrono>
+#include <memory>
 #include <stdexcept>
 #include <string>
 #include <vector>
@@ -9,6 +10,10 @@
 #define CLPROTO_PACKING_MAX_FIELD_LENGTH (4096)
 #define CLPROTO_PACKING_MAX_FIELDS (64)
 
+namespace state_representation::proto {
+class StateMessage;
+}
+
 /**
  * @namespace clproto
  * @brief Bindings to encode and decode state objects into serialised binary message
@@ -71,7 +76,8 @@ enum MessageType {
   ELLIPSOID_MESSAGE = 15,
   PARAMETER_MESSAGE = 16,
   DIGITAL_IO_STATE_MESSAGE = 17,
-  ANALOG_IO_STATE_MESSAGE = 18
+  ANALOG_IO_STATE_MESSAGE = 18,
+  BATCH_MESSAGE = 19
 };
 
 /**
@@ -124,6 +130,8 @@ ParameterMessageType check_parameter_message_type(const std::string& msg);
 /**
  * @brief Encode a control libraries object into
  * a serialized binary string representation (wire format).
+ * @details A std::vector of control libraries objects is encoded
+ * as a single batch message containing one message per object.
  * @tparam T The provided control libraries object type
  * @param obj The control libraries object to encode
  * @return The serialized binary string encoding
@@ -147,7 +155,19 @@ T decode(const std::string& msg);
  * @brief Exception safe decoding of a serialized binary string
  * wire format into a control libraries object instance.
  * @details It modifies the object by reference if the decoding is
- * successful, and leaves it unmodified otherwise.
+ * successful, and leaves it unmodified otherwise. Spatial and joint
+ * states are updated in place: if the object already has the number
+ * of joints of the message, the numeric data is written directly into
+ * its existing buffers and the name, reference frame and joint name
+ * strings are only rewritten when they differ from the message.
+ * A std::vector of objects encoded as a batch message is only
+ * modified if all the elements of the batch can be decoded, in which
+ * case it is resized to the number of elements and each existing
+ * element is updated in place. For a std::vector of
+ * std::shared_ptr<State>, the state pointed to by an existing element
+ * is reused and updated in place if it has the type of its message,
+ * and is replaced by a new state with the type of the message
+ * otherwise.
  * @tparam T The desired control libraries object type
  * @param msg The serialized binary string to decode
  * @param obj A reference to a control libraries object
@@ -156,6 +176,82 @@ T decode(const std::string& msg);
 template<typename T>
 bool decode(const std::string& msg, T& obj);
 
+/**
+ * @class Message
+ * @brief A serialized binary string parsed once and decoded on demand.
+ * @details The free ::check_message_type() and ::decode() functions each
+ * parse the binary string they are given, so inspecting the type of a
+ * message and then decoding it parses the string twice. A Message parses
+ * the string once and can then be queried for its type and decoded any
+ * number of times into the matching control libraries object. The parsed
+ * message storage is reused by subsequent calls to Message::parse().
+ */
+class Message {
+public:
+  /**
+   * @brief Empty constructor for a message of unknown type.
+   */
+  Message();
+
+  /**
+   * @brief Constructor that parses a serialized binary string.
+   * @param msg The serialized binary string to parse
+   */
+  explicit Message(const std::string& msg);
+
+  Message(const Message&) = delete;
+  Message& operator=(const Message&) = delete;
+  Message(Message&& message) noexcept;
+  Message& operator=(Message&& message) noexcept;
+  ~Message();
+
+  /**
+   * @brief Parse a serialized binary string, replacing the current content.
+   * @param msg The serialized binary string to parse
+   * @return True if the string could be parsed, false otherwise
+   */
+  bool parse(const std::string& msg);
+
+  /**
+   * @brief Get the control libraries message type of the parsed message.
+   * @return The MessageType of the contained type or UNKNOWN
+   */
+  [[nodiscard]] MessageType get_type() const;
+
+  /**
+   * @brief Get the parameter value type of the parsed message.
+   * @return The ParameterMessageType of the contained type or UNKNOWN
+   */
+  [[nodiscard]] ParameterMessageType get_parameter_type() const;
+
+  /**
+   * @brief Decode the parsed message into a control libraries object instance.
+   * @details Throws an exception if the message cannot be decoded
+   * into the desired type. Decoding into a std::shared_ptr<State>
+   * creates the state type contained by the message.
+   * @tparam T The desired control libraries object type
+   * @return A new instance of the control libraries object
+   */
+  template<typename T>
+  T decode() const;
+
+  /**
+   * @brief Exception safe decoding of the parsed message into a
+   * control libraries object instance.
+   * @details Same behavior as the free ::decode(const std::string&, T&) function,
+   * without parsing the serialized binary string again.
+   * @tparam T The desired control libraries object type
+   * @param obj A reference to a control libraries object
+   * @return A success status boolean
+   */
+  template<typename T>
+  bool decode(T& obj) const;
+
+private:
+  bool valid_; ///< True if the last parsed string was a valid message
+  std::unique_ptr<state_representation::proto::StateMessage> message_; ///< The parsed message
+};
+
 /**
  * @brief Pack an ordered vector of encoded field messages into a single data array.
  * @details To send multiple messages in one packet, there must
@@ -52,7 +52,7 @@ google::protobuf::RepeatedField<FieldT> encoder(const std::vector<FieldT>& data)
  * @param matrix An Eigen matrix of data
  * @return The encoded RepeatedField protocol message object
  */
-google::protobuf::RepeatedField<double> matrix_encoder(const Eigen::MatrixXd& matrix);
+google::protobuf::RepeatedField<double> matrix_encoder(const Eigen::Ref<const Eigen::MatrixXd>& matrix);
 
 /*
  * Declarations for encoding helpers
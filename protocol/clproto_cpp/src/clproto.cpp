@@ -67,6 +67,45 @@ ParameterMessageType check_parameter_message_type(const std::string& msg) {
   return ParameterMessageType::UNKNOWN_PARAMETER;
 }
 
+// --- Message dispatch utilities --- //
+
+/*
+ * Each supported type specializes encode_message and decode_message to fill or read an already
+ * constructed StateMessage, so that the string based methods, the Message class and the batch
+ * methods share the same implementation and a serialized binary string is only parsed once.
+ */
+template<typename T>
+static void encode_message(const T& obj, proto::StateMessage& message);
+
+template<typename T>
+static bool decode_message(const proto::StateMessage& message, T& obj);
+
+template<typename T>
+static std::string serialize_message(const T& obj) {
+  proto::StateMessage message;
+  encode_message(obj, message);
+  return message.SerializeAsString();
+}
+
+template<typename T>
+static bool parse_and_decode(const std::string& msg, T& obj) {
+  proto::StateMessage message;
+  return message.ParseFromString(msg) && decode_message(message, obj);
+}
+
+template<typename T>
+struct empty_object {
+  static T make() {
+    return T();
+  }
+};
+template<typename T>
+struct empty_object<Parameter<T>> {
+  static Parameter<T> make() {
+    return Parameter<T>("");
+  }
+};
+
 // --- Serialization methods --- //
 
 void pack_fields(const std::vector<std::string>& fields, char* data) {
@@ -154,20 +193,69 @@ std::string from_json(const std::string& json) {
   return msg;
 }
 
+// --- In-place decoding utilities --- //
+
+/*
+ * The exception safe decoding methods update existing spatial and joint state objects in place:
+ * the numeric data is written directly into the already sized buffers, and the name, reference frame
+ * and joint name strings are only rewritten if they differ from the message. An object is only
+ * reconstructed if its number of joints does not match the message.
+ */
+static Eigen::Map<const Eigen::VectorXd> map_field(const google::protobuf::RepeatedField<double>& field) {
+  return {field.data(), static_cast<Eigen::Index>(field.size())};
+}
+
+static void update_name(State& obj, const std::string& name) {
+  if (obj.get_name() != name) {
+    obj.set_name(name);
+  }
+}
+
+static void update_spatial_state(SpatialState& obj, const proto::SpatialState& message) {
+  update_name(obj, message.state().name());
+  if (obj.get_reference_frame() != message.reference_frame()) {
+    obj.set_reference_frame(message.reference_frame());
+  }
+}
+
+template<typename JointT>
+static void update_joint_state(
+    JointT& obj, const proto::State& state, const google::protobuf::RepeatedPtrField<std::string>& joint_names
+) {
+  if (obj.get_size() != static_cast<unsigned int>(joint_names.size())) {
+    obj = JointT(state.name(), decoder(joint_names));
+    return;
+  }
+  if (!std::equal(joint_names.begin(), joint_names.end(), obj.get_names().begin())) {
+    obj.set_names(decoder(joint_names));
+  }
+  update_name(obj, state.name());
+}
+
+static bool has_joint_size(const google::protobuf::RepeatedField<double>& field, int nb_joints) {
+  return field.size() == nb_joints;
+}
+
 /* ----------------------
  *         State
  * ---------------------- */
 template<>
 std::string encode<State>(const State& obj);
 template<>
+void encode_message(const State& obj, proto::StateMessage& message);
+template<>
 State decode(const std::string& msg);
 template<>
 bool decode(const std::string& msg, State& obj);
 template<>
+bool decode_message(const proto::StateMessage& message, State& obj);
+template<>
 std::string encode<State>(const State& obj) {
-  proto::StateMessage message;
+  return serialize_message(obj);
+}
+template<>
+void encode_message(const State& obj, proto::StateMessage& message) {
   *message.mutable_state() = encoder(obj);
-  return message.SerializeAsString();
 }
 template<>
 State decode(const std::string& msg) {
@@ -179,14 +267,16 @@ State decode(const std::string& msg) {
 }
 template<>
 bool decode(const std::string& msg, State& obj) {
+  return parse_and_decode(msg, obj);
+}
+template<>
+bool decode_message(const proto::StateMessage& message, State& obj) {
   try {
-    proto::StateMessage message;
-    if (!(message.ParseFromString(msg)
-        && message.message_type_case() == proto::StateMessage::MessageTypeCase::kState)) {
+    if (message.message_type_case() != proto::StateMessage::MessageTypeCase::kState) {
       return false;
     }
 
-    auto state = message.state();
+    const auto& state = message.state();
     obj = State(state.name());
 
     return true;
@@ -201,14 +291,20 @@ bool decode(const std::string& msg, State& obj) {
 template<>
 std::string encode<AnalogIOState>(const AnalogIOState& obj);
 template<>
+void encode_message(const AnalogIOState& obj, proto::StateMessage& message);
+template<>
 AnalogIOState decode(const std::string& msg);
 template<>
 bool decode(const std::string& msg, AnalogIOState& obj);
 template<>
+bool decode_message(const proto::StateMessage& message, AnalogIOState& obj);
+template<>
 std::string encode<AnalogIOState>(const AnalogIOState& obj) {
-  proto::StateMessage message;
+  return serialize_message(obj);
+}
+template<>
+void encode_message(const AnalogIOState& obj, proto::StateMessage& message) {
   *message.mutable_analog_io_state() = encoder(obj);
-  return message.SerializeAsString();
 }
 template<>
 AnalogIOState decode(const std::string& msg) {
@@ -220,14 +316,16 @@ AnalogIOState decode(const std::string& msg) {
 }
 template<>
 bool decode(const std::string& msg, AnalogIOState& obj) {
+  return parse_and_decode(msg, obj);
+}
+template<>
+bool decode_message(const proto::StateMessage& message, AnalogIOState& obj) {
   try {
-    proto::StateMessage message;
-    if (!(message.ParseFromString(msg)
-        && message.message_type_case() == proto::StateMessage::MessageTypeCase::kAnalogIoState)) {
+    if (message.message_type_case() != proto::StateMessage::MessageTypeCase::kAnalogIoState) {
       return false;
     }
 
-    auto state = message.analog_io_state();
+    const auto& state = message.analog_io_state();
     obj = AnalogIOState(state.state().name(), decoder(state.io_names()));
     if (!state.state().empty()) {
       obj.set_data(decoder(state.values()));
@@ -244,14 +342,20 @@ bool decode(const std::string& msg, AnalogIOState& obj) {
 template<>
 std::string encode<DigitalIOState>(const DigitalIOState& obj);
 template<>
+void encode_message(const DigitalIOState& obj, proto::StateMessage& message);
+template<>
 DigitalIOState decode(const std::string& msg);
 template<>
 bool decode(const std::string& msg, DigitalIOState& obj);
 template<>
+bool decode_message(const proto::StateMessage& message, DigitalIOState& obj);
+template<>
 std::string encode<DigitalIOState>(const DigitalIOState& obj) {
-  proto::StateMessage message;
+  return serialize_message(obj);
+}
+template<>
+void encode_message(const DigitalIOState& obj, proto::StateMessage& message) {
   *message.mutable_digital_io_state() = encoder(obj);
-  return message.SerializeAsString();
 }
 template<>
 DigitalIOState decode(const std::string& msg) {
@@ -263,14 +367,16 @@ DigitalIOState decode(const std::string& msg) {
 }
 template<>
 bool decode(const std::string& msg, DigitalIOState& obj) {
+  return parse_and_decode(msg, obj);
+}
+template<>
+bool decode_message(const proto::StateMessage& message, DigitalIOState& obj) {
   try {
-    proto::StateMessage message;
-    if (!(message.ParseFromString(msg)
-        && message.message_type_case() == proto::StateMessage::MessageTypeCase::kDigitalIoState)) {
+    if (message.message_type_case() != proto::StateMessage::MessageTypeCase::kDigitalIoState) {
       return false;
     }
 
-    auto state = message.digital_io_state();
+    const auto& state = message.digital_io_state();
     obj = DigitalIOState(state.state().name(), decoder(state.io_names()));
     if (!state.state().empty()) {
       obj.set_data(decoder(state.values()));
@@ -287,14 +393,20 @@ bool decode(const std::string& msg, DigitalIOState& obj) {
 template<>
 std::string encode<SpatialState>(const SpatialState& obj);
 template<>
+void encode_message(const SpatialState& obj, proto::StateMessage& message);
+template<>
 SpatialState decode(const std::string& msg);
 template<>
 bool decode(const std::string& msg, SpatialState& obj);
 template<>
+bool decode_message(const proto::StateMessage& message, SpatialState& obj);
+template<>
 std::string encode<SpatialState>(const SpatialState& obj) {
-  proto::StateMessage message;
+  return serialize_message(obj);
+}
+template<>
+void encode_message(const SpatialState& obj, proto::StateMessage& message) {
   *message.mutable_spatial_state() = encoder(obj);
-  return message.SerializeAsString();
 }
 template<>
 SpatialState decode(const std::string& msg) {
@@ -306,14 +418,16 @@ SpatialState decode(const std::string& msg) {
 }
 template<>
 bool decode(const std::string& msg, SpatialState& obj) {
+  return parse_and_decode(msg, obj);
+}
+template<>
+bool decode_message(const proto::StateMessage& message, SpatialState& obj) {
   try {
-    proto::StateMessage message;
-    if (!(message.ParseFromString(msg)
-        && message.message_type_case() == proto::StateMessage::MessageTypeCase::kSpatialState)) {
+    if (message.message_type_case() != proto::StateMessage::MessageTypeCase::kSpatialState) {
       return false;
     }
 
-    auto spatial_state = message.spatial_state();
+    const auto& spatial_state = message.spatial_state();
     obj = SpatialState(spatial_state.state().name(), spatial_state.reference_frame());
 
     return true;
@@ -328,14 +442,20 @@ bool decode(const std::string& msg, SpatialState& obj) {
 template<>
 std::string encode<CartesianState>(const CartesianState& obj);
 template<>
+void encode_message(const CartesianState& obj, proto::StateMessage& message);
+template<>
 CartesianState decode(const std::string& msg);
 template<>
 bool decode(const std::string& msg, CartesianState& obj);
 template<>
+bool decode_message(const proto::StateMessage& message, CartesianState& obj);
+template<>
 std::string encode<CartesianState>(const CartesianState& obj) {
-  proto::StateMessage message;
+  return serialize_message(obj);
+}
+template<>
+void encode_message(const CartesianState& obj, proto::StateMessage& message) {
   *message.mutable_cartesian_state() = encoder(obj);
-  return message.SerializeAsString();
 }
 template<>
 CartesianState decode(const std::string& msg) {
@@ -347,25 +467,26 @@ CartesianState decode(const std::string& msg) {
 }
 template<>
 bool decode(const std::string& msg, CartesianState& obj) {
+  return parse_and_decode(msg, obj);
+}
+template<>
+bool decode_message(const proto::StateMessage& message, CartesianState& obj) {
   try {
-    proto::StateMessage message;
-    if (!(message.ParseFromString(msg)
-        && message.message_type_case() == proto::StateMessage::MessageTypeCase::kCartesianState)) {
+    if (message.message_type_case() != proto::StateMessage::MessageTypeCase::kCartesianState) {
       return false;
     }
 
-    auto state = message.cartesian_state();
-    obj = CartesianState(state.spatial_state().state().name(), state.spatial_state().reference_frame());
-    if (!state.spatial_state().state().empty()) {
-      obj.set_position(decoder(state.position()));
-      obj.set_orientation(decoder(state.orientation()));
-      obj.set_linear_velocity(decoder(state.linear_velocity()));
-      obj.set_angular_velocity(decoder(state.angular_velocity()));
-      obj.set_linear_acceleration(decoder(state.linear_acceleration()));
-      obj.set_angular_acceleration(decoder(state.angular_acceleration()));
-      obj.set_force(decoder(state.force()));
-      obj.set_torque(decoder(state.torque()));
+    const auto& state = message.cartesian_state();
+    update_spatial_state(obj, state.spatial_state());
+    if (state.spatial_state().state().empty()) {
+      obj.reset();
+      return true;
     }
+    Eigen::VectorXd data(25);
+    data << decoder(state.position()), state.orientation().w(), decoder(state.orientation().vec()),
+        decoder(state.linear_velocity()), decoder(state.angular_velocity()), decoder(state.linear_acceleration()),
+        decoder(state.angular_acceleration()), decoder(state.force()), decoder(state.torque());
+    obj.set_data(data);
     return true;
   } catch (...) {
     return false;
@@ -378,19 +499,25 @@ bool decode(const std::string& msg, CartesianState& obj) {
 template<>
 std::string encode<CartesianPose>(const CartesianPose& obj);
 template<>
+void encode_message(const CartesianPose& obj, proto::StateMessage& message);
+template<>
 CartesianPose decode(const std::string& msg);
 template<>
 bool decode(const std::string& msg, CartesianPose& obj);
 template<>
+bool decode_message(const proto::StateMessage& message, CartesianPose& obj);
+template<>
 std::string encode<CartesianPose>(const CartesianPose& obj) {
-  proto::StateMessage message;
+  return serialize_message(obj);
+}
+template<>
+void encode_message(const CartesianPose& obj, proto::StateMessage& message) {
   auto cartesian_state = encoder(static_cast<CartesianState>(obj));
   *message.mutable_cartesian_pose()->mutable_spatial_state() = cartesian_state.spatial_state();
   if (!cartesian_state.spatial_state().state().empty()) {
     *message.mutable_cartesian_pose()->mutable_position() = cartesian_state.position();
     *message.mutable_cartesian_pose()->mutable_orientation() = cartesian_state.orientation();
   }
-  return message.SerializeAsString();
 }
 template<>
 CartesianPose decode(const std::string& msg) {
@@ -402,18 +529,23 @@ CartesianPose decode(const std::string& msg) {
 }
 template<>
 bool decode(const std::string& msg, CartesianPose& obj) {
+  return parse_and_decode(msg, obj);
+}
+template<>
+bool decode_message(const proto::StateMessage& message, CartesianPose& obj) {
   try {
-    proto::StateMessage message;
-    if (!(message.ParseFromString(msg)
-        && message.message_type_case() == proto::StateMessage::MessageTypeCase::kCartesianPose)) {
+    if (message.message_type_case() != proto::StateMessage::MessageTypeCase::kCartesianPose) {
       return false;
     }
-    auto pose = message.cartesian_pose();
-    obj = CartesianPose(pose.spatial_state().state().name(), pose.spatial_state().reference_frame());
-    if (!pose.spatial_state().state().empty()) {
-      obj.set_position(decoder(pose.position()));
-      obj.set_orientation(decoder(pose.orientation()));
+    const auto& pose = message.cartesian_pose();
+    update_spatial_state(obj, pose.spatial_state());
+    if (pose.spatial_state().state().empty()) {
+      obj.reset();
+      return true;
     }
+    Eigen::Matrix<double, 7, 1> data;
+    data << decoder(pose.position()), pose.orientation().w(), decoder(pose.orientation().vec());
+    obj.set_pose(data);
     return true;
   } catch (...) {
     return false;
@@ -426,19 +558,25 @@ bool decode(const std::string& msg, CartesianPose& obj) {
 template<>
 std::string encode<CartesianTwist>(const CartesianTwist& obj);
 template<>
+void encode_message(const CartesianTwist& obj, proto::StateMessage& message);
+template<>
 CartesianTwist decode(const std::string& msg);
 template<>
 bool decode(const std::string& msg, CartesianTwist& obj);
 template<>
+bool decode_message(const proto::StateMessage& message, CartesianTwist& obj);
+template<>
 std::string encode<CartesianTwist>(const CartesianTwist& obj) {
-  proto::StateMessage message;
+  return serialize_message(obj);
+}
+template<>
+void encode_message(const CartesianTwist& obj, proto::StateMessage& message) {
   auto cartesian_state = encoder(static_cast<CartesianState>(obj));
   *message.mutable_cartesian_twist()->mutable_spatial_state() = cartesian_state.spatial_state();
   if (!cartesian_state.spatial_state().state().empty()) {
     *message.mutable_cartesian_twist()->mutable_linear_velocity() = cartesian_state.linear_velocity();
     *message.mutable_cartesian_twist()->mutable_angular_velocity() = cartesian_state.angular_velocity();
   }
-  return message.SerializeAsString();
 }
 template<>
 CartesianTwist decode(const std::string& msg) {
@@ -450,18 +588,23 @@ CartesianTwist decode(const std::string& msg) {
 }
 template<>
 bool decode(const std::string& msg, CartesianTwist& obj) {
+  return parse_and_decode(msg, obj);
+}
+template<>
+bool decode_message(const proto::StateMessage& message, CartesianTwist& obj) {
   try {
-    proto::StateMessage message;
-    if (!(message.ParseFromString(msg)
-        && message.message_type_case() == proto::StateMessage::MessageTypeCase::kCartesianTwist)) {
+    if (message.message_type_case() != proto::StateMessage::MessageTypeCase::kCartesianTwist) {
       return false;
     }
-    auto twist = message.cartesian_twist();
-    obj = CartesianTwist(twist.spatial_state().state().name(), twist.spatial_state().reference_frame());
-    if (!twist.spatial_state().state().empty()) {
-      obj.set_linear_velocity(decoder(twist.linear_velocity()));
-      obj.set_angular_velocity(decoder(twist.angular_velocity()));
+    const auto& twist = message.cartesian_twist();
+    update_spatial_state(obj, twist.spatial_state());
+    if (twist.spatial_state().state().empty()) {
+      obj.reset();
+      return true;
     }
+    Eigen::Matrix<double, 6, 1> data;
+    data << decoder(twist.linear_velocity()), decoder(twist.angular_velocity());
+    obj.set_twist(data);
     return true;
   } catch (...) {
     return false;
@@ -474,19 +617,25 @@ bool decode(const std::string& msg, CartesianTwist& obj) {
 template<>
 std::string encode<CartesianAcceleration>(const CartesianAcceleration& obj);
 template<>
+void encode_message(const CartesianAcceleration& obj, proto::StateMessage& message);
+template<>
 CartesianAcceleration decode(const std::string& msg);
 template<>
 bool decode(const std::string& msg, CartesianAcceleration& obj);
 template<>
+bool decode_message(const proto::StateMessage& message, CartesianAcceleration& obj);
+template<>
 std::string encode<CartesianAcceleration>(const CartesianAcceleration& obj) {
-  proto::StateMessage message;
+  return serialize_message(obj);
+}
+template<>
+void encode_message(const CartesianAcceleration& obj, proto::StateMessage& message) {
   auto cartesian_state = encoder(static_cast<CartesianState>(obj));
   *message.mutable_cartesian_acceleration()->mutable_spatial_state() = cartesian_state.spatial_state();
   if (!cartesian_state.spatial_state().state().empty()) {
     *message.mutable_cartesian_acceleration()->mutable_linear_acceleration() = cartesian_state.linear_acceleration();
     *message.mutable_cartesian_acceleration()->mutable_angular_acceleration() = cartesian_state.angular_acceleration();
   }
-  return message.SerializeAsString();
 }
 template<>
 CartesianAcceleration decode(const std::string& msg) {
@@ -498,19 +647,23 @@ CartesianAcceleration decode(const std::string& msg) {
 }
 template<>
 bool decode(const std::string& msg, CartesianAcceleration& obj) {
+  return parse_and_decode(msg, obj);
+}
+template<>
+bool decode_message(const proto::StateMessage& message, CartesianAcceleration& obj) {
   try {
-    proto::StateMessage message;
-    if (!(message.ParseFromString(msg)
-        && message.message_type_case() == proto::StateMessage::MessageTypeCase::kCartesianAcceleration)) {
+    if (message.message_type_case() != proto::StateMessage::MessageTypeCase::kCartesianAcceleration) {
       return false;
     }
-    auto acceleration = message.cartesian_acceleration();
-    obj = CartesianAcceleration(
-        acceleration.spatial_state().state().name(), acceleration.spatial_state().reference_frame());
-    if (!acceleration.spatial_state().state().empty()) {
-      obj.set_linear_acceleration(decoder(acceleration.linear_acceleration()));
-      obj.set_angular_acceleration(decoder(acceleration.angular_acceleration()));
+    const auto& acceleration = message.cartesian_acceleration();
+    update_spatial_state(obj, acceleration.spatial_state());
+    if (acceleration.spatial_state().state().empty()) {
+      obj.reset();
+      return true;
     }
+    Eigen::Matrix<double, 6, 1> data;
+    data << decoder(acceleration.linear_acceleration()), decoder(acceleration.angular_acceleration());
+    obj.set_acceleration(data);
     return true;
   } catch (...) {
     return false;
@@ -523,19 +676,25 @@ bool decode(const std::string& msg, CartesianAcceleration& obj) {
 template<>
 std::string encode<CartesianWrench>(const CartesianWrench& obj);
 template<>
+void encode_message(const CartesianWrench& obj, proto::StateMessage& message);
+template<>
 CartesianWrench decode(const std::string& msg);
 template<>
 bool decode(const std::string& msg, CartesianWrench& obj);
 template<>
+bool decode_message(const proto::StateMessage& message, CartesianWrench& obj);
+template<>
 std::string encode<CartesianWrench>(const CartesianWrench& obj) {
-  proto::StateMessage message;
+  return serialize_message(obj);
+}
+template<>
+void encode_message(const CartesianWrench& obj, proto::StateMessage& message) {
   auto cartesian_state = encoder(static_cast<CartesianState>(obj));
   *message.mutable_cartesian_wrench()->mutable_spatial_state() = cartesian_state.spatial_state();
   if (!cartesian_state.spatial_state().state().empty()) {
     *message.mutable_cartesian_wrench()->mutable_force() = cartesian_state.force();
     *message.mutable_cartesian_wrench()->mutable_torque() = cartesian_state.torque();
   }
-  return message.SerializeAsString();
 }
 template<>
 CartesianWrench decode(const std::string& msg) {
@@ -547,18 +706,23 @@ CartesianWrench decode(const std::string& msg) {
 }
 template<>
 bool decode(const std::string& msg, CartesianWrench& obj) {
+  return parse_and_decode(msg, obj);
+}
+template<>
+bool decode_message(const proto::StateMessage& message, CartesianWrench& obj) {
   try {
-    proto::StateMessage message;
-    if (!(message.ParseFromString(msg)
-        && message.message_type_case() == proto::StateMessage::MessageTypeCase::kCartesianWrench)) {
+    if (message.message_type_case() != proto::StateMessage::MessageTypeCase::kCartesianWrench) {
       return false;
     }
-    auto wrench = message.cartesian_wrench();
-    obj = CartesianWrench(wrench.spatial_state().state().name(), wrench.spatial_state().reference_frame());
-    if (!wrench.spatial_state().state().empty()) {
-      obj.set_force(decoder(wrench.force()));
-      obj.set_torque(decoder(wrench.torque()));
+    const auto& wrench = message.cartesian_wrench();
+    update_spatial_state(obj, wrench.spatial_state());
+    if (wrench.spatial_state().state().empty()) {
+      obj.reset();
+      return true;
     }
+    Eigen::Matrix<double, 6, 1> data;
+    data << decoder(wrench.force()), decoder(wrench.torque());
+    obj.set_wrench(data);
     return true;
   } catch (...) {
     return false;
@@ -571,14 +735,20 @@ bool decode(const std::string& msg, CartesianWrench& obj) {
 template<>
 std::string encode<Jacobian>(const Jacobian& obj);
 template<>
+void encode_message(const Jacobian& obj, proto::StateMessage& message);
+template<>
 Jacobian decode(const std::string& msg);
 template<>
 bool decode(const std::string& msg, Jacobian& obj);
 template<>
+bool decode_message(const proto::StateMessage& message, Jacobian& obj);
+template<>
 std::string encode<Jacobian>(const Jacobian& obj) {
-  proto::StateMessage message;
+  return serialize_message(obj);
+}
+template<>
+void encode_message(const Jacobian& obj, proto::StateMessage& message) {
   *message.mutable_jacobian() = encoder(obj);
-  return message.SerializeAsString();
 }
 template<>
 Jacobian decode(const std::string& msg) {
@@ -590,14 +760,16 @@ Jacobian decode(const std::string& msg) {
 }
 template<>
 bool decode(const std::string& msg, Jacobian& obj) {
+  return parse_and_decode(msg, obj);
+}
+template<>
+bool decode_message(const proto::StateMessage& message, Jacobian& obj) {
   try {
-    proto::StateMessage message;
-    if (!(message.ParseFromString(msg)
-        && message.message_type_case() == proto::StateMessage::MessageTypeCase::kJacobian)) {
+    if (message.message_type_case() != proto::StateMessage::MessageTypeCase::kJacobian) {
       return false;
     }
 
-    auto jacobian = message.jacobian();
+    const auto& jacobian = message.jacobian();
     obj = Jacobian(
         jacobian.state().name(), decoder(jacobian.joint_names()), jacobian.frame(), jacobian.reference_frame());
     if (!jacobian.state().empty() && !jacobian.data().empty()) {
@@ -617,14 +789,20 @@ bool decode(const std::string& msg, Jacobian& obj) {
 template<>
 std::string encode<JointState>(const JointState& obj);
 template<>
+void encode_message(const JointState& obj, proto::StateMessage& message);
+template<>
 JointState decode(const std::string& msg);
 template<>
 bool decode(const std::string& msg, JointState& obj);
 template<>
+bool decode_message(const proto::StateMessage& message, JointState& obj);
+template<>
 std::string encode<JointState>(const JointState& obj) {
-  proto::StateMessage message;
+  return serialize_message(obj);
+}
+template<>
+void encode_message(const JointState& obj, proto::StateMessage& message) {
   *message.mutable_joint_state() = encoder(obj);
-  return message.SerializeAsString();
 }
 template<>
 JointState decode(const std::string& msg) {
@@ -636,21 +814,31 @@ JointState decode(const std::string& msg) {
 }
 template<>
 bool decode(const std::string& msg, JointState& obj) {
+  return parse_and_decode(msg, obj);
+}
+template<>
+bool decode_message(const proto::StateMessage& message, JointState& obj) {
   try {
-    proto::StateMessage message;
-    if (!(message.ParseFromString(msg)
-        && message.message_type_case() == proto::StateMessage::MessageTypeCase::kJointState)) {
+    if (message.message_type_case() != proto::StateMessage::MessageTypeCase::kJointState) {
       return false;
     }
 
-    auto state = message.joint_state();
-    obj = JointState(state.state().name(), decoder(state.joint_names()));
-    if (!state.state().empty()) {
-      obj.set_positions(decoder(state.positions()));
-      obj.set_velocities(decoder(state.velocities()));
-      obj.set_accelerations(decoder(state.accelerations()));
-      obj.set_torques(decoder(state.torques()));
-    };
+    const auto& state = message.joint_state();
+    auto nb_joints = state.joint_names_size();
+    if (!state.state().empty() && !(has_joint_size(state.positions(), nb_joints)
+        && has_joint_size(state.velocities(), nb_joints) && has_joint_size(state.accelerations(), nb_joints)
+        && has_joint_size(state.torques(), nb_joints))) {
+      return false;
+    }
+    update_joint_state(obj, state.state(), state.joint_names());
+    if (state.state().empty()) {
+      obj.reset();
+      return true;
+    }
+    Eigen::VectorXd data(4 * nb_joints);
+    data << map_field(state.positions()), map_field(state.velocities()), map_field(state.accelerations()),
+        map_field(state.torques());
+    obj.set_data(data);
     return true;
   } catch (...) {
     return false;
@@ -663,19 +851,25 @@ bool decode(const std::string& msg, JointState& obj) {
 template<>
 std::string encode<JointPositions>(const JointPositions& obj);
 template<>
+void encode_message(const JointPositions& obj, proto::StateMessage& message);
+template<>
 JointPositions decode(const std::string& msg);
 template<>
 bool decode(const std::string& msg, JointPositions& obj);
 template<>
+bool decode_message(const proto::StateMessage& message, JointPositions& obj);
+template<>
 std::string encode<JointPositions>(const JointPositions& obj) {
-  proto::StateMessage message;
+  return serialize_message(obj);
+}
+template<>
+void encode_message(const JointPositions& obj, proto::StateMessage& message) {
   auto joint_state = encoder(static_cast<JointState>(obj));
   *message.mutable_joint_positions()->mutable_state() = joint_state.state();
   *message.mutable_joint_positions()->mutable_joint_names() = joint_state.joint_names();
   if (!joint_state.state().empty()) {
     *message.mutable_joint_positions()->mutable_positions() = joint_state.positions();
   }
-  return message.SerializeAsString();
 }
 template<>
 JointPositions decode(const std::string& msg) {
@@ -687,18 +881,25 @@ JointPositions decode(const std::string& msg) {
 }
 template<>
 bool decode(const std::string& msg, JointPositions& obj) {
+  return parse_and_decode(msg, obj);
+}
+template<>
+bool decode_message(const proto::StateMessage& message, JointPositions& obj) {
   try {
-    proto::StateMessage message;
-    if (!(message.ParseFromString(msg)
-        && message.message_type_case() == proto::StateMessage::MessageTypeCase::kJointPositions)) {
+    if (message.message_type_case() != proto::StateMessage::MessageTypeCase::kJointPositions) {
       return false;
     }
 
-    auto positions = message.joint_positions();
-    obj = JointPositions(positions.state().name(), decoder(positions.joint_names()));
-    if (!positions.state().empty()) {
-      obj.set_positions(decoder(positions.positions()));
+    const auto& positions = message.joint_positions();
+    if (!positions.state().empty() && !has_joint_size(positions.positions(), positions.joint_names_size())) {
+      return false;
     }
+    update_joint_state(obj, positions.state(), positions.joint_names());
+    if (positions.state().empty()) {
+      obj.reset();
+      return true;
+    }
+    obj.set_positions(map_field(positions.positions()));
     return true;
   } catch (...) {
     return false;
@@ -711,19 +912,25 @@ bool decode(const std::string& msg, JointPositions& obj) {
 template<>
 std::string encode<JointVelocities>(const JointVelocities& obj);
 template<>
+void encode_message(const JointVelocities& obj, proto::StateMessage& message);
+template<>
 JointVelocities decode(const std::string& msg);
 template<>
 bool decode(const std::string& msg, JointVelocities& obj);
 template<>
+bool decode_message(const proto::StateMessage& message, JointVelocities& obj);
+template<>
 std::string encode<JointVelocities>(const JointVelocities& obj) {
-  proto::StateMessage message;
+  return serialize_message(obj);
+}
+template<>
+void encode_message(const JointVelocities& obj, proto::StateMessage& message) {
   auto joint_state = encoder(static_cast<JointState>(obj));
   *message.mutable_joint_velocities()->mutable_state() = joint_state.state();
   *message.mutable_joint_velocities()->mutable_joint_names() = joint_state.joint_names();
   if (!joint_state.state().empty()) {
     *message.mutable_joint_velocities()->mutable_velocities() = joint_state.velocities();
   }
-  return message.SerializeAsString();
 }
 template<>
 JointVelocities decode(const std::string& msg) {
@@ -735,18 +942,25 @@ JointVelocities decode(const std::string& msg) {
 }
 template<>
 bool decode(const std::string& msg, JointVelocities& obj) {
+  return parse_and_decode(msg, obj);
+}
+template<>
+bool decode_message(const proto::StateMessage& message, JointVelocities& obj) {
   try {
-    proto::StateMessage message;
-    if (!(message.ParseFromString(msg)
-        && message.message_type_case() == proto::StateMessage::MessageTypeCase::kJointVelocities)) {
+    if (message.message_type_case() != proto::StateMessage::MessageTypeCase::kJointVelocities) {
       return false;
     }
 
-    auto velocities = message.joint_velocities();
-    obj = JointVelocities(velocities.state().name(), decoder(velocities.joint_names()));
-    if (!velocities.state().empty()) {
-      obj.set_velocities(decoder(velocities.velocities()));
+    const auto& velocities = message.joint_velocities();
+    if (!velocities.state().empty() && !has_joint_size(velocities.velocities(), velocities.joint_names_size())) {
+      return false;
     }
+    update_joint_state(obj, velocities.state(), velocities.joint_names());
+    if (velocities.state().empty()) {
+      obj.reset();
+      return true;
+    }
+    obj.set_velocities(map_field(velocities.velocities()));
     return true;
   } catch (...) {
     return false;
@@ -759,19 +973,25 @@ bool decode(const std::string& msg, JointVelocities& obj) {
 template<>
 std::string encode<JointAccelerations>(const JointAccelerations& obj);
 template<>
+void encode_message(const JointAccelerations& obj, proto::StateMessage& message);
+template<>
 JointAccelerations decode(const std::string& msg);
 template<>
 bool decode(const std::string& msg, JointAccelerations& obj);
 template<>
+bool decode_message(const proto::StateMessage& message, JointAccelerations& obj);
+template<>
 std::string encode<JointAccelerations>(const JointAccelerations& obj) {
-  proto::StateMessage message;
+  return serialize_message(obj);
+}
+template<>
+void encode_message(const JointAccelerations& obj, proto::StateMessage& message) {
   auto joint_state = encoder(static_cast<JointState>(obj));
   *message.mutable_joint_accelerations()->mutable_state() = joint_state.state();
   *message.mutable_joint_accelerations()->mutable_joint_names() = joint_state.joint_names();
   if (!joint_state.state().empty()) {
     *message.mutable_joint_accelerations()->mutable_accelerations() = joint_state.accelerations();
   }
-  return message.SerializeAsString();
 }
 template<>
 JointAccelerations decode(const std::string& msg) {
@@ -783,18 +1003,25 @@ JointAccelerations decode(const std::string& msg) {
 }
 template<>
 bool decode(const std::string& msg, JointAccelerations& obj) {
+  return parse_and_decode(msg, obj);
+}
+template<>
+bool decode_message(const proto::StateMessage& message, JointAccelerations& obj) {
   try {
-    proto::StateMessage message;
-    if (!(message.ParseFromString(msg)
-        && message.message_type_case() == proto::StateMessage::MessageTypeCase::kJointAccelerations)) {
+    if (message.message_type_case() != proto::StateMessage::MessageTypeCase::kJointAccelerations) {
       return false;
     }
 
-    auto accelerations = message.joint_accelerations();
-    obj = JointAccelerations(accelerations.state().name(), decoder(accelerations.joint_names()));
-    if (!accelerations.state().empty()) {
-      obj.set_accelerations(decoder(accelerations.accelerations()));
+    const auto& accelerations = message.joint_accelerations();
+    if (!accelerations.state().empty() && !has_joint_size(accelerations.accelerations(), accelerations.joint_names_size())) {
+      return false;
     }
+    update_joint_state(obj, accelerations.state(), accelerations.joint_names());
+    if (accelerations.state().empty()) {
+      obj.reset();
+      return true;
+    }
+    obj.set_accelerations(map_field(accelerations.accelerations()));
     return true;
   } catch (...) {
     return false;
@@ -807,19 +1034,25 @@ bool decode(const std::string& msg, JointAccelerations& obj) {
 template<>
 std::string encode<JointTorques>(const JointTorques& obj);
 template<>
+void encode_message(const JointTorques& obj, proto::StateMessage& message);
+template<>
 JointTorques decode(const std::string& msg);
 template<>
 bool decode(const std::string& msg, JointTorques& obj);
 template<>
+bool decode_message(const proto::StateMessage& message, JointTorques& obj);
+template<>
 std::string encode<JointTorques>(const JointTorques& obj) {
-  proto::StateMessage message;
+  return serialize_message(obj);
+}
+template<>
+void encode_message(const JointTorques& obj, proto::StateMessage& message) {
   auto joint_state = encoder(static_cast<JointState>(obj));
   *message.mutable_joint_torques()->mutable_state() = joint_state.state();
   *message.mutable_joint_torques()->mutable_joint_names() = joint_state.joint_names();
   if (!joint_state.state().empty()) {
     *message.mutable_joint_torques()->mutable_torques() = joint_state.torques();
   }
-  return message.SerializeAsString();
 }
 template<>
 JointTorques decode(const std::string& msg) {
@@ -831,18 +1064,25 @@ JointTorques decode(const std::string& msg) {
 }
 template<>
 bool decode(const std::string& msg, JointTorques& obj) {
+  return parse_and_decode(msg, obj);
+}
+template<>
+bool decode_message(const proto::StateMessage& message, JointTorques& obj) {
   try {
-    proto::StateMessage message;
-    if (!(message.ParseFromString(msg)
-        && message.message_type_case() == proto::StateMessage::MessageTypeCase::kJointTorques)) {
+    if (message.message_type_case() != proto::StateMessage::MessageTypeCase::kJointTorques) {
       return false;
     }
 
-    auto torques = message.joint_torques();
-    obj = JointTorques(torques.state().name(), decoder(torques.joint_names()));
-    if (!torques.state().empty()) {
-      obj.set_torques(decoder(torques.torques()));
+    const auto& torques = message.joint_torques();
+    if (!torques.state().empty() && !has_joint_size(torques.torques(), torques.joint_names_size())) {
+      return false;
     }
+    update_joint_state(obj, torques.state(), torques.joint_names());
+    if (torques.state().empty()) {
+      obj.reset();
+      return true;
+    }
+    obj.set_torques(map_field(torques.torques()));
     return true;
   } catch (...) {
     return false;
@@ -853,17 +1093,15 @@ bool decode(const std::string& msg, JointTorques& obj) {
  *      Parameter<T>
  * ---------------------- */
 template<typename T>
-static std::string encode_parameter(const Parameter<T>& obj);
+static void encode_parameter(const Parameter<T>& obj, proto::StateMessage& message);
 template<typename T>
 static Parameter<T> decode_parameter(const std::string& msg);
 template<typename T>
-static bool decode_parameter(const std::string& msg, Parameter<T>& obj);
+static bool decode_parameter(const proto::StateMessage& message, Parameter<T>& obj);
 
 template<typename T>
-static std::string encode_parameter(const Parameter<T>& obj) {
-  proto::StateMessage message;
+static void encode_parameter(const Parameter<T>& obj, proto::StateMessage& message) {
   *message.mutable_parameter() = encoder<T>(obj);
-  return message.SerializeAsString();
 }
 template<typename T>
 static Parameter<T> decode_parameter(const std::string& msg) {
@@ -874,11 +1112,9 @@ static Parameter<T> decode_parameter(const std::string& msg) {
   return obj;
 }
 template<typename T>
-static bool decode_parameter(const std::string& msg, Parameter<T>& obj) {
+static bool decode_parameter(const proto::StateMessage& message, Parameter<T>& obj) {
   try {
-    proto::StateMessage message;
-    if (!(message.ParseFromString(msg)
-        && message.message_type_case() == proto::StateMessage::MessageTypeCase::kParameter)) {
+    if (message.message_type_case() != proto::StateMessage::MessageTypeCase::kParameter) {
       return false;
     }
     obj = decoder<T>(message.parameter());
@@ -894,12 +1130,20 @@ static bool decode_parameter(const std::string& msg, Parameter<T>& obj) {
 template<>
 std::string encode<Parameter<int>>(const Parameter<int>& obj);
 template<>
+void encode_message(const Parameter<int>& obj, proto::StateMessage& message);
+template<>
 Parameter<int> decode(const std::string& msg);
 template<>
 bool decode(const std::string& msg, Parameter<int>& obj);
 template<>
+bool decode_message(const proto::StateMessage& message, Parameter<int>& obj);
+template<>
 std::string encode<Parameter<int>>(const Parameter<int>& obj) {
-  return encode_parameter(obj);
+  return serialize_message(obj);
+}
+template<>
+void encode_message(const Parameter<int>& obj, proto::StateMessage& message) {
+  encode_parameter(obj, message);
 }
 template<>
 Parameter<int> decode(const std::string& msg) {
@@ -907,7 +1151,11 @@ Parameter<int> decode(const std::string& msg) {
 }
 template<>
 bool decode(const std::string& msg, Parameter<int>& obj) {
-  return decode_parameter(msg, obj);
+  return parse_and_decode(msg, obj);
+}
+template<>
+bool decode_message(const proto::StateMessage& message, Parameter<int>& obj) {
+  return decode_parameter(message, obj);
 }
 
 /* ----------------------
@@ -916,12 +1164,20 @@ bool decode(const std::string& msg, Parameter<int>& obj) {
 template<>
 std::string encode<Parameter<std::vector<int>>>(const Parameter<std::vector<int>>& obj);
 template<>
+void encode_message(const Parameter<std::vector<int>>& obj, proto::StateMessage& message);
+template<>
 Parameter<std::vector<int>> decode(const std::string& msg);
 template<>
 bool decode(const std::string& msg, Parameter<std::vector<int>>& obj);
 template<>
+bool decode_message(const proto::StateMessage& message, Parameter<std::vector<int>>& obj);
+template<>
 std::string encode<Parameter<std::vector<int>>>(const Parameter<std::vector<int>>& obj) {
-  return encode_parameter(obj);
+  return serialize_message(obj);
+}
+template<>
+void encode_message(const Parameter<std::vector<int>>& obj, proto::StateMessage& message) {
+  encode_parameter(obj, message);
 }
 template<>
 Parameter<std::vector<int>> decode(const std::string& msg) {
@@ -929,7 +1185,11 @@ Parameter<std::vector<int>> decode(const std::string& msg) {
 }
 template<>
 bool decode(const std::string& msg, Parameter<std::vector<int>>& obj) {
-  return decode_parameter(msg, obj);
+  return parse_and_decode(msg, obj);
+}
+template<>
+bool decode_message(const proto::StateMessage& message, Parameter<std::vector<int>>& obj) {
+  return decode_parameter(message, obj);
 }
 
 /* ----------------------
@@ -938,12 +1198,20 @@ bool decode(const std::string& msg, Parameter<std::vector<int>>& obj) {
 template<>
 std::string encode<Parameter<double>>(const Parameter<double>& obj);
 template<>
+void encode_message(const Parameter<double>& obj, proto::StateMessage& message);
+template<>
 Parameter<double> decode(const std::string& msg);
 template<>
 bool decode(const std::string& msg, Parameter<double>& obj);
 template<>
+bool decode_message(const proto::StateMessage& message, Parameter<double>& obj);
+template<>
 std::string encode<Parameter<double>>(const Parameter<double>& obj) {
-  return encode_parameter(obj);
+  return serialize_message(obj);
+}
+template<>
+void encode_message(const Parameter<double>& obj, proto::StateMessage& message) {
+  encode_parameter(obj, message);
 }
 template<>
 Parameter<double> decode(const std::string& msg) {
@@ -951,7 +1219,11 @@ Parameter<double> decode(const std::string& msg) {
 }
 template<>
 bool decode(const std::string& msg, Parameter<double>& obj) {
-  return decode_parameter(msg, obj);
+  return parse_and_decode(msg, obj);
+}
+template<>
+bool decode_message(const proto::StateMessage& message, Parameter<double>& obj) {
+  return decode_parameter(message, obj);
 }
 
 /* ----------------------
@@ -960,12 +1232,20 @@ bool decode(const std::string& msg, Parameter<double>& obj) {
 template<>
 std::string encode<Parameter<std::vector<double>>>(const Parameter<std::vector<double>>& obj);
 template<>
+void encode_message(const Parameter<std::vector<double>>& obj, proto::StateMessage& message);
+template<>
 Parameter<std::vector<double>> decode(const std::string& msg);
 template<>
 bool decode(const std::string& msg, Parameter<std::vector<double>>& obj);
 template<>
+bool decode_message(const proto::StateMessage& message, Parameter<std::vector<double>>& obj);
+template<>
 std::string encode<Parameter<std::vector<double>>>(const Parameter<std::vector<double>>& obj) {
-  return encode_parameter(obj);
+  return serialize_message(obj);
+}
+template<>
+void encode_message(const Parameter<std::vector<double>>& obj, proto::StateMessage& message) {
+  encode_parameter(obj, message);
 }
 template<>
 Parameter<std::vector<double>> decode(const std::string& msg) {
@@ -973,7 +1253,11 @@ Parameter<std::vector<double>> decode(const std::string& msg) {
 }
 template<>
 bool decode(const std::string& msg, Parameter<std::vector<double>>& obj) {
-  return decode_parameter(msg, obj);
+  return parse_and_decode(msg, obj);
+}
+template<>
+bool decode_message(const proto::StateMessage& message, Parameter<std::vector<double>>& obj) {
+  return decode_parameter(message, obj);
 }
 
 /* ----------------------
@@ -982,12 +1266,20 @@ bool decode(const std::string& msg, Parameter<std::vector<double>>& obj) {
 template<>
 std::string encode<Parameter<bool>>(const Parameter<bool>& obj);
 template<>
+void encode_message(const Parameter<bool>& obj, proto::StateMessage& message);
+template<>
 Parameter<bool> decode(const std::string& msg);
 template<>
 bool decode(const std::string& msg, Parameter<bool>& obj);
 template<>
+bool decode_message(const proto::StateMessage& message, Parameter<bool>& obj);
+template<>
 std::string encode<Parameter<bool>>(const Parameter<bool>& obj) {
-  return encode_parameter(obj);
+  return serialize_message(obj);
+}
+template<>
+void encode_message(const Parameter<bool>& obj, proto::StateMessage& message) {
+  encode_parameter(obj, message);
 }
 template<>
 Parameter<bool> decode(const std::string& msg) {
@@ -995,7 +1287,11 @@ Parameter<bool> decode(const std::string& msg) {
 }
 template<>
 bool decode(const std::string& msg, Parameter<bool>& obj) {
-  return decode_parameter(msg, obj);
+  return parse_and_decode(msg, obj);
+}
+template<>
+bool decode_message(const proto::StateMessage& message, Parameter<bool>& obj) {
+  return decode_parameter(message, obj);
 }
 
 /* ----------------------
@@ -1004,12 +1300,20 @@ bool decode(const std::string& msg, Parameter<bool>& obj) {
 template<>
 std::string encode<Parameter<std::vector<bool>>>(const Parameter<std::vector<bool>>& obj);
 template<>
+void encode_message(const Parameter<std::vector<bool>>& obj, proto::StateMessage& message);
+template<>
 Parameter<std::vector<bool>> decode(const std::string& msg);
 template<>
 bool decode(const std::string& msg, Parameter<std::vector<bool>>& obj);
 template<>
+bool decode_message(const proto::StateMessage& message, Parameter<std::vector<bool>>& obj);
+template<>
 std::string encode<Parameter<std::vector<bool>>>(const Parameter<std::vector<bool>>& obj) {
-  return encode_parameter(obj);
+  return serialize_message(obj);
+}
+template<>
+void encode_message(const Parameter<std::vector<bool>>& obj, proto::StateMessage& message) {
+  encode_parameter(obj, message);
 }
 template<>
 Parameter<std::vector<bool>> decode(const std::string& msg) {
@@ -1017,7 +1321,11 @@ Parameter<std::vector<bool>> decode(const std::string& msg) {
 }
 template<>
 bool decode(const std::string& msg, Parameter<std::vector<bool>>& obj) {
-  return decode_parameter(msg, obj);
+  return parse_and_decode(msg, obj);
+}
+template<>
+bool decode_message(const proto::StateMessage& message, Parameter<std::vector<bool>>& obj) {
+  return decode_parameter(message, obj);
 }
 
 /* ----------------------
@@ -1026,12 +1334,20 @@ bool decode(const std::string& msg, Parameter<std::vector<bool>>& obj) {
 template<>
 std::string encode<Parameter<std::string>>(const Parameter<std::string>& obj);
 template<>
+void encode_message(const Parameter<std::string>& obj, proto::StateMessage& message);
+template<>
 Parameter<std::string> decode(const std::string& msg);
 template<>
 bool decode(const std::string& msg, Parameter<std::string>& obj);
 template<>
+bool decode_message(const proto::StateMessage& message, Parameter<std::string>& obj);
+template<>
 std::string encode<Parameter<std::string>>(const Parameter<std::string>& obj) {
-  return encode_parameter(obj);
+  return serialize_message(obj);
+}
+template<>
+void encode_message(const Parameter<std::string>& obj, proto::StateMessage& message) {
+  encode_parameter(obj, message);
 }
 template<>
 Parameter<std::string> decode(const std::string& msg) {
@@ -1039,7 +1355,11 @@ Parameter<std::string> decode(const std::string& msg) {
 }
 template<>
 bool decode(const std::string& msg, Parameter<std::string>& obj) {
-  return decode_parameter(msg, obj);
+  return parse_and_decode(msg, obj);
+}
+template<>
+bool decode_message(const proto::StateMessage& message, Parameter<std::string>& obj) {
+  return decode_parameter(message, obj);
 }
 
 /* ----------------------
@@ -1048,12 +1368,20 @@ bool decode(const std::string& msg, Parameter<std::string>& obj) {
 template<>
 std::string encode<Parameter<std::vector<std::string>>>(const Parameter<std::vector<std::string>>& obj);
 template<>
+void encode_message(const Parameter<std::vector<std::string>>& obj, proto::StateMessage& message);
+template<>
 Parameter<std::vector<std::string>> decode(const std::string& msg);
 template<>
 bool decode(const std::string& msg, Parameter<std::vector<std::string>>& obj);
 template<>
+bool decode_message(const proto::StateMessage& message, Parameter<std::vector<std::string>>& obj);
+template<>
 std::string encode<Parameter<std::vector<std::string>>>(const Parameter<std::vector<std::string>>& obj) {
-  return encode_parameter(obj);
+  return serialize_message(obj);
+}
+template<>
+void encode_message(const Parameter<std::vector<std::string>>& obj, proto::StateMessage& message) {
+  encode_parameter(obj, message);
 }
 template<>
 Parameter<std::vector<std::string>> decode(const std::string& msg) {
@@ -1061,7 +1389,11 @@ Parameter<std::vector<std::string>> decode(const std::string& msg) {
 }
 template<>
 bool decode(const std::string& msg, Parameter<std::vector<std::string>>& obj) {
-  return decode_parameter(msg, obj);
+  return parse_and_decode(msg, obj);
+}
+template<>
+bool decode_message(const proto::StateMessage& message, Parameter<std::vector<std::string>>& obj) {
+  return decode_parameter(message, obj);
 }
 
 /* ----------------------
@@ -1070,12 +1402,20 @@ bool decode(const std::string& msg, Parameter<std::vector<std::string>>& obj) {
 template<>
 std::string encode<Parameter<Eigen::VectorXd>>(const Parameter<Eigen::VectorXd>& obj);
 template<>
+void encode_message(const Parameter<Eigen::VectorXd>& obj, proto::StateMessage& message);
+template<>
 Parameter<Eigen::VectorXd> decode(const std::string& msg);
 template<>
 bool decode(const std::string& msg, Parameter<Eigen::VectorXd>& obj);
 template<>
+bool decode_message(const proto::StateMessage& message, Parameter<Eigen::VectorXd>& obj);
+template<>
 std::string encode<Parameter<Eigen::VectorXd>>(const Parameter<Eigen::VectorXd>& obj) {
-  return encode_parameter(obj);
+  return serialize_message(obj);
+}
+template<>
+void encode_message(const Parameter<Eigen::VectorXd>& obj, proto::StateMessage& message) {
+  encode_parameter(obj, message);
 }
 template<>
 Parameter<Eigen::VectorXd> decode(const std::string& msg) {
@@ -1083,7 +1423,11 @@ Parameter<Eigen::VectorXd> decode(const std::string& msg) {
 }
 template<>
 bool decode(const std::string& msg, Parameter<Eigen::VectorXd>& obj) {
-  return decode_parameter(msg, obj);
+  return parse_and_decode(msg, obj);
+}
+template<>
+bool decode_message(const proto::StateMessage& message, Parameter<Eigen::VectorXd>& obj) {
+  return decode_parameter(message, obj);
 }
 
 /* ----------------------
@@ -1092,12 +1436,20 @@ bool decode(const std::string& msg, Parameter<Eigen::VectorXd>& obj) {
 template<>
 std::string encode<Parameter<Eigen::MatrixXd>>(const Parameter<Eigen::MatrixXd>& obj);
 template<>
+void encode_message(const Parameter<Eigen::MatrixXd>& obj, proto::StateMessage& message);
+template<>
 Parameter<Eigen::MatrixXd> decode(const std::string& msg);
 template<>
 bool decode(const std::string& msg, Parameter<Eigen::MatrixXd>& obj);
 template<>
+bool decode_message(const proto::StateMessage& message, Parameter<Eigen::MatrixXd>& obj);
+template<>
 std::string encode<Parameter<Eigen::MatrixXd>>(const Parameter<Eigen::MatrixXd>& obj) {
-  return encode_parameter(obj);
+  return serialize_message(obj);
+}
+template<>
+void encode_message(const Parameter<Eigen::MatrixXd>& obj, proto::StateMessage& message) {
+  encode_parameter(obj, message);
 }
 template<>
 Parameter<Eigen::MatrixXd> decode(const std::string& msg) {
@@ -1105,7 +1457,11 @@ Parameter<Eigen::MatrixXd> decode(const std::string& msg) {
 }
 template<>
 bool decode(const std::string& msg, Parameter<Eigen::MatrixXd>& obj) {
-  return decode_parameter(msg, obj);
+  return parse_and_decode(msg, obj);
+}
+template<>
+bool decode_message(const proto::StateMessage& message, Parameter<Eigen::MatrixXd>& obj) {
+  return decode_parameter(message, obj);
 }
 
 /*-----------------------
@@ -1121,88 +1477,92 @@ std::shared_ptr<T> safe_dynamic_pointer_cast(const std::shared_ptr<State>& state
 }
 
 template<> std::string encode<std::shared_ptr<State>>(const std::shared_ptr<State>& obj);
+template<> void encode_message(const std::shared_ptr<State>& obj, proto::StateMessage& message);
 template<> std::shared_ptr<State> decode(const std::string& msg);
 template<> bool decode(const std::string& msg, std::shared_ptr<State>& obj);
+template<> bool decode_message(const proto::StateMessage& message, std::shared_ptr<State>& obj);
 template<> std::string encode<std::shared_ptr<State>>(const std::shared_ptr<State>& obj) {
-  std::string message;
+  return serialize_message(obj);
+}
+template<> void encode_message(const std::shared_ptr<State>& obj, proto::StateMessage& message) {
   switch (obj->get_type()) {
     case StateType::STATE:
-      message = encode<State>(*obj);
+      encode_message(*obj, message);
       break;
     case StateType::DIGITAL_IO_STATE:
-      message = encode<DigitalIOState>(*safe_dynamic_pointer_cast<DigitalIOState>(obj));
+      encode_message(*safe_dynamic_pointer_cast<DigitalIOState>(obj), message);
       break;
     case StateType::ANALOG_IO_STATE:
-      message = encode<AnalogIOState>(*safe_dynamic_pointer_cast<AnalogIOState>(obj));
+      encode_message(*safe_dynamic_pointer_cast<AnalogIOState>(obj), message);
       break;
     case StateType::SPATIAL_STATE:
-      message = encode<SpatialState>(*safe_dynamic_pointer_cast<SpatialState>(obj));
+      encode_message(*safe_dynamic_pointer_cast<SpatialState>(obj), message);
       break;
     case StateType::CARTESIAN_STATE:
-      message = encode<CartesianState>(*safe_dynamic_pointer_cast<CartesianState>(obj));
+      encode_message(*safe_dynamic_pointer_cast<CartesianState>(obj), message);
       break;
     case StateType::CARTESIAN_POSE:
-      message = encode<CartesianPose>(*safe_dynamic_pointer_cast<CartesianPose>(obj));
+      encode_message(*safe_dynamic_pointer_cast<CartesianPose>(obj), message);
       break;
     case StateType::CARTESIAN_TWIST:
-      message = encode<CartesianTwist>(*safe_dynamic_pointer_cast<CartesianTwist>(obj));
+      encode_message(*safe_dynamic_pointer_cast<CartesianTwist>(obj), message);
       break;
     case StateType::CARTESIAN_ACCELERATION:
-      message = encode<CartesianAcceleration>(*safe_dynamic_pointer_cast<CartesianAcceleration>(obj));
+      encode_message(*safe_dynamic_pointer_cast<CartesianAcceleration>(obj), message);
       break;
     case StateType::CARTESIAN_WRENCH:
-      message = encode<CartesianWrench>(*safe_dynamic_pointer_cast<CartesianWrench>(obj));
+      encode_message(*safe_dynamic_pointer_cast<CartesianWrench>(obj), message);
       break;
     case StateType::JOINT_STATE:
-      message = encode<JointState>(*safe_dynamic_pointer_cast<JointState>(obj));
+      encode_message(*safe_dynamic_pointer_cast<JointState>(obj), message);
       break;
     case StateType::JOINT_POSITIONS:
-      message = encode<JointPositions>(*safe_dynamic_pointer_cast<JointPositions>(obj));
+      encode_message(*safe_dynamic_pointer_cast<JointPositions>(obj), message);
       break;
     case StateType::JOINT_VELOCITIES:
-      message = encode<JointVelocities>(*safe_dynamic_pointer_cast<JointVelocities>(obj));
+      encode_message(*safe_dynamic_pointer_cast<JointVelocities>(obj), message);
       break;
     case StateType::JOINT_ACCELERATIONS:
-      message = encode<JointAccelerations>(*safe_dynamic_pointer_cast<JointAccelerations>(obj));
+      encode_message(*safe_dynamic_pointer_cast<JointAccelerations>(obj), message);
       break;
     case StateType::JOINT_TORQUES:
-      message = encode<JointTorques>(*safe_dynamic_pointer_cast<JointTorques>(obj));
+      encode_message(*safe_dynamic_pointer_cast<JointTorques>(obj), message);
       break;
     case StateType::JACOBIAN:
-      message = encode<Jacobian>(*safe_dynamic_pointer_cast<Jacobian>(obj));
+      encode_message(*safe_dynamic_pointer_cast<Jacobian>(obj), message);
       break;
     case StateType::PARAMETER: {
       auto param_ptr = safe_dynamic_pointer_cast<ParameterInterface>(obj);
       switch (param_ptr->get_parameter_type()) {
         case ParameterType::BOOL:
-          message = encode<Parameter<bool>>(*safe_dynamic_pointer_cast<Parameter<bool>>(param_ptr));
+          encode_message(*safe_dynamic_pointer_cast<Parameter<bool>>(param_ptr), message);
           break;
         case ParameterType::BOOL_ARRAY:
-          message = encode<Parameter<std::vector<bool>>>(*safe_dynamic_pointer_cast<Parameter<std::vector<bool>>>(param_ptr));
+          encode_message(*safe_dynamic_pointer_cast<Parameter<std::vector<bool>>>(param_ptr), message);
           break;
         case ParameterType::INT:
-          message = encode<Parameter<int>>(*safe_dynamic_pointer_cast<Parameter<int>>(param_ptr));
+          encode_message(*safe_dynamic_pointer_cast<Parameter<int>>(param_ptr), message);
           break;
         case ParameterType::INT_ARRAY:
-          message = encode<Parameter<std::vector<int>>>(*safe_dynamic_pointer_cast<Parameter<std::vector<int>>>(param_ptr));
+          encode_message(*safe_dynamic_pointer_cast<Parameter<std::vector<int>>>(param_ptr), message);
           break;
         case ParameterType::DOUBLE:
-          message = encode<Parameter<double>>(*safe_dynamic_pointer_cast<Parameter<double>>(param_ptr));
+          encode_message(*safe_dynamic_pointer_cast<Parameter<double>>(param_ptr), message);
           break;
         case ParameterType::DOUBLE_ARRAY:
-          message = encode<Parameter<std::vector<double>>>(*safe_dynamic_pointer_cast<Parameter<std::vector<double>>>(param_ptr));
+          encode_message(*safe_dynamic_pointer_cast<Parameter<std::vector<double>>>(param_ptr), message);
           break;
         case ParameterType::STRING:
-          message = encode<Parameter<std::string>>(*safe_dynamic_pointer_cast<Parameter<std::string>>(param_ptr));
+          encode_message(*safe_dynamic_pointer_cast<Parameter<std::string>>(param_ptr), message);
           break;
         case ParameterType::STRING_ARRAY:
-          message = encode<Parameter<std::vector<std::string>>>(*safe_dynamic_pointer_cast<Parameter<std::vector<std::string>>>(param_ptr));
+          encode_message(*safe_dynamic_pointer_cast<Parameter<std::vector<std::string>>>(param_ptr), message);
           break;
         case ParameterType::VECTOR:
-          message = encode<Parameter<Eigen::VectorXd>>(*safe_dynamic_pointer_cast<Parameter<Eigen::VectorXd>>(param_ptr));
+          encode_message(*safe_dynamic_pointer_cast<Parameter<Eigen::VectorXd>>(param_ptr), message);
           break;
         case ParameterType::MATRIX:
-          message = encode<Parameter<Eigen::MatrixXd>>(*safe_dynamic_pointer_cast<Parameter<Eigen::MatrixXd>>(param_ptr));
+          encode_message(*safe_dynamic_pointer_cast<Parameter<Eigen::MatrixXd>>(param_ptr), message);
           break;
         default:
           throw std::invalid_argument("The ParameterType contained by parameter " + param_ptr->get_name() + " is unsupported.");
@@ -1214,11 +1574,10 @@ template<> std::string encode<std::shared_ptr<State>>(const std::shared_ptr<Stat
       throw std::invalid_argument("The StateType contained by state " + obj->get_name() + " is unsupported.");
       break;
   }
-  return message;
 }
-template<> std::shared_ptr<State> decode(const std::string& msg) {
+static std::shared_ptr<State> create_shared_state(const proto::StateMessage& message) {
   std::shared_ptr<State> obj;
-  switch (check_message_type(msg)) {
+  switch (static_cast<MessageType>(message.message_type_case())) {
     case MessageType::STATE_MESSAGE:
       obj = make_shared_state(State());
       break;
@@ -1265,7 +1624,7 @@ template<> std::shared_ptr<State> decode(const std::string& msg) {
       obj = make_shared_state(Jacobian());
       break;
     case MessageType::PARAMETER_MESSAGE: {
-      switch (check_parameter_message_type(msg)) {
+      switch (static_cast<ParameterMessageType>(message.parameter().parameter_value().value_type_case())) {
         case ParameterMessageType::BOOL:
           obj = make_shared_state(Parameter<bool>(""));
           break;
@@ -1306,91 +1665,174 @@ template<> std::shared_ptr<State> decode(const std::string& msg) {
       throw std::invalid_argument("The MessageType contained by this message is unsupported.");
       break;
   }
-  if (!decode(msg, obj)) {
-    throw DecodingException("Could not decode the message into a std::shared_ptr<State>");
-  }
   return obj;
 }
-template<> bool decode(const std::string& msg, std::shared_ptr<State>& obj) {
-  try {
-    switch (obj->get_type()) {
-      case StateType::STATE:
-        obj = make_shared_state(decode<State>(msg));
-        break;
-      case StateType::DIGITAL_IO_STATE:
-        obj = make_shared_state(decode<DigitalIOState>(msg));
-        break;
-      case StateType::ANALOG_IO_STATE:
-        obj = make_shared_state(decode<AnalogIOState>(msg));
-        break;
-      case StateType::SPATIAL_STATE:
-        obj = make_shared_state(decode<SpatialState>(msg));
-        break;
-      case StateType::CARTESIAN_STATE:
-        obj = make_shared_state(decode<CartesianState>(msg));
-        break;
-      case StateType::CARTESIAN_POSE:
-        obj = make_shared_state(decode<CartesianPose>(msg));
-        break;
-      case StateType::CARTESIAN_TWIST:
-        obj = make_shared_state(decode<CartesianTwist>(msg));
-        break;
-      case StateType::CARTESIAN_ACCELERATION:
-        obj = make_shared_state(decode<CartesianAcceleration>(msg));
-        break;
-      case StateType::CARTESIAN_WRENCH:
-        obj = make_shared_state(decode<CartesianWrench>(msg));
-        break;
-      case StateType::JOINT_STATE:
-        obj = make_shared_state(decode<JointState>(msg));
+// decode a message in place into the existing state of a shared pointer, with the type of that state
+static bool decode_shared_state_in_place(const proto::StateMessage& message, const std::shared_ptr<State>& obj) {
+  switch (obj->get_type()) {
+    case StateType::STATE:
+      return decode_message(message, *obj);
+    case StateType::DIGITAL_IO_STATE:
+      return decode_message(message, *safe_dynamic_pointer_cast<DigitalIOState>(obj));
+    case StateType::ANALOG_IO_STATE:
+      return decode_message(message, *safe_dynamic_pointer_cast<AnalogIOState>(obj));
+    case StateType::SPATIAL_STATE:
+      return decode_message(message, *safe_dynamic_pointer_cast<SpatialState>(obj));
+    case StateType::CARTESIAN_STATE:
+      return decode_message(message, *safe_dynamic_pointer_cast<CartesianState>(obj));
+    case StateType::CARTESIAN_POSE:
+      return decode_message(message, *safe_dynamic_pointer_cast<CartesianPose>(obj));
+    case StateType::CARTESIAN_TWIST:
+      return decode_message(message, *safe_dynamic_pointer_cast<CartesianTwist>(obj));
+    case StateType::CARTESIAN_ACCELERATION:
+      return decode_message(message, *safe_dynamic_pointer_cast<CartesianAcceleration>(obj));
+    case StateType::CARTESIAN_WRENCH:
+      return decode_message(message, *safe_dynamic_pointer_cast<CartesianWrench>(obj));
+    case StateType::JOINT_STATE:
+      return decode_message(message, *safe_dynamic_pointer_cast<JointState>(obj));
+    case StateType::JOINT_POSITIONS:
+      return decode_message(message, *safe_dynamic_pointer_cast<JointPositions>(obj));
+    case StateType::JOINT_VELOCITIES:
+      return decode_message(message, *safe_dynamic_pointer_cast<JointVelocities>(obj));
+    case StateType::JOINT_ACCELERATIONS:
+      return decode_message(message, *safe_dynamic_pointer_cast<JointAccelerations>(obj));
+    case StateType::JOINT_TORQUES:
+      return decode_message(message, *safe_dynamic_pointer_cast<JointTorques>(obj));
+    case StateType::JACOBIAN:
+      return decode_message(message, *safe_dynamic_pointer_cast<Jacobian>(obj));
+    case StateType::PARAMETER: {
+      auto param_ptr = safe_dynamic_pointer_cast<ParameterInterface>(obj);
+      switch (param_ptr->get_parameter_type()) {
+        case ParameterType::BOOL:
+          return decode_message(message, *safe_dynamic_pointer_cast<Parameter<bool>>(obj));
+        case ParameterType::BOOL_ARRAY:
+          return decode_message(message, *safe_dynamic_pointer_cast<Parameter<std::vector<bool>>>(obj));
+        case ParameterType::INT:
+          return decode_message(message, *safe_dynamic_pointer_cast<Parameter<int>>(obj));
+        case ParameterType::INT_ARRAY:
+          return decode_message(message, *safe_dynamic_pointer_cast<Parameter<std::vector<int>>>(obj));
+        case ParameterType::DOUBLE:
+          return decode_message(message, *safe_dynamic_pointer_cast<Parameter<double>>(obj));
+        case ParameterType::DOUBLE_ARRAY:
+          return decode_message(message, *safe_dynamic_pointer_cast<Parameter<std::vector<double>>>(obj));
+        case ParameterType::STRING:
+          return decode_message(message, *safe_dynamic_pointer_cast<Parameter<std::string>>(obj));
+        case ParameterType::STRING_ARRAY:
+          return decode_message(message, *safe_dynamic_pointer_cast<Parameter<std::vector<std::string>>>(obj));
+        case ParameterType::VECTOR:
+          return decode_message(message, *safe_dynamic_pointer_cast<Parameter<Eigen::VectorXd>>(obj));
+        case ParameterType::MATRIX:
+          return decode_message(message, *safe_dynamic_pointer_cast<Parameter<Eigen::MatrixXd>>(obj));
+        default:
+          throw std::invalid_argument("The ParameterType contained by parameter " + param_ptr->get_name() + " is unsupported.");
+      }
+    }
+    default:
+      throw std::invalid_argument("The StateType contained by state " + obj->get_name() + " is unsupported.");
+  }
+}
+template<typename T>
+static std::shared_ptr<State> decode_shared_state(const proto::StateMessage& message, T obj) {
+  if (!decode_message(message, obj)) {
+    throw DecodingException("Could not decode the message into a std::shared_ptr<State>");
+  }
+  return make_shared_state(obj);
+}
+template<> std::shared_ptr<State> decode(const std::string& msg) {
+  proto::StateMessage message;
+  if (!message.ParseFromString(msg)) {
+    throw DecodingException("Could not decode the message into a std::shared_ptr<State>");
+  }
+  // the state created with the type of the message is decoded in place, such that it is the only allocation
+  auto obj = create_shared_state(message);
+  if (!decode_shared_state_in_place(message, obj)) {
+    throw DecodingException("Could not decode the message into a std::shared_ptr<State>");
+  }
+  return obj;
+}
+template<> bool decode(const std::string& msg, std::shared_ptr<State>& obj) {
+  return parse_and_decode(msg, obj);
+}
+template<> bool decode_message(const proto::StateMessage& message, std::shared_ptr<State>& obj) {
+  try {
+    switch (obj->get_type()) {
+      case StateType::STATE:
+        obj = decode_shared_state(message, State());
+        break;
+      case StateType::DIGITAL_IO_STATE:
+        obj = decode_shared_state(message, DigitalIOState());
+        break;
+      case StateType::ANALOG_IO_STATE:
+        obj = decode_shared_state(message, AnalogIOState());
+        break;
+      case StateType::SPATIAL_STATE:
+        obj = decode_shared_state(message, SpatialState());
+        break;
+      case StateType::CARTESIAN_STATE:
+        obj = decode_shared_state(message, CartesianState());
+        break;
+      case StateType::CARTESIAN_POSE:
+        obj = decode_shared_state(message, CartesianPose());
+        break;
+      case StateType::CARTESIAN_TWIST:
+        obj = decode_shared_state(message, CartesianTwist());
+        break;
+      case StateType::CARTESIAN_ACCELERATION:
+        obj = decode_shared_state(message, CartesianAcceleration());
+        break;
+      case StateType::CARTESIAN_WRENCH:
+        obj = decode_shared_state(message, CartesianWrench());
+        break;
+      case StateType::JOINT_STATE:
+        obj = decode_shared_state(message, JointState());
         break;
       case StateType::JOINT_POSITIONS:
-        obj = make_shared_state(decode<JointPositions>(msg));
+        obj = decode_shared_state(message, JointPositions());
         break;
       case StateType::JOINT_VELOCITIES:
-        obj = make_shared_state(decode<JointVelocities>(msg));
+        obj = decode_shared_state(message, JointVelocities());
         break;
       case StateType::JOINT_ACCELERATIONS:
-        obj = make_shared_state(decode<JointAccelerations>(msg));
+        obj = decode_shared_state(message, JointAccelerations());
         break;
       case StateType::JOINT_TORQUES:
-        obj = make_shared_state(decode<JointTorques>(msg));
+        obj = decode_shared_state(message, JointTorques());
         break;
       case StateType::JACOBIAN:
-        obj = make_shared_state(decode<Jacobian>(msg));
+        obj = decode_shared_state(message, Jacobian());
         break;
       case StateType::PARAMETER: {
         auto param_ptr = safe_dynamic_pointer_cast<ParameterInterface>(obj);
         switch (param_ptr->get_parameter_type()) {
           case ParameterType::BOOL:
-            obj = make_shared_state(decode<Parameter<bool>>(msg));
+            obj = decode_shared_state(message, Parameter<bool>(""));
             break;
           case ParameterType::BOOL_ARRAY:
-            obj = make_shared_state(decode<Parameter<std::vector<bool>>>(msg));
+            obj = decode_shared_state(message, Parameter<std::vector<bool>>(""));
             break;
           case ParameterType::INT:
-            obj = make_shared_state(decode<Parameter<int>>(msg));
+            obj = decode_shared_state(message, Parameter<int>(""));
             break;
           case ParameterType::INT_ARRAY:
-            obj = make_shared_state(decode<Parameter<std::vector<int>>>(msg));
+            obj = decode_shared_state(message, Parameter<std::vector<int>>(""));
             break;
           case ParameterType::DOUBLE:
-            obj = make_shared_state(decode<Parameter<double>>(msg));
+            obj = decode_shared_state(message, Parameter<double>(""));
             break;
           case ParameterType::DOUBLE_ARRAY:
-            obj = make_shared_state(decode<Parameter<std::vector<double>>>(msg));
+            obj = decode_shared_state(message, Parameter<std::vector<double>>(""));
             break;
           case ParameterType::STRING:
-            obj = make_shared_state(decode<Parameter<std::string>>(msg));
+            obj = decode_shared_state(message, Parameter<std::string>(""));
             break;
           case ParameterType::STRING_ARRAY:
-            obj = make_shared_state(decode<Parameter<std::vector<std::string>>>(msg));
+            obj = decode_shared_state(message, Parameter<std::vector<std::string>>(""));
             break;
           case ParameterType::VECTOR:
-            obj = make_shared_state(decode<Parameter<Eigen::VectorXd>>(msg));
+            obj = decode_shared_state(message, Parameter<Eigen::VectorXd>(""));
             break;
           case ParameterType::MATRIX:
-            obj = make_shared_state(decode<Parameter<Eigen::MatrixXd>>(msg));
+            obj = decode_shared_state(message, Parameter<Eigen::MatrixXd>(""));
             break;
           default:
             throw std::invalid_argument("The ParameterType contained by parameter " + param_ptr->get_name() + " is unsupported.");
@@ -1408,17 +1850,755 @@ template<> bool decode(const std::string& msg, std::shared_ptr<State>& obj) {
   }
 }
 
+/* ----------------------
+ *     STD::VECTOR<T>
+ * ---------------------- */
+template<typename T>
+static void encode_batch(const std::vector<T>& objs, proto::StateMessage& message);
+template<typename T>
+static std::vector<T> decode_batch(const std::string& msg);
+template<typename T>
+static bool decode_batch(const proto::StateMessage& message, std::vector<T>& objs);
+
+template<typename T>
+static void encode_batch(const std::vector<T>& objs, proto::StateMessage& message) {
+  auto* messages = message.mutable_batch()->mutable_messages();
+  messages->Reserve(static_cast<int>(objs.size()));
+  for (const auto& obj : objs) {
+    encode_message(obj, *messages->Add());
+  }
+}
+template<typename T>
+static std::vector<T> decode_batch(const std::string& msg) {
+  std::vector<T> objs;
+  if (!decode(msg, objs)) {
+    throw DecodingException("Could not decode the message into a std::vector");
+  }
+  return objs;
+}
+// whether a state has the type of a message, such that the message can be decoded into it in place
+static bool has_message_type(const State& obj, const proto::StateMessage& message) {
+  switch (static_cast<MessageType>(message.message_type_case())) {
+    case MessageType::STATE_MESSAGE:
+      return obj.get_type() == StateType::STATE;
+    case MessageType::DIGITAL_IO_STATE_MESSAGE:
+      return obj.get_type() == StateType::DIGITAL_IO_STATE;
+    case MessageType::ANALOG_IO_STATE_MESSAGE:
+      return obj.get_type() == StateType::ANALOG_IO_STATE;
+    case MessageType::SPATIAL_STATE_MESSAGE:
+      return obj.get_type() == StateType::SPATIAL_STATE;
+    case MessageType::CARTESIAN_STATE_MESSAGE:
+      return obj.get_type() == StateType::CARTESIAN_STATE;
+    case MessageType::CARTESIAN_POSE_MESSAGE:
+      return obj.get_type() == StateType::CARTESIAN_POSE;
+    case MessageType::CARTESIAN_TWIST_MESSAGE:
+      return obj.get_type() == StateType::CARTESIAN_TWIST;
+    case MessageType::CARTESIAN_ACCELERATION_MESSAGE:
+      return obj.get_type() == StateType::CARTESIAN_ACCELERATION;
+    case MessageType::CARTESIAN_WRENCH_MESSAGE:
+      return obj.get_type() == StateType::CARTESIAN_WRENCH;
+    case MessageType::JOINT_STATE_MESSAGE:
+      return obj.get_type() == StateType::JOINT_STATE;
+    case MessageType::JOINT_POSITIONS_MESSAGE:
+      return obj.get_type() == StateType::JOINT_POSITIONS;
+    case MessageType::JOINT_VELOCITIES_MESSAGE:
+      return obj.get_type() == StateType::JOINT_VELOCITIES;
+    case MessageType::JOINT_ACCELERATIONS_MESSAGE:
+      return obj.get_type() == StateType::JOINT_ACCELERATIONS;
+    case MessageType::JOINT_TORQUES_MESSAGE:
+      return obj.get_type() == StateType::JOINT_TORQUES;
+    case MessageType::JACOBIAN_MESSAGE:
+      return obj.get_type() == StateType::JACOBIAN;
+    case MessageType::PARAMETER_MESSAGE: {
+      if (obj.get_type() != StateType::PARAMETER) {
+        return false;
+      }
+      auto parameter_type = dynamic_cast<const ParameterInterface&>(obj).get_parameter_type();
+      switch (static_cast<ParameterMessageType>(message.parameter().parameter_value().value_type_case())) {
+        case ParameterMessageType::BOOL:
+          return parameter_type == ParameterType::BOOL;
+        case ParameterMessageType::BOOL_ARRAY:
+          return parameter_type == ParameterType::BOOL_ARRAY;
+        case ParameterMessageType::INT:
+          return parameter_type == ParameterType::INT;
+        case ParameterMessageType::INT_ARRAY:
+          return parameter_type == ParameterType::INT_ARRAY;
+        case ParameterMessageType::DOUBLE:
+          return parameter_type == ParameterType::DOUBLE;
+        case ParameterMessageType::DOUBLE_ARRAY:
+          return parameter_type == ParameterType::DOUBLE_ARRAY;
+        case ParameterMessageType::STRING:
+          return parameter_type == ParameterType::STRING;
+        case ParameterMessageType::STRING_ARRAY:
+          return parameter_type == ParameterType::STRING_ARRAY;
+        case ParameterMessageType::VECTOR:
+          return parameter_type == ParameterType::VECTOR;
+        case ParameterMessageType::MATRIX:
+          return parameter_type == ParameterType::MATRIX;
+        default:
+          return false;
+      }
+    }
+    default:
+      return false;
+  }
+}
+// whether the fields of a message have the sizes expected by its decoding, such that the elements of a batch are all
+// checked before any of them is decoded
+static bool has_valid_sizes(const proto::StateMessage& message) {
+  switch (static_cast<MessageType>(message.message_type_case())) {
+    case MessageType::ANALOG_IO_STATE_MESSAGE: {
+      const auto& state = message.analog_io_state();
+      return state.state().empty() || state.values_size() == state.io_names_size();
+    }
+    case MessageType::DIGITAL_IO_STATE_MESSAGE: {
+      const auto& state = message.digital_io_state();
+      return state.state().empty() || state.values_size() == state.io_names_size();
+    }
+    case MessageType::JACOBIAN_MESSAGE: {
+      const auto& jacobian = message.jacobian();
+      return jacobian.state().empty() || jacobian.data().empty()
+          || (jacobian.rows() == 6 && jacobian.cols() == static_cast<unsigned int>(jacobian.joint_names_size())
+              && jacobian.data_size() == static_cast<int>(jacobian.rows() * jacobian.cols()));
+    }
+    case MessageType::JOINT_STATE_MESSAGE: {
+      const auto& state = message.joint_state();
+      auto nb_joints = state.joint_names_size();
+      return state.state().empty() || (has_joint_size(state.positions(), nb_joints)
+          && has_joint_size(state.velocities(), nb_joints) && has_joint_size(state.accelerations(), nb_joints)
+          && has_joint_size(state.torques(), nb_joints));
+    }
+    case MessageType::JOINT_POSITIONS_MESSAGE: {
+      const auto& positions = message.joint_positions();
+      return positions.state().empty() || has_joint_size(positions.positions(), positions.joint_names_size());
+    }
+    case MessageType::JOINT_VELOCITIES_MESSAGE: {
+      const auto& velocities = message.joint_velocities();
+      return velocities.state().empty() || has_joint_size(velocities.velocities(), velocities.joint_names_size());
+    }
+    case MessageType::JOINT_ACCELERATIONS_MESSAGE: {
+      const auto& accelerations = message.joint_accelerations();
+      return accelerations.state().empty()
+          || has_joint_size(accelerations.accelerations(), accelerations.joint_names_size());
+    }
+    case MessageType::JOINT_TORQUES_MESSAGE: {
+      const auto& torques = message.joint_torques();
+      return torques.state().empty() || has_joint_size(torques.torques(), torques.joint_names_size());
+    }
+    case MessageType::PARAMETER_MESSAGE: {
+      const auto& value = message.parameter().parameter_value();
+      return message.parameter().state().empty() || !value.has_matrix()
+          || value.matrix().value_size() == static_cast<int>(value.matrix().rows() * value.matrix().cols());
+    }
+    default:
+      return true;
+  }
+}
+template<typename T>
+static bool decode_batch(const proto::StateMessage& message, std::vector<T>& objs) {
+  if (message.message_type_case() != proto::StateMessage::MessageTypeCase::kBatch) {
+    return false;
+  }
+  // all the elements are checked first such that the vector is only modified if all of them can be decoded, and
+  // they are then decoded in place into the existing elements to reuse their allocations
+  const auto& messages = message.batch().messages();
+  auto nb_elements = static_cast<std::size_t>(messages.size());
+  auto element_type = empty_object<T>::make();
+  for (const auto& element_message : messages) {
+    if (!has_message_type(element_type, element_message) || !has_valid_sizes(element_message)) {
+      return false;
+    }
+  }
+  if (objs.size() > nb_elements) {
+    objs.erase(objs.begin() + static_cast<std::ptrdiff_t>(nb_elements), objs.end());
+  }
+  objs.reserve(nb_elements);
+  while (objs.size() < nb_elements) {
+    objs.push_back(empty_object<T>::make());
+  }
+  for (std::size_t index = 0; index < nb_elements; ++index) {
+    if (!decode_message(messages.Get(static_cast<int>(index)), objs[index])) {
+      return false;
+    }
+  }
+  return true;
+}
+static bool decode_batch(const proto::StateMessage& message, std::vector<std::shared_ptr<State>>& objs) {
+  if (message.message_type_case() != proto::StateMessage::MessageTypeCase::kBatch) {
+    return false;
+  }
+  // the states of the elements that can not be reused are created while all the elements are checked, such that the
+  // reused states are only updated once all of them can be decoded
+  const auto& messages = message.batch().messages();
+  auto nb_elements = static_cast<std::size_t>(messages.size());
+  std::vector<std::shared_ptr<State>> created(nb_elements);
+  try {
+    for (std::size_t index = 0; index < nb_elements; ++index) {
+      const auto& element_message = messages.Get(static_cast<int>(index));
+      if (!has_valid_sizes(element_message)) {
+        return false;
+      }
+      if (index >= objs.size() || objs[index] == nullptr || !has_message_type(*objs[index], element_message)) {
+        created[index] = create_shared_state(element_message);
+      }
+    }
+  } catch (...) {
+    return false;
+  }
+  if (objs.size() > nb_elements) {
+    objs.erase(objs.begin() + static_cast<std::ptrdiff_t>(nb_elements), objs.end());
+  }
+  objs.resize(nb_elements);
+  for (std::size_t index = 0; index < nb_elements; ++index) {
+    if (created[index] != nullptr) {
+      objs[index] = std::move(created[index]);
+    }
+    try {
+      if (!decode_shared_state_in_place(messages.Get(static_cast<int>(index)), objs[index])) {
+        return false;
+      }
+    } catch (...) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template<> std::string encode<std::vector<State>>(const std::vector<State>& obj);
+template<> void encode_message(const std::vector<State>& obj, proto::StateMessage& message);
+template<> std::vector<State> decode(const std::string& msg);
+template<> bool decode(const std::string& msg, std::vector<State>& obj);
+template<> bool decode_message(const proto::StateMessage& message, std::vector<State>& obj);
+template<> std::string encode<std::vector<DigitalIOState>>(const std::vector<DigitalIOState>& obj);
+template<> void encode_message(const std::vector<DigitalIOState>& obj, proto::StateMessage& message);
+template<> std::vector<DigitalIOState> decode(const std::string& msg);
+template<> bool decode(const std::string& msg, std::vector<DigitalIOState>& obj);
+template<> bool decode_message(const proto::StateMessage& message, std::vector<DigitalIOState>& obj);
+template<> std::string encode<std::vector<AnalogIOState>>(const std::vector<AnalogIOState>& obj);
+template<> void encode_message(const std::vector<AnalogIOState>& obj, proto::StateMessage& message);
+template<> std::vector<AnalogIOState> decode(const std::string& msg);
+template<> bool decode(const std::string& msg, std::vector<AnalogIOState>& obj);
+template<> bool decode_message(const proto::StateMessage& message, std::vector<AnalogIOState>& obj);
+template<> std::string encode<std::vector<SpatialState>>(const std::vector<SpatialState>& obj);
+template<> void encode_message(const std::vector<SpatialState>& obj, proto::StateMessage& message);
+template<> std::vector<SpatialState> decode(const std::string& msg);
+template<> bool decode(const std::string& msg, std::vector<SpatialState>& obj);
+template<> bool decode_message(const proto::StateMessage& message, std::vector<SpatialState>& obj);
+template<> std::string encode<std::vector<CartesianState>>(const std::vector<CartesianState>& obj);
+template<> void encode_message(const std::vector<CartesianState>& obj, proto::StateMessage& message);
+template<> std::vector<CartesianState> decode(const std::string& msg);
+template<> bool decode(const std::string& msg, std::vector<CartesianState>& obj);
+template<> bool decode_message(const proto::StateMessage& message, std::vector<CartesianState>& obj);
+template<> std::string encode<std::vector<CartesianPose>>(const std::vector<CartesianPose>& obj);
+template<> void encode_message(const std::vector<CartesianPose>& obj, proto::StateMessage& message);
+template<> std::vector<CartesianPose> decode(const std::string& msg);
+template<> bool decode(const std::string& msg, std::vector<CartesianPose>& obj);
+template<> bool decode_message(const proto::StateMessage& message, std::vector<CartesianPose>& obj);
+template<> std::string encode<std::vector<CartesianTwist>>(const std::vector<CartesianTwist>& obj);
+template<> void encode_message(const std::vector<CartesianTwist>& obj, proto::StateMessage& message);
+template<> std::vector<CartesianTwist> decode(const std::string& msg);
+template<> bool decode(const std::string& msg, std::vector<CartesianTwist>& obj);
+template<> bool decode_message(const proto::StateMessage& message, std::vector<CartesianTwist>& obj);
+template<> std::string encode<std::vector<CartesianAcceleration>>(const std::vector<CartesianAcceleration>& obj);
+template<> void encode_message(const std::vector<CartesianAcceleration>& obj, proto::StateMessage& message);
+template<> std::vector<CartesianAcceleration> decode(const std::string& msg);
+template<> bool decode(const std::string& msg, std::vector<CartesianAcceleration>& obj);
+template<> bool decode_message(const proto::StateMessage& message, std::vector<CartesianAcceleration>& obj);
+template<> std::string encode<std::vector<CartesianWrench>>(const std::vector<CartesianWrench>& obj);
+template<> void encode_message(const std::vector<CartesianWrench>& obj, proto::StateMessage& message);
+template<> std::vector<CartesianWrench> decode(const std::string& msg);
+template<> bool decode(const std::string& msg, std::vector<CartesianWrench>& obj);
+template<> bool decode_message(const proto::StateMessage& message, std::vector<CartesianWrench>& obj);
+template<> std::string encode<std::vector<Jacobian>>(const std::vector<Jacobian>& obj);
+template<> void encode_message(const std::vector<Jacobian>& obj, proto::StateMessage& message);
+template<> std::vector<Jacobian> decode(const std::string& msg);
+template<> bool decode(const std::string& msg, std::vector<Jacobian>& obj);
+template<> bool decode_message(const proto::StateMessage& message, std::vector<Jacobian>& obj);
+template<> std::string encode<std::vector<JointState>>(const std::vector<JointState>& obj);
+template<> void encode_message(const std::vector<JointState>& obj, proto::StateMessage& message);
+template<> std::vector<JointState> decode(const std::string& msg);
+template<> bool decode(const std::string& msg, std::vector<JointState>& obj);
+template<> bool decode_message(const proto::StateMessage& message, std::vector<JointState>& obj);
+template<> std::string encode<std::vector<JointPositions>>(const std::vector<JointPositions>& obj);
+template<> void encode_message(const std::vector<JointPositions>& obj, proto::StateMessage& message);
+template<> std::vector<JointPositions> decode(const std::string& msg);
+template<> bool decode(const std::string& msg, std::vector<JointPositions>& obj);
+template<> bool decode_message(const proto::StateMessage& message, std::vector<JointPositions>& obj);
+template<> std::string encode<std::vector<JointVelocities>>(const std::vector<JointVelocities>& obj);
+template<> void encode_message(const std::vector<JointVelocities>& obj, proto::StateMessage& message);
+template<> std::vector<JointVelocities> decode(const std::string& msg);
+template<> bool decode(const std::string& msg, std::vector<JointVelocities>& obj);
+template<> bool decode_message(const proto::StateMessage& message, std::vector<JointVelocities>& obj);
+template<> std::string encode<std::vector<JointAccelerations>>(const std::vector<JointAccelerations>& obj);
+template<> void encode_message(const std::vector<JointAccelerations>& obj, proto::StateMessage& message);
+template<> std::vector<JointAccelerations> decode(const std::string& msg);
+template<> bool decode(const std::string& msg, std::vector<JointAccelerations>& obj);
+template<> bool decode_message(const proto::StateMessage& message, std::vector<JointAccelerations>& obj);
+template<> std::string encode<std::vector<JointTorques>>(const std::vector<JointTorques>& obj);
+template<> void encode_message(const std::vector<JointTorques>& obj, proto::StateMessage& message);
+template<> std::vector<JointTorques> decode(const std::string& msg);
+template<> bool decode(const std::string& msg, std::vector<JointTorques>& obj);
+template<> bool decode_message(const proto::StateMessage& message, std::vector<JointTorques>& obj);
+template<> std::string encode<std::vector<Parameter<int>>>(const std::vector<Parameter<int>>& obj);
+template<> void encode_message(const std::vector<Parameter<int>>& obj, proto::StateMessage& message);
+template<> std::vector<Parameter<int>> decode(const std::string& msg);
+template<> bool decode(const std::string& msg, std::vector<Parameter<int>>& obj);
+template<> bool decode_message(const proto::StateMessage& message, std::vector<Parameter<int>>& obj);
+template<> std::string encode<std::vector<Parameter<std::vector<int>>>>(const std::vector<Parameter<std::vector<int>>>& obj);
+template<> void encode_message(const std::vector<Parameter<std::vector<int>>>& obj, proto::StateMessage& message);
+template<> std::vector<Parameter<std::vector<int>>> decode(const std::string& msg);
+template<> bool decode(const std::string& msg, std::vector<Parameter<std::vector<int>>>& obj);
+template<> bool decode_message(const proto::StateMessage& message, std::vector<Parameter<std::vector<int>>>& obj);
+template<> std::string encode<std::vector<Parameter<double>>>(const std::vector<Parameter<double>>& obj);
+template<> void encode_message(const std::vector<Parameter<double>>& obj, proto::StateMessage& message);
+template<> std::vector<Parameter<double>> decode(const std::string& msg);
+template<> bool decode(const std::string& msg, std::vector<Parameter<double>>& obj);
+template<> bool decode_message(const proto::StateMessage& message, std::vector<Parameter<double>>& obj);
+template<> std::string encode<std::vector<Parameter<std::vector<double>>>>(const std::vector<Parameter<std::vector<double>>>& obj);
+template<> void encode_message(const std::vector<Parameter<std::vector<double>>>& obj, proto::StateMessage& message);
+template<> std::vector<Parameter<std::vector<double>>> decode(const std::string& msg);
+template<> bool decode(const std::string& msg, std::vector<Parameter<std::vector<double>>>& obj);
+template<> bool decode_message(const proto::StateMessage& message, std::vector<Parameter<std::vector<double>>>& obj);
+template<> std::string encode<std::vector<Parameter<bool>>>(const std::vector<Parameter<bool>>& obj);
+template<> void encode_message(const std::vector<Parameter<bool>>& obj, proto::StateMessage& message);
+template<> std::vector<Parameter<bool>> decode(const std::string& msg);
+template<> bool decode(const std::string& msg, std::vector<Parameter<bool>>& obj);
+template<> bool decode_message(const proto::StateMessage& message, std::vector<Parameter<bool>>& obj);
+template<> std::string encode<std::vector<Parameter<std::vector<bool>>>>(const std::vector<Parameter<std::vector<bool>>>& obj);
+template<> void encode_message(const std::vector<Parameter<std::vector<bool>>>& obj, proto::StateMessage& message);
+template<> std::vector<Parameter<std::vector<bool>>> decode(const std::string& msg);
+template<> bool decode(const std::string& msg, std::vector<Parameter<std::vector<bool>>>& obj);
+template<> bool decode_message(const proto::StateMessage& message, std::vector<Parameter<std::vector<bool>>>& obj);
+template<> std::string encode<std::vector<Parameter<std::string>>>(const std::vector<Parameter<std::string>>& obj);
+template<> void encode_message(const std::vector<Parameter<std::string>>& obj, proto::StateMessage& message);
+template<> std::vector<Parameter<std::string>> decode(const std::string& msg);
+template<> bool decode(const std::string& msg, std::vector<Parameter<std::string>>& obj);
+template<> bool decode_message(const proto::StateMessage& message, std::vector<Parameter<std::string>>& obj);
+template<> std::string encode<std::vector<Parameter<std::vector<std::string>>>>(const std::vector<Parameter<std::vector<std::string>>>& obj);
+template<> void encode_message(const std::vector<Parameter<std::vector<std::string>>>& obj, proto::StateMessage& message);
+template<> std::vector<Parameter<std::vector<std::string>>> decode(const std::string& msg);
+template<> bool decode(const std::string& msg, std::vector<Parameter<std::vector<std::string>>>& obj);
+template<> bool decode_message(const proto::StateMessage& message, std::vector<Parameter<std::vector<std::string>>>& obj);
+template<> std::string encode<std::vector<Parameter<Eigen::VectorXd>>>(const std::vector<Parameter<Eigen::VectorXd>>& obj);
+template<> void encode_message(const std::vector<Parameter<Eigen::VectorXd>>& obj, proto::StateMessage& message);
+template<> std::vector<Parameter<Eigen::VectorXd>> decode(const std::string& msg);
+template<> bool decode(const std::string& msg, std::vector<Parameter<Eigen::VectorXd>>& obj);
+template<> bool decode_message(const proto::StateMessage& message, std::vector<Parameter<Eigen::VectorXd>>& obj);
+template<> std::string encode<std::vector<Parameter<Eigen::MatrixXd>>>(const std::vector<Parameter<Eigen::MatrixXd>>& obj);
+template<> void encode_message(const std::vector<Parameter<Eigen::MatrixXd>>& obj, proto::StateMessage& message);
+template<> std::vector<Parameter<Eigen::MatrixXd>> decode(const std::string& msg);
+template<> bool decode(const std::string& msg, std::vector<Parameter<Eigen::MatrixXd>>& obj);
+template<> bool decode_message(const proto::StateMessage& message, std::vector<Parameter<Eigen::MatrixXd>>& obj);
+template<> std::string encode<std::vector<std::shared_ptr<State>>>(const std::vector<std::shared_ptr<State>>& obj);
+template<> void encode_message(const std::vector<std::shared_ptr<State>>& obj, proto::StateMessage& message);
+template<> std::vector<std::shared_ptr<State>> decode(const std::string& msg);
+template<> bool decode(const std::string& msg, std::vector<std::shared_ptr<State>>& obj);
+template<> bool decode_message(const proto::StateMessage& message, std::vector<std::shared_ptr<State>>& obj);
+template<> std::string encode<std::vector<State>>(const std::vector<State>& obj) {
+  return serialize_message(obj);
+}
+template<> void encode_message(const std::vector<State>& obj, proto::StateMessage& message) {
+  encode_batch(obj, message);
+}
+template<> std::vector<State> decode(const std::string& msg) {
+  return decode_batch<State>(msg);
+}
+template<> bool decode(const std::string& msg, std::vector<State>& obj) {
+  return parse_and_decode(msg, obj);
+}
+template<> bool decode_message(const proto::StateMessage& message, std::vector<State>& obj) {
+  return decode_batch(message, obj);
+}
+template<> std::string encode<std::vector<DigitalIOState>>(const std::vector<DigitalIOState>& obj) {
+  return serialize_message(obj);
+}
+template<> void encode_message(const std::vector<DigitalIOState>& obj, proto::StateMessage& message) {
+  encode_batch(obj, message);
+}
+template<> std::vector<DigitalIOState> decode(const std::string& msg) {
+  return decode_batch<DigitalIOState>(msg);
+}
+template<> bool decode(const std::string& msg, std::vector<DigitalIOState>& obj) {
+  return parse_and_decode(msg, obj);
+}
+template<> bool decode_message(const proto::StateMessage& message, std::vector<DigitalIOState>& obj) {
+  return decode_batch(message, obj);
+}
+template<> std::string encode<std::vector<AnalogIOState>>(const std::vector<AnalogIOState>& obj) {
+  return serialize_message(obj);
+}
+template<> void encode_message(const std::vector<AnalogIOState>& obj, proto::StateMessage& message) {
+  encode_batch(obj, message);
+}
+template<> std::vector<AnalogIOState> decode(const std::string& msg) {
+  return decode_batch<AnalogIOState>(msg);
+}
+template<> bool decode(const std::string& msg, std::vector<AnalogIOState>& obj) {
+  return parse_and_decode(msg, obj);
+}
+template<> bool decode_message(const proto::StateMessage& message, std::vector<AnalogIOState>& obj) {
+  return decode_batch(message, obj);
+}
+template<> std::string encode<std::vector<SpatialState>>(const std::vector<SpatialState>& obj) {
+  return serialize_message(obj);
+}
+template<> void encode_message(const std::vector<SpatialState>& obj, proto::StateMessage& message) {
+  encode_batch(obj, message);
+}
+template<> std::vector<SpatialState> decode(const std::string& msg) {
+  return decode_batch<SpatialState>(msg);
+}
+template<> bool decode(const std::string& msg, std::vector<SpatialState>& obj) {
+  return parse_and_decode(msg, obj);
+}
+template<> bool decode_message(const proto::StateMessage& message, std::vector<SpatialState>& obj) {
+  return decode_batch(message, obj);
+}
+template<> std::string encode<std::vector<CartesianState>>(const std::vector<CartesianState>& obj) {
+  return serialize_message(obj);
+}
+template<> void encode_message(const std::vector<CartesianState>& obj, proto::StateMessage& message) {
+  encode_batch(obj, message);
+}
+template<> std::vector<CartesianState> decode(const std::string& msg) {
+  return decode_batch<CartesianState>(msg);
+}
+template<> bool decode(const std::string& msg, std::vector<CartesianState>& obj) {
+  return parse_and_decode(msg, obj);
+}
+template<> bool decode_message(const proto::StateMessage& message, std::vector<CartesianState>& obj) {
+  return decode_batch(message, obj);
+}
+template<> std::string encode<std::vector<CartesianPose>>(const std::vector<CartesianPose>& obj) {
+  return serialize_message(obj);
+}
+template<> void encode_message(const std::vector<CartesianPose>& obj, proto::StateMessage& message) {
+  encode_batch(obj, message);
+}
+template<> std::vector<CartesianPose> decode(const std::string& msg) {
+  return decode_batch<CartesianPose>(msg);
+}
+template<> bool decode(const std::string& msg, std::vector<CartesianPose>& obj) {
+  return parse_and_decode(msg, obj);
+}
+template<> bool decode_message(const proto::StateMessage& message, std::vector<CartesianPose>& obj) {
+  return decode_batch(message, obj);
+}
+template<> std::string encode<std::vector<CartesianTwist>>(const std::vector<CartesianTwist>& obj) {
+  return serialize_message(obj);
+}
+template<> void encode_message(const std::vector<CartesianTwist>& obj, proto::StateMessage& message) {
+  encode_batch(obj, message);
+}
+template<> std::vector<CartesianTwist> decode(const std::string& msg) {
+  return decode_batch<CartesianTwist>(msg);
+}
+template<> bool decode(const std::string& msg, std::vector<CartesianTwist>& obj) {
+  return parse_and_decode(msg, obj);
+}
+template<> bool decode_message(const proto::StateMessage& message, std::vector<CartesianTwist>& obj) {
+  return decode_batch(message, obj);
+}
+template<> std::string encode<std::vector<CartesianAcceleration>>(const std::vector<CartesianAcceleration>& obj) {
+  return serialize_message(obj);
+}
+template<> void encode_message(const std::vector<CartesianAcceleration>& obj, proto::StateMessage& message) {
+  encode_batch(obj, message);
+}
+template<> std::vector<CartesianAcceleration> decode(const std::string& msg) {
+  return decode_batch<CartesianAcceleration>(msg);
+}
+template<> bool decode(const std::string& msg, std::vector<CartesianAcceleration>& obj) {
+  return parse_and_decode(msg, obj);
+}
+template<> bool decode_message(const proto::StateMessage& message, std::vector<CartesianAcceleration>& obj) {
+  return decode_batch(message, obj);
+}
+template<> std::string encode<std::vector<CartesianWrench>>(const std::vector<CartesianWrench>& obj) {
+  return serialize_message(obj);
+}
+template<> void encode_message(const std::vector<CartesianWrench>& obj, proto::StateMessage& message) {
+  encode_batch(obj, message);
+}
+template<> std::vector<CartesianWrench> decode(const std::string& msg) {
+  return decode_batch<CartesianWrench>(msg);
+}
+template<> bool decode(const std::string& msg, std::vector<CartesianWrench>& obj) {
+  return parse_and_decode(msg, obj);
+}
+template<> bool decode_message(const proto::StateMessage& message, std::vector<CartesianWrench>& obj) {
+  return decode_batch(message, obj);
+}
+template<> std::string encode<std::vector<Jacobian>>(const std::vector<Jacobian>& obj) {
+  return serialize_message(obj);
+}
+template<> void encode_message(const std::vector<Jacobian>& obj, proto::StateMessage& message) {
+  encode_batch(obj, message);
+}
+template<> std::vector<Jacobian> decode(const std::string& msg) {
+  return decode_batch<Jacobian>(msg);
+}
+template<> bool decode(const std::string& msg, std::vector<Jacobian>& obj) {
+  return parse_and_decode(msg, obj);
+}
+template<> bool decode_message(const proto::StateMessage& message, std::vector<Jacobian>& obj) {
+  return decode_batch(message, obj);
+}
+template<> std::string encode<std::vector<JointState>>(const std::vector<JointState>& obj) {
+  return serialize_message(obj);
+}
+template<> void encode_message(const std::vector<JointState>& obj, proto::StateMessage& message) {
+  encode_batch(obj, message);
+}
+template<> std::vector<JointState> decode(const std::string& msg) {
+  return decode_batch<JointState>(msg);
+}
+template<> bool decode(const std::string& msg, std::vector<JointState>& obj) {
+  return parse_and_decode(msg, obj);
+}
+template<> bool decode_message(const proto::StateMessage& message, std::vector<JointState>& obj) {
+  return decode_batch(message, obj);
+}
+template<> std::string encode<std::vector<JointPositions>>(const std::vector<JointPositions>& obj) {
+  return serialize_message(obj);
+}
+template<> void encode_message(const std::vector<JointPositions>& obj, proto::StateMessage& message) {
+  encode_batch(obj, message);
+}
+template<> std::vector<JointPositions> decode(const std::string& msg) {
+  return decode_batch<JointPositions>(msg);
+}
+template<> bool decode(const std::string& msg, std::vector<JointPositions>& obj) {
+  return parse_and_decode(msg, obj);
+}
+template<> bool decode_message(const proto::StateMessage& message, std::vector<JointPositions>& obj) {
+  return decode_batch(message, obj);
+}
+template<> std::string encode<std::vector<JointVelocities>>(const std::vector<JointVelocities>& obj) {
+  return serialize_message(obj);
+}
+template<> void encode_message(const std::vector<JointVelocities>& obj, proto::StateMessage& message) {
+  encode_batch(obj, message);
+}
+template<> std::vector<JointVelocities> decode(const std::string& msg) {
+  return decode_batch<JointVelocities>(msg);
+}
+template<> bool decode(const std::string& msg, std::vector<JointVelocities>& obj) {
+  return parse_and_decode(msg, obj);
+}
+template<> bool decode_message(const proto::StateMessage& message, std::vector<JointVelocities>& obj) {
+  return decode_batch(message, obj);
+}
+template<> std::string encode<std::vector<JointAccelerations>>(const std::vector<JointAccelerations>& obj) {
+  return serialize_message(obj);
+}
+template<> void encode_message(const std::vector<JointAccelerations>& obj, proto::StateMessage& message) {
+  encode_batch(obj, message);
+}
+template<> std::vector<JointAccelerations> decode(const std::string& msg) {
+  return decode_batch<JointAccelerations>(msg);
+}
+template<> bool decode(const std::string& msg, std::vector<JointAccelerations>& obj) {
+  return parse_and_decode(msg, obj);
+}
+template<> bool decode_message(const proto::StateMessage& message, std::vector<JointAccelerations>& obj) {
+  return decode_batch(message, obj);
+}
+template<> std::string encode<std::vector<JointTorques>>(const std::vector<JointTorques>& obj) {
+  return serialize_message(obj);
+}
+template<> void encode_message(const std::vector<JointTorques>& obj, proto::StateMessage& message) {
+  encode_batch(obj, message);
+}
+template<> std::vector<JointTorques> decode(const std::string& msg) {
+  return decode_batch<JointTorques>(msg);
+}
+template<> bool decode(const std::string& msg, std::vector<JointTorques>& obj) {
+  return parse_and_decode(msg, obj);
+}
+template<> bool decode_message(const proto::StateMessage& message, std::vector<JointTorques>& obj) {
+  return decode_batch(message, obj);
+}
+template<> std::string encode<std::vector<Parameter<int>>>(const std::vector<Parameter<int>>& obj) {
+  return serialize_message(obj);
+}
+template<> void encode_message(const std::vector<Parameter<int>>& obj, proto::StateMessage& message) {
+  encode_batch(obj, message);
+}
+template<> std::vector<Parameter<int>> decode(const std::string& msg) {
+  return decode_batch<Parameter<int>>(msg);
+}
+template<> bool decode(const std::string& msg, std::vector<Parameter<int>>& obj) {
+  return parse_and_decode(msg, obj);
+}
+template<> bool decode_message(const proto::StateMessage& message, std::vector<Parameter<int>>& obj) {
+  return decode_batch(message, obj);
+}
+template<> std::string encode<std::vector<Parameter<std::vector<int>>>>(const std::vector<Parameter<std::vector<int>>>& obj) {
+  return serialize_message(obj);
+}
+template<> void encode_message(const std::vector<Parameter<std::vector<int>>>& obj, proto::StateMessage& message) {
+  encode_batch(obj, message);
+}
+template<> std::vector<Parameter<std::vector<int>>> decode(const std::string& msg) {
+  return decode_batch<Parameter<std::vector<int>>>(msg);
+}
+template<> bool decode(const std::string& msg, std::vector<Parameter<std::vector<int>>>& obj) {
+  return parse_and_decode(msg, obj);
+}
+template<> bool decode_message(const proto::StateMessage& message, std::vector<Parameter<std::vector<int>>>& obj) {
+  return decode_batch(message, obj);
+}
+template<> std::string encode<std::vector<Parameter<double>>>(const std::vector<Parameter<double>>& obj) {
+  return serialize_message(obj);
+}
+template<> void encode_message(const std::vector<Parameter<double>>& obj, proto::StateMessage& message) {
+  encode_batch(obj, message);
+}
+template<> std::vector<Parameter<double>> decode(const std::string& msg) {
+  return decode_batch<Parameter<double>>(msg);
+}
+template<> bool decode(const std::string& msg, std::vector<Parameter<double>>& obj) {
+  return parse_and_decode(msg, obj);
+}
+template<> bool decode_message(const proto::StateMessage& message, std::vector<Parameter<double>>& obj) {
+  return decode_batch(message, obj);
+}
+template<> std::string encode<std::vector<Parameter<std::vector<double>>>>(const std::vector<Parameter<std::vector<double>>>& obj) {
+  return serialize_message(obj);
+}
+template<> void encode_message(const std::vector<Parameter<std::vector<double>>>& obj, proto::StateMessage& message) {
+  encode_batch(obj, message);
+}
+template<> std::vector<Parameter<std::vector<double>>> decode(const std::string& msg) {
+  return decode_batch<Parameter<std::vector<double>>>(msg);
+}
+template<> bool decode(const std::string& msg, std::vector<Parameter<std::vector<double>>>& obj) {
+  return parse_and_decode(msg, obj);
+}
+template<> bool decode_message(const proto::StateMessage& message, std::vector<Parameter<std::vector<double>>>& obj) {
+  return decode_batch(message, obj);
+}
+template<> std::string encode<std::vector<Parameter<bool>>>(const std::vector<Parameter<bool>>& obj) {
+  return serialize_message(obj);
+}
+template<> void encode_message(const std::vector<Parameter<bool>>& obj, proto::StateMessage& message) {
+  encode_batch(obj, message);
+}
+template<> std::vector<Parameter<bool>> decode(const std::string& msg) {
+  return decode_batch<Parameter<bool>>(msg);
+}
+template<> bool decode(const std::string& msg, std::vector<Parameter<bool>>& obj) {
+  return parse_and_decode(msg, obj);
+}
+template<> bool decode_message(const proto::StateMessage& message, std::vector<Parameter<bool>>& obj) {
+  return decode_batch(message, obj);
+}
+template<> std::string encode<std::vector<Parameter<std::vector<bool>>>>(const std::vector<Parameter<std::vector<bool>>>& obj) {
+  return serialize_message(obj);
+}
+template<> void encode_message(const std::vector<Parameter<std::vector<bool>>>& obj, proto::StateMessage& message) {
+  encode_batch(obj, message);
+}
+template<> std::vector<Parameter<std::vector<bool>>> decode(const std::string& msg) {
+  return decode_batch<Parameter<std::vector<bool>>>(msg);
+}
+template<> bool decode(const std::string& msg, std::vector<Parameter<std::vector<bool>>>& obj) {
+  return parse_and_decode(msg, obj);
+}
+template<> bool decode_message(const proto::StateMessage& message, std::vector<Parameter<std::vector<bool>>>& obj) {
+  return decode_batch(message, obj);
+}
+template<> std::string encode<std::vector<Parameter<std::string>>>(const std::vector<Parameter<std::string>>& obj) {
+  return serialize_message(obj);
+}
+template<> void encode_message(const std::vector<Parameter<std::string>>& obj, proto::StateMessage& message) {
+  encode_batch(obj, message);
+}
+template<> std::vector<Parameter<std::string>> decode(const std::string& msg) {
+  return decode_batch<Parameter<std::string>>(msg);
+}
+template<> bool decode(const std::string& msg, std::vector<Parameter<std::string>>& obj) {
+  return parse_and_decode(msg, obj);
+}
+template<> bool decode_message(const proto::StateMessage& message, std::vector<Parameter<std::string>>& obj) {
+  return decode_batch(message, obj);
+}
+template<> std::string encode<std::vector<Parameter<std::vector<std::string>>>>(const std::vector<Parameter<std::vector<std::string>>>& obj) {
+  return serialize_message(obj);
+}
+template<> void encode_message(const std::vector<Parameter<std::vector<std::string>>>& obj, proto::StateMessage& message) {
+  encode_batch(obj, message);
+}
+template<> std::vector<Parameter<std::vector<std::string>>> decode(const std::string& msg) {
+  return decode_batch<Parameter<std::vector<std::string>>>(msg);
+}
+template<> bool decode(const std::string& msg, std::vector<Parameter<std::vector<std::string>>>& obj) {
+  return parse_and_decode(msg, obj);
+}
+template<> bool decode_message(const proto::StateMessage& message, std::vector<Parameter<std::vector<std::string>>>& obj) {
+  return decode_batch(message, obj);
+}
+template<> std::string encode<std::vector<Parameter<Eigen::VectorXd>>>(const std::vector<Parameter<Eigen::VectorXd>>& obj) {
+  return serialize_message(obj);
+}
+template<> void encode_message(const std::vector<Parameter<Eigen::VectorXd>>& obj, proto::StateMessage& message) {
+  encode_batch(obj, message);
+}
+template<> std::vector<Parameter<Eigen::VectorXd>> decode(const std::string& msg) {
+  return decode_batch<Parameter<Eigen::VectorXd>>(msg);
+}
+template<> bool decode(const std::string& msg, std::vector<Parameter<Eigen::VectorXd>>& obj) {
+  return parse_and_decode(msg, obj);
+}
+template<> bool decode_message(const proto::StateMessage& message, std::vector<Parameter<Eigen::VectorXd>>& obj) {
+  return decode_batch(message, obj);
+}
+template<> std::string encode<std::vector<Parameter<Eigen::MatrixXd>>>(const std::vector<Parameter<Eigen::MatrixXd>>& obj) {
+  return serialize_message(obj);
+}
+template<> void encode_message(const std::vector<Parameter<Eigen::MatrixXd>>& obj, proto::StateMessage& message) {
+  encode_batch(obj, message);
+}
+template<> std::vector<Parameter<Eigen::MatrixXd>> decode(const std::string& msg) {
+  return decode_batch<Parameter<Eigen::MatrixXd>>(msg);
+}
+template<> bool decode(const std::string& msg, std::vector<Parameter<Eigen::MatrixXd>>& obj) {
+  return parse_and_decode(msg, obj);
+}
+template<> bool decode_message(const proto::StateMessage& message, std::vector<Parameter<Eigen::MatrixXd>>& obj) {
+  return decode_batch(message, obj);
+}
+template<> std::string encode<std::vector<std::shared_ptr<State>>>(const std::vector<std::shared_ptr<State>>& obj) {
+  return serialize_message(obj);
+}
+template<> void encode_message(const std::vector<std::shared_ptr<State>>& obj, proto::StateMessage& message) {
+  encode_batch(obj, message);
+}
+template<> std::vector<std::shared_ptr<State>> decode(const std::string& msg) {
+  return decode_batch<std::shared_ptr<State>>(msg);
+}
+template<> bool decode(const std::string& msg, std::vector<std::shared_ptr<State>>& obj) {
+  return parse_and_decode(msg, obj);
+}
+template<> bool decode_message(const proto::StateMessage& message, std::vector<std::shared_ptr<State>>& obj) {
+  return decode_batch(message, obj);
+}
+
 // Generic template code for future types:
 /* ----------------------
  *        __TYPE__
  * ---------------------- */ /*
 template<> std::string encode<__TYPE__>(const __TYPE__& obj);
+template<> void encode_message(const __TYPE__& obj, proto::StateMessage& message);
 template<> __TYPE__ decode(const std::string& msg);
 template<> bool decode(const std::string& msg, __TYPE__& obj);
+template<> bool decode_message(const proto::StateMessage& message, __TYPE__& obj);
 template<> std::string encode<__TYPE__>(const __TYPE__& obj) {
-  proto::StateMessage message;
+  return serialize_message(obj);
+}
+template<> void encode_message(const __TYPE__& obj, proto::StateMessage& message) {
   // encode
-  return message.SerializeAsString();
 }
 template<> __TYPE__ decode(const std::string& msg) {
   __TYPE__ obj;
@@ -1428,9 +2608,11 @@ template<> __TYPE__ decode(const std::string& msg) {
   return obj;
 }
 template<> bool decode(const std::string& msg, __TYPE__& obj) {
+  return parse_and_decode(msg, obj);
+}
+template<> bool decode_message(const proto::StateMessage& message, __TYPE__& obj) {
   try {
-    proto::StateMessage message;
-    if (!(message.ParseFromString(msg) && message.message_type_case() == proto::StateMessage::MessageTypeCase::k__TYPE__)) {
+    if (message.message_type_case() != proto::StateMessage::MessageTypeCase::k__TYPE__) {
       return false;
     }
     // decode
@@ -1447,12 +2629,20 @@ template<> bool decode(const std::string& msg, __TYPE__& obj) {
 template<>
 std::string encode<Parameter<ParamT>>(const Parameter<ParamT>& obj);
 template<>
+void encode_message(const Parameter<ParamT>& obj, proto::StateMessage& message);
+template<>
 Parameter<ParamT> decode(const std::string& msg);
 template<>
 bool decode(const std::string& msg, Parameter<ParamT>& obj);
 template<>
+bool decode_message(const proto::StateMessage& message, Parameter<ParamT>& obj);
+template<>
 std::string encode<Parameter<ParamT>>(const Parameter<ParamT>& obj) {
-  return encode_parameter(obj);
+  return serialize_message(obj);
+}
+template<>
+void encode_message(const Parameter<ParamT>& obj, proto::StateMessage& message) {
+  encode_parameter(obj, message);
 }
 template<>
 Parameter<ParamT> decode(const std::string& msg) {
@@ -1460,8 +2650,177 @@ Parameter<ParamT> decode(const std::string& msg) {
 }
 template<>
 bool decode(const std::string& msg, Parameter<ParamT>& obj) {
-  return decode_parameter(msg, obj);
+  return parse_and_decode(msg, obj);
+}
+template<>
+bool decode_message(const proto::StateMessage& message, Parameter<ParamT>& obj) {
+  return decode_parameter(message, obj);
 }
 */
 
+/* ----------------------
+ *        Message
+ * ---------------------- */
+Message::Message() : valid_(false), message_(std::make_unique<proto::StateMessage>()) {}
+
+Message::Message(const std::string& msg) : Message() {
+  this->parse(msg);
+}
+
+Message::Message(Message&& message) noexcept = default;
+
+Message& Message::operator=(Message&& message) noexcept = default;
+
+Message::~Message() = default;
+
+bool Message::parse(const std::string& msg) {
+  this->valid_ = this->message_->ParseFromString(msg);
+  return this->valid_;
+}
+
+MessageType Message::get_type() const {
+  if (!this->valid_) {
+    return MessageType::UNKNOWN_MESSAGE;
+  }
+  return static_cast<MessageType>(this->message_->message_type_case());
+}
+
+ParameterMessageType Message::get_parameter_type() const {
+  if (!this->valid_ || !this->message_->has_parameter()) {
+    return ParameterMessageType::UNKNOWN_PARAMETER;
+  }
+  return static_cast<ParameterMessageType>(this->message_->parameter().parameter_value().value_type_case());
+}
+
+template<typename T>
+bool Message::decode(T& obj) const {
+  return this->valid_ && decode_message(*this->message_, obj);
+}
+
+template<typename T>
+T Message::decode() const {
+  T obj = empty_object<T>::make();
+  if (!this->decode(obj)) {
+    throw DecodingException("Could not decode the message into the desired type");
+  }
+  return obj;
+}
+
+template<>
+std::shared_ptr<State> Message::decode() const {
+  if (!this->valid_) {
+    throw DecodingException("Could not decode the message into a std::shared_ptr<State>");
+  }
+  // the state created with the type of the message is decoded in place, such that it is the only allocation
+  auto obj = create_shared_state(*this->message_);
+  if (!decode_shared_state_in_place(*this->message_, obj)) {
+    throw DecodingException("Could not decode the message into a std::shared_ptr<State>");
+  }
+  return obj;
+}
+
+template bool Message::decode(State&) const;
+template bool Message::decode(DigitalIOState&) const;
+template bool Message::decode(AnalogIOState&) const;
+template bool Message::decode(SpatialState&) const;
+template bool Message::decode(CartesianState&) const;
+template bool Message::decode(CartesianPose&) const;
+template bool Message::decode(CartesianTwist&) const;
+template bool Message::decode(CartesianAcceleration&) const;
+template bool Message::decode(CartesianWrench&) const;
+template bool Message::decode(Jacobian&) const;
+template bool Message::decode(JointState&) const;
+template bool Message::decode(JointPositions&) const;
+template bool Message::decode(JointVelocities&) const;
+template bool Message::decode(JointAccelerations&) const;
+template bool Message::decode(JointTorques&) const;
+template bool Message::decode(Parameter<int>&) const;
+template bool Message::decode(Parameter<std::vector<int>>&) const;
+template bool Message::decode(Parameter<double>&) const;
+template bool Message::decode(Parameter<std::vector<double>>&) const;
+template bool Message::decode(Parameter<bool>&) const;
+template bool Message::decode(Parameter<std::vector<bool>>&) const;
+template bool Message::decode(Parameter<std::string>&) const;
+template bool Message::decode(Parameter<std::vector<std::string>>&) const;
+template bool Message::decode(Parameter<Eigen::VectorXd>&) const;
+template bool Message::decode(Parameter<Eigen::MatrixXd>&) const;
+template bool Message::decode(std::shared_ptr<State>&) const;
+template bool Message::decode(std::vector<State>&) const;
+template bool Message::decode(std::vector<DigitalIOState>&) const;
+template bool Message::decode(std::vector<AnalogIOState>&) const;
+template bool Message::decode(std::vector<SpatialState>&) const;
+template bool Message::decode(std::vector<CartesianState>&) const;
+template bool Message::decode(std::vector<CartesianPose>&) const;
+template bool Message::decode(std::vector<CartesianTwist>&) const;
+template bool Message::decode(std::vector<CartesianAcceleration>&) const;
+template bool Message::decode(std::vector<CartesianWrench>&) const;
+template bool Message::decode(std::vector<Jacobian>&) const;
+template bool Message::decode(std::vector<JointState>&) const;
+template bool Message::decode(std::vector<JointPositions>&) const;
+template bool Message::decode(std::vector<JointVelocities>&) const;
+template bool Message::decode(std::vector<JointAccelerations>&) const;
+template bool Message::decode(std::vector<JointTorques>&) const;
+template bool Message::decode(std::vector<Parameter<int>>&) const;
+template bool Message::decode(std::vector<Parameter<std::vector<int>>>&) const;
+template bool Message::decode(std::vector<Parameter<double>>&) const;
+template bool Message::decode(std::vector<Parameter<std::vector<double>>>&) const;
+template bool Message::decode(std::vector<Parameter<bool>>&) const;
+template bool Message::decode(std::vector<Parameter<std::vector<bool>>>&) const;
+template bool Message::decode(std::vector<Parameter<std::string>>&) const;
+template bool Message::decode(std::vector<Parameter<std::vector<std::string>>>&) const;
+template bool Message::decode(std::vector<Parameter<Eigen::VectorXd>>&) const;
+template bool Message::decode(std::vector<Parameter<Eigen::MatrixXd>>&) const;
+template bool Message::decode(std::vector<std::shared_ptr<State>>&) const;
+
+template State Message::decode() const;
+template DigitalIOState Message::decode() const;
+template AnalogIOState Message::decode() const;
+template SpatialState Message::decode() const;
+template CartesianState Message::decode() const;
+template CartesianPose Message::decode() const;
+template CartesianTwist Message::decode() const;
+template CartesianAcceleration Message::decode() const;
+template CartesianWrench Message::decode() const;
+template Jacobian Message::decode() const;
+template JointState Message::decode() const;
+template JointPositions Message::decode() const;
+template JointVelocities Message::decode() const;
+template JointAccelerations Message::decode() const;
+template JointTorques Message::decode() const;
+template Parameter<int> Message::decode() const;
+template Parameter<std::vector<int>> Message::decode() const;
+template Parameter<double> Message::decode() const;
+template Parameter<std::vector<double>> Message::decode() const;
+template Parameter<bool> Message::decode() const;
+template Parameter<std::vector<bool>> Message::decode() const;
+template Parameter<std::string> Message::decode() const;
+template Parameter<std::vector<std::string>> Message::decode() const;
+template Parameter<Eigen::VectorXd> Message::decode() const;
+template Parameter<Eigen::MatrixXd> Message::decode() const;
+template std::vector<State> Message::decode() const;
+template std::vector<DigitalIOState> Message::decode() const;
+template std::vector<AnalogIOState> Message::decode() const;
+template std::vector<SpatialState> Message::decode() const;
+template std::vector<CartesianState> Message::decode() const;
+template std::vector<CartesianPose> Message::decode() const;
+template std::vector<CartesianTwist> Message::decode() const;
+template std::vector<CartesianAcceleration> Message::decode() const;
+template std::vector<CartesianWrench> Message::decode() const;
+template std::vector<Jacobian> Message::decode() const;
+template std::vector<JointState> Message::decode() const;
+template std::vector<JointPositions> Message::decode() const;
+template std::vector<JointVelocities> Message::decode() const;
+template std::vector<JointAccelerations> Message::decode() const;
+template std::vector<JointTorques> Message::decode() const;
+template std::vector<Parameter<int>> Message::decode() const;
+template std::vector<Parameter<std::vector<int>>> Message::decode() const;
+template std::vector<Parameter<double>> Message::decode() const;
+template std::vector<Parameter<std::vector<double>>> Message::decode() const;
+template std::vector<Parameter<bool>> Message::decode() const;
+template std::vector<Parameter<std::vector<bool>>> Message::decode() const;
+template std::vector<Parameter<std::string>> Message::decode() const;
+template std::vector<Parameter<std::vector<std::string>>> Message::decode() const;
+template std::vector<Parameter<Eigen::VectorXd>> Message::decode() const;
+template std::vector<Parameter<Eigen::MatrixXd>> Message::decode() const;
+template std::vector<std::shared_ptr<State>> Message::decode() const;
 }
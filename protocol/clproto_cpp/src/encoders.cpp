@@ -4,8 +4,8 @@ using namespace state_representation;
 
 namespace clproto {
 
-google::protobuf::RepeatedField<double> matrix_encoder(const Eigen::MatrixXd& matrix) {
-  return encoder(std::vector<double>{matrix.data(), matrix.data() + matrix.size()});
+google::protobuf::RepeatedField<double> matrix_encoder(const Eigen::Ref<const Eigen::MatrixXd>& matrix) {
+  return {matrix.data(), matrix.data() + matrix.size()};
 }
 
 proto::State encoder(const State& state) {
@@ -76,10 +76,10 @@ proto::JointState encoder(const JointState& joint_state) {
   if (joint_state.is_empty()) {
     return message;
   }
-  *message.mutable_positions() = matrix_encoder(joint_state.get_positions());
-  *message.mutable_velocities() = matrix_encoder(joint_state.get_velocities());
-  *message.mutable_accelerations() = matrix_encoder(joint_state.get_accelerations());
-  *message.mutable_torques() = matrix_encoder(joint_state.get_torques());
+  *message.mutable_positions() = matrix_encoder(joint_state.get_positions_view());
+  *message.mutable_velocities() = matrix_encoder(joint_state.get_velocities_view());
+  *message.mutable_accelerations() = matrix_encoder(joint_state.get_accelerations_view());
+  *message.mutable_torques() = matrix_encoder(joint_state.get_torques_view());
   return message;
 }
 
@@ -49,3 +49,27 @@ TEST(CartesianProtoTest, EncodeDecodeCartesian) {
   encode_decode_cartesian(CartesianAcceleration::Random("A", "B"), clproto::CARTESIAN_ACCELERATION_MESSAGE);
   encode_decode_cartesian(CartesianWrench::Random("A", "B"), clproto::CARTESIAN_WRENCH_MESSAGE);
 }
+
+template<typename T>
+static void decode_cartesian_in_place(const T& send_state) {
+  auto recv_state = T::Random("C", "D");
+  EXPECT_TRUE(clproto::decode(clproto::encode(send_state), recv_state));
+  test_cart_state_equal(send_state, recv_state);
+
+  auto new_state = T::Random(send_state.get_name(), send_state.get_reference_frame());
+  EXPECT_TRUE(clproto::decode(clproto::encode(new_state), recv_state));
+  test_cart_state_equal(new_state, recv_state);
+
+  new_state.reset();
+  EXPECT_TRUE(clproto::decode(clproto::encode(new_state), recv_state));
+  EXPECT_TRUE(recv_state.is_empty());
+  test_cart_state_equal(new_state, recv_state);
+}
+
+TEST(CartesianProtoTest, DecodeCartesianInPlace) {
+  decode_cartesian_in_place(CartesianState::Random("A", "B"));
+  decode_cartesian_in_place(CartesianPose::Random("A", "B"));
+  decode_cartesian_in_place(CartesianTwist::Random("A", "B"));
+  decode_cartesian_in_place(CartesianAcceleration::Random("A", "B"));
+  decode_cartesian_in_place(CartesianWrench::Random("A", "B"));
+}
@@ -62,3 +62,33 @@ TEST(JointProtoTest, EncodeDecodeJacobian) {
   send_state.reset();
   clproto::test_encode_decode<Jacobian>(send_state, clproto::JACOBIAN_MESSAGE, test_jacobian_equal);
 }
+
+template<typename T>
+static void decode_joint_in_place(const std::vector<std::string>& joint_names) {
+  auto send_state = T::Random("robot", joint_names);
+  auto recv_state = T::Random("other_robot", joint_names);
+  EXPECT_TRUE(clproto::decode(clproto::encode(send_state), recv_state));
+  test_joint_state_equal(send_state, recv_state);
+
+  send_state = T::Random("robot", {"four", "five", "six"});
+  EXPECT_TRUE(clproto::decode(clproto::encode(send_state), recv_state));
+  test_joint_state_equal(send_state, recv_state);
+
+  send_state = T::Random("robot", {"one", "two"});
+  EXPECT_TRUE(clproto::decode(clproto::encode(send_state), recv_state));
+  test_joint_state_equal(send_state, recv_state);
+
+  send_state.reset();
+  EXPECT_TRUE(clproto::decode(clproto::encode(send_state), recv_state));
+  EXPECT_TRUE(recv_state.is_empty());
+  test_joint_state_equal(send_state, recv_state);
+}
+
+TEST(JointProtoTest, DecodeJointInPlace) {
+  std::vector<std::string> joint_names = {"one", "two", "three"};
+  decode_joint_in_place<JointState>(joint_names);
+  decode_joint_in_place<JointPositions>(joint_names);
+  decode_joint_in_place<JointVelocities>(joint_names);
+  decode_joint_in_place<JointAccelerations>(joint_names);
+  decode_joint_in_place<JointTorques>(joint_names);
+}
@@ -6,12 +6,44 @@
 #include <state_representation/geometry/Ellipsoid.hpp>
 #include <state_representation/space/cartesian/CartesianState.hpp>
 #include <state_representation/space/cartesian/CartesianPose.hpp>
+#include <state_representation/space/joint/JointPositions.hpp>
+#include <state_representation/parameters/Parameter.hpp>
 
 #include "clproto.hpp"
 #include "test_encode_decode.hpp"
 
+#include <cstdlib>
+#include <new>
+
 using namespace state_representation;
 
+// the allocations of the test program are counted to check that the decoding of shared states allocates them once
+static std::size_t allocation_count = 0;
+
+// the replacements are not inlined, such that the compiler does not pair the calls to malloc and free with the new and
+// delete expressions of the test
+#if defined(__GNUC__)
+#define NOINLINE __attribute__((noinline))
+#else
+#define NOINLINE
+#endif
+
+NOINLINE void* operator new(std::size_t size) {
+  ++allocation_count;
+  if (void* pointer = std::malloc(size == 0 ? 1 : size)) {
+    return pointer;
+  }
+  throw std::bad_alloc();
+}
+
+NOINLINE void operator delete(void* pointer) noexcept {
+  std::free(pointer);
+}
+
+NOINLINE void operator delete(void* pointer, std::size_t) noexcept {
+  std::free(pointer);
+}
+
 template<class IOT>
 static void test_io_equal(const IOT& send_state, const IOT& recv_state) {
   EXPECT_EQ(send_state.get_type(), recv_state.get_type());
@@ -89,6 +121,195 @@ TEST(MessageProtoTest, EncodeDecodeRandomIO) {
       digital_state, clproto::DIGITAL_IO_STATE_MESSAGE, test_io_equal<DigitalIOState>);
 }
 
+TEST(MessageProtoTest, DispatchParsedMessage) {
+  auto pose = CartesianPose::Random("A", "B");
+  auto positions = JointPositions::Random("robot", 3);
+  auto param = Parameter<double>("param", 1.5);
+  std::vector<std::string> messages = {clproto::encode(pose), clproto::encode(positions), clproto::encode(param)};
+
+  clproto::Message message;
+  EXPECT_EQ(message.get_type(), clproto::UNKNOWN_MESSAGE);
+
+  ASSERT_TRUE(message.parse(messages.at(0)));
+  EXPECT_EQ(message.get_type(), clproto::CARTESIAN_POSE_MESSAGE);
+  EXPECT_EQ(message.get_parameter_type(), clproto::UNKNOWN_PARAMETER);
+  CartesianPose recv_pose;
+  EXPECT_TRUE(message.decode(recv_pose));
+  EXPECT_TRUE(recv_pose.data().isApprox(pose.data()));
+  EXPECT_FALSE(message.decode(positions));
+  EXPECT_THROW(message.decode<JointPositions>(), clproto::DecodingException);
+
+  ASSERT_TRUE(message.parse(messages.at(1)));
+  EXPECT_EQ(message.get_type(), clproto::JOINT_POSITIONS_MESSAGE);
+  auto recv_positions = message.decode<JointPositions>();
+  EXPECT_EQ(recv_positions.get_names(), positions.get_names());
+  EXPECT_TRUE(recv_positions.data().isApprox(positions.data()));
+
+  ASSERT_TRUE(message.parse(messages.at(2)));
+  EXPECT_EQ(message.get_type(), clproto::PARAMETER_MESSAGE);
+  EXPECT_EQ(message.get_parameter_type(), clproto::ParameterMessageType::DOUBLE);
+  auto recv_param = message.decode<Parameter<double>>();
+  EXPECT_EQ(recv_param.get_name(), param.get_name());
+  EXPECT_EQ(recv_param.get_value(), param.get_value());
+}
+
+TEST(MessageProtoTest, DispatchParsedMessageSharedState) {
+  auto pose = CartesianPose::Random("A", "B");
+  clproto::Message message(clproto::encode(pose));
+
+  auto recv_ptr = message.decode<std::shared_ptr<State>>();
+  ASSERT_EQ(recv_ptr->get_type(), StateType::CARTESIAN_POSE);
+  EXPECT_TRUE(std::dynamic_pointer_cast<CartesianPose>(recv_ptr)->data().isApprox(pose.data()));
+
+  std::shared_ptr<State> joint_ptr = make_shared_state(JointPositions());
+  EXPECT_FALSE(message.decode(joint_ptr));
+  EXPECT_EQ(joint_ptr->get_type(), StateType::JOINT_POSITIONS);
+
+  // the state created with the type of the message is the one returned, decoding allocates as much as creating a state
+  // and decoding the message into an existing state
+  auto allocations = allocation_count;
+  {
+    auto created = make_shared_state(CartesianPose());
+    CartesianPose decoded;
+    ASSERT_TRUE(message.decode(decoded));
+  }
+  auto expected_allocations = allocation_count - allocations;
+  allocations = allocation_count;
+  recv_ptr = message.decode<std::shared_ptr<State>>();
+  EXPECT_EQ(allocation_count - allocations, expected_allocations);
+
+  message.parse(clproto::encode(Parameter<int>("int", 2)));
+  auto param_ptr = message.decode<std::shared_ptr<State>>();
+  ASSERT_EQ(param_ptr->get_type(), StateType::PARAMETER);
+  EXPECT_EQ(std::dynamic_pointer_cast<Parameter<int>>(param_ptr)->get_value(), 2);
+}
+
+TEST(MessageProtoTest, DispatchInvalidString) {
+  clproto::Message message(clproto::encode(State("A")));
+  EXPECT_EQ(message.get_type(), clproto::STATE_MESSAGE);
+
+  EXPECT_FALSE(message.parse("hello world"));
+  EXPECT_EQ(message.get_type(), clproto::UNKNOWN_MESSAGE);
+  EXPECT_EQ(message.get_parameter_type(), clproto::UNKNOWN_PARAMETER);
+  State obj;
+  EXPECT_FALSE(message.decode(obj));
+  EXPECT_THROW(message.decode<State>(), clproto::DecodingException);
+  EXPECT_THROW(message.decode<std::shared_ptr<State>>(), clproto::DecodingException);
+}
+
+TEST(MessageProtoTest, EncodeDecodeBatch) {
+  std::vector<CartesianPose> poses;
+  for (int i = 0; i < 50; ++i) {
+    poses.emplace_back(CartesianPose::Random("frame_" + std::to_string(i), "world"));
+  }
+  std::string msg = clproto::encode(poses);
+  EXPECT_EQ(clproto::check_message_type(msg), clproto::BATCH_MESSAGE);
+
+  auto recv_poses = clproto::decode<std::vector<CartesianPose>>(msg);
+  ASSERT_EQ(recv_poses.size(), poses.size());
+  for (std::size_t i = 0; i < poses.size(); ++i) {
+    EXPECT_EQ(recv_poses.at(i).get_name(), poses.at(i).get_name());
+    EXPECT_EQ(recv_poses.at(i).get_reference_frame(), poses.at(i).get_reference_frame());
+    EXPECT_TRUE(recv_poses.at(i).data().isApprox(poses.at(i).data()));
+  }
+
+  poses.resize(10);
+  recv_poses.at(0) = CartesianPose("A", "B");
+  EXPECT_TRUE(clproto::decode(clproto::encode(poses), recv_poses));
+  ASSERT_EQ(recv_poses.size(), 10);
+  EXPECT_EQ(recv_poses.at(0).get_name(), poses.at(0).get_name());
+  EXPECT_TRUE(recv_poses.at(0).data().isApprox(poses.at(0).data()));
+
+  EXPECT_TRUE(clproto::decode(clproto::encode(std::vector<CartesianPose>()), recv_poses));
+  EXPECT_TRUE(recv_poses.empty());
+
+  // the existing elements are decoded in place and keep their buffers
+  std::vector<JointPositions> positions = {JointPositions::Random("robot", 3), JointPositions::Random("robot", 3)};
+  std::vector<JointPositions> recv_positions_in_place = {JointPositions::Zero("robot", 3)};
+  const double* buffer = recv_positions_in_place.front().get_variable_map(JointStateVariable::POSITIONS).data();
+  recv_positions_in_place.reserve(2);
+  EXPECT_TRUE(clproto::decode(clproto::encode(positions), recv_positions_in_place));
+  ASSERT_EQ(recv_positions_in_place.size(), 2);
+  EXPECT_EQ(recv_positions_in_place.front().get_variable_map(JointStateVariable::POSITIONS).data(), buffer);
+  EXPECT_TRUE(recv_positions_in_place.front().data().isApprox(positions.front().data()));
+  EXPECT_TRUE(recv_positions_in_place.back().data().isApprox(positions.back().data()));
+
+  std::vector<JointPositions> recv_positions;
+  EXPECT_FALSE(clproto::decode(msg, recv_positions));
+  EXPECT_THROW(clproto::decode<std::vector<CartesianPose>>(clproto::encode(poses.front())), clproto::DecodingException);
+  EXPECT_FALSE(clproto::decode(clproto::encode(poses.front()), recv_poses));
+
+  // a batch with an element that cannot be decoded leaves the vector unmodified
+  recv_poses = {CartesianPose::Random("A", "B"), CartesianPose::Random("C", "D")};
+  auto expected_poses = recv_poses;
+  std::vector<std::shared_ptr<State>> mixed_states = {
+      make_shared_state(CartesianPose::Random("E", "F")), make_shared_state(CartesianPose::Random("G", "H")),
+      make_shared_state(JointPositions::Random("robot", 3))
+  };
+  EXPECT_FALSE(clproto::decode(clproto::encode(mixed_states), recv_poses));
+  ASSERT_EQ(recv_poses.size(), expected_poses.size());
+  for (std::size_t i = 0; i < expected_poses.size(); ++i) {
+    EXPECT_EQ(recv_poses.at(i).get_name(), expected_poses.at(i).get_name());
+    EXPECT_TRUE(recv_poses.at(i).data().isApprox(expected_poses.at(i).data()));
+  }
+}
+
+TEST(MessageProtoTest, EncodeDecodeBatchSharedState) {
+  std::vector<std::shared_ptr<State>> states = {
+      make_shared_state(CartesianPose::Random("A", "B")), make_shared_state(JointPositions::Random("robot", 3)),
+      make_shared_state(Parameter<double>("param", 1.5))
+  };
+  std::string msg = clproto::encode(states);
+
+  auto recv_states = clproto::decode<std::vector<std::shared_ptr<State>>>(msg);
+  ASSERT_EQ(recv_states.size(), states.size());
+  for (std::size_t i = 0; i < states.size(); ++i) {
+    EXPECT_EQ(recv_states.at(i)->get_type(), states.at(i)->get_type());
+    EXPECT_EQ(recv_states.at(i)->get_name(), states.at(i)->get_name());
+  }
+  EXPECT_TRUE(std::dynamic_pointer_cast<JointPositions>(recv_states.at(1))->data().isApprox(
+      std::dynamic_pointer_cast<JointPositions>(states.at(1))->data()));
+  EXPECT_EQ(std::dynamic_pointer_cast<Parameter<double>>(recv_states.at(2))->get_value(), 1.5);
+
+  clproto::Message message(msg);
+  ASSERT_EQ(message.get_type(), clproto::BATCH_MESSAGE);
+  EXPECT_EQ(message.decode<std::vector<std::shared_ptr<State>>>().size(), states.size());
+
+  // the states of the elements are reused if they have the type of their message, and replaced otherwise
+  auto reused_pose = std::make_shared<CartesianPose>("C", "D");
+  auto replaced_twist = make_shared_state(CartesianTwist("robot"));
+  auto reused_parameter = std::make_shared<Parameter<double>>("other", 0.5);
+  recv_states = {reused_pose, replaced_twist, reused_parameter};
+  EXPECT_TRUE(clproto::decode(msg, recv_states));
+  ASSERT_EQ(recv_states.size(), states.size());
+  EXPECT_EQ(recv_states.at(0).get(), reused_pose.get());
+  EXPECT_EQ(reused_pose->get_name(), "A");
+  EXPECT_TRUE(reused_pose->data().isApprox(std::dynamic_pointer_cast<CartesianPose>(states.at(0))->data()));
+  EXPECT_NE(recv_states.at(1), replaced_twist);
+  EXPECT_EQ(recv_states.at(1)->get_type(), StateType::JOINT_POSITIONS);
+  EXPECT_EQ(replaced_twist->get_name(), "robot");
+  EXPECT_EQ(recv_states.at(2).get(), reused_parameter.get());
+  EXPECT_EQ(reused_parameter->get_value(), 1.5);
+
+  // a parameter of another value type is replaced
+  auto replaced_parameter = make_shared_state(Parameter<int>("param", 1));
+  recv_states.at(2) = replaced_parameter;
+  EXPECT_TRUE(clproto::decode(msg, recv_states));
+  EXPECT_NE(recv_states.at(2), replaced_parameter);
+  EXPECT_EQ(std::dynamic_pointer_cast<Parameter<double>>(recv_states.at(2))->get_value(), 1.5);
+
+  // the elements of the vector are unmodified if an element cannot be decoded, here an empty message appended to the
+  // batch by concatenating its serialized field
+  auto previous_states = recv_states;
+  std::string invalid_msg = msg + std::string("\x9a\x01\x02\x0a\x00", 5);
+  EXPECT_EQ(clproto::check_message_type(invalid_msg), clproto::BATCH_MESSAGE);
+  reused_pose->set_name("X");
+  EXPECT_FALSE(clproto::decode(invalid_msg, recv_states));
+  EXPECT_EQ(recv_states, previous_states);
+  // nor are the reused states of the elements preceding it
+  EXPECT_EQ(reused_pose->get_name(), "X");
+}
+
 /* If an encode / decode template is invoked that is not implemented in clproto,
  * there will be a linker error "undefined reference" at compile time.
  * Of course, it's not really possible to test this at run-time.
@@ -2,25 +2,26 @@
 
 #include "state_representation_bindings.hpp"
 
+#include <variant>
+
 #include <state_representation/State.hpp>
 #include <state_representation/geometry/Ellipsoid.hpp>
 #include <state_representation/parameters/Parameter.hpp>
+#include <state_representation/space/cartesian/CartesianPose.hpp>
+#include <state_representation/space/cartesian/CartesianState.hpp>
+#include <state_representation/space/joint/JointPositions.hpp>
+#include <state_representation/space/joint/JointState.hpp>
 
 namespace py_parameter {
 
-struct ParameterValues {
-  int int_value = int();
-  std::vector<int> int_array_value = std::vector<int>();
-  double double_value = double();
-  std::vector<double> double_array_value = std::vector<double>();
-  bool bool_value = bool();
-  std::vector<bool> bool_array_value= std::vector<bool>();
-  std::string string_value = std::string();
-  std::vector<std::string> string_array_value = std::vector<std::string>();
-  std::shared_ptr<State> state_pointer;
-  Eigen::MatrixXd matrix_value = Eigen::MatrixXd();
-  Eigen::VectorXd vector_value = Eigen::VectorXd();
-};
+/**
+ * @typedef ParameterValue
+ * @brief Typed storage of a parameter value, holding one alternative per supported parameter and state type
+ */
+typedef std::variant<
+    int, std::vector<int>, double, std::vector<double>, bool, std::vector<bool>, std::string, std::vector<std::string>,
+    CartesianState, CartesianPose, JointState, JointPositions, Ellipsoid, Eigen::MatrixXd, Eigen::VectorXd
+> ParameterValue;
 
 class ParameterContainer : public ParameterInterface {
 public:
@@ -31,15 +32,31 @@ public:
       const std::string& name, const py::object& value, const ParameterType& type,
       const StateType& parameter_state_type = StateType::NONE
   );
-  ParameterContainer(const ParameterContainer& parameter);
+  ParameterContainer(const ParameterContainer& parameter) = default;
+
+  /**
+   * @brief Construct a container holding a copy of the value of a parameter, without conversion to Python objects.
+   * @param parameter The parameter to copy
+   */
+  explicit ParameterContainer(const std::shared_ptr<ParameterInterface>& parameter);
 
-  void set_value(py::object value);
+  void set_value(const py::object& value);
 
   py::object get_value() const;
 
   void reset();
 
-  ParameterValues values;
+  /**
+   * @brief Create a parameter holding a copy of the value of the container, without conversion to Python objects.
+   * @return A ParameterInterface pointer holding a Parameter of the stored type
+   */
+  std::shared_ptr<ParameterInterface> to_interface_ptr() const;
+
+  /**
+   * @brief The value of the parameter. The alternative is selected on construction from the parameter type
+   * and the parameter state type and never changes afterwards.
+   */
+  ParameterValue values;
 };
 
 ParameterContainer interface_ptr_to_container(const std::shared_ptr<ParameterInterface>& parameter);
@@ -51,7 +68,7 @@ inline Parameter<T> container_to_parameter(const ParameterContainer& container)
   if (container.is_empty()) {
     return Parameter<T>(container.get_name());
   } else {
-    return *container_to_interface_ptr(container)->get_parameter<T>();
+    return *container.to_interface_ptr()->get_parameter<T>();
   }
 }
 
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <stdexcept>
+#include <string>
+
+#include <pybind11/pybind11.h>
+#include <pybind11/eigen.h>
+#include <pybind11/numpy.h>
+
+#include <eigen3/Eigen/Core>
+
+namespace py = pybind11;
+
+/**
+ * @typedef RowMatrixXd
+ * @brief Row major dynamic matrix, matching the memory layout of a C-contiguous NumPy array
+ * so that a batch with one sample per row can be passed without copy
+ */
+using RowMatrixXd = Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+
+/**
+ * @brief Evaluate a function of two states on batches of state data.
+ * @details For each row, the rows of the batches are set as the data of copies of the template states,
+ * the function is evaluated on them and the data of the returned state is written to the same row of the result.
+ * The GIL is released during the evaluation.
+ * @tparam S The state type
+ * @tparam F The function type, taking two states and returning a state
+ * @param first_state The template of the first state, providing its name, reference frame or joint names
+ * @param first_data The batch of data of the first state with one sample per row
+ * @param second_state The template of the second state, providing its name, reference frame or joint names
+ * @param second_data The batch of data of the second state with one sample per row
+ * @param function The function to evaluate
+ * @return The batch of data of the returned states with one sample per row
+ */
+template<class S, typename F>
+RowMatrixXd evaluate_state_batch(
+    const S& first_state, const Eigen::Ref<const RowMatrixXd>& first_data, const S& second_state,
+    const Eigen::Ref<const RowMatrixXd>& second_data, const F& function
+) {
+  if (first_data.rows() != second_data.rows()) {
+    throw std::invalid_argument(
+        "The batches have different numbers of samples: " + std::to_string(first_data.rows()) + " and "
+            + std::to_string(second_data.rows()));
+  }
+  py::gil_scoped_release release;
+  S first(first_state);
+  S second(second_state);
+  Eigen::VectorXd first_row(first_data.cols());
+  Eigen::VectorXd second_row(second_data.cols());
+  RowMatrixXd result;
+  for (Eigen::Index i = 0; i < first_data.rows(); ++i) {
+    first_row = first_data.row(i).transpose();
+    second_row = second_data.row(i).transpose();
+    first.set_data(first_row);
+    second.set_data(second_row);
+    auto output = function(first, second).data();
+    if (i == 0) {
+      result.resize(first_data.rows(), output.size());
+    }
+    result.row(i) = output.transpose();
+  }
+  return result;
+}
+
+/**
+ * @brief Evaluate a function of a state on a batch of state data.
+ * @details For each row, the row of the batch is set as the data of a copy of the template state,
+ * the function is evaluated on it and the data of the returned state is written to the same row of the result.
+ * The GIL is released during the evaluation.
+ * @tparam S The state type
+ * @tparam F The function type, taking a state and returning a state
+ * @param state The template state, providing its name, reference frame or joint names
+ * @param data The batch of state data with one sample per row
+ * @param function The function to evaluate
+ * @return The batch of data of the returned states with one sample per row
+ */
+template<class S, typename F>
+RowMatrixXd evaluate_state_batch(const S& state, const Eigen::Ref<const RowMatrixXd>& data, const F& function) {
+  py::gil_scoped_release release;
+  S current(state);
+  Eigen::VectorXd row(data.cols());
+  RowMatrixXd result;
+  for (Eigen::Index i = 0; i < data.rows(); ++i) {
+    row = data.row(i).transpose();
+    current.set_data(row);
+    auto output = function(current).data();
+    if (i == 0) {
+      result.resize(data.rows(), output.size());
+    }
+    result.row(i) = output.transpose();
+  }
+  return result;
+}
@@ -8,6 +8,7 @@
 #include <pybind11/pybind11.h>
 #include <pybind11/chrono.h>
 #include <pybind11/eigen.h>
+#include <pybind11/numpy.h>
 #include <pybind11/operators.h>
 #include <pybind11/stl.h>
 
@@ -19,6 +20,28 @@ namespace py = pybind11;
 using namespace pybind11::literals;
 using namespace state_representation;
 
+/**
+ * @brief Create a writable NumPy array viewing the storage of a state variable without copying it.
+ * @details The array holds a reference to the Python state object, which is kept alive as long
+ * as the array exists, but does not own the memory of the state variable. The storage of a fixed
+ * size variable is never reallocated during the lifetime of the state object. The storage of a
+ * joint state variable is only reallocated when the number of joints of the state changes, which
+ * no method of the Python API does in place: the array is invalidated only if C++ code assigns a
+ * state with another number of joints to the object or decodes a message of another size into it.
+ * Writing through the array bypasses the setters of the state: the timestamp is not reset and the
+ * state must already be filled, otherwise the getter of the variable throws.
+ * @param data The state variable to view, as returned by the const getter or view of the state
+ * @param owner The Python state object owning the state variable
+ * @return A one dimensional NumPy array sharing the memory of the state variable
+ */
+template<typename VectorT>
+py::array_t<double> state_variable_view(const VectorT& data, const py::object& owner) {
+  return py::array_t<double>(
+      {static_cast<py::ssize_t>(data.size())}, {static_cast<py::ssize_t>(sizeof(double))},
+      data.data(), owner
+  );
+}
+
 void bind_exceptions(py::module_& m);
 void bind_state(py::module_& m);
 void bind_cartesian_space(py::module_& m);
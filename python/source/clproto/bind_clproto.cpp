@@ -26,7 +26,22 @@ using namespace py_parameter;
 
 template<typename T>
 inline py::bytes encode_bytes(const T& object) {
-  return py::bytes(encode(object));
+  std::string msg;
+  {
+    py::gil_scoped_release release;
+    msg = encode(object);
+  }
+  return py::bytes(msg);
+}
+
+template<typename T>
+inline py::object decode_object(const Message& message) {
+  T object;
+  {
+    py::gil_scoped_release release;
+    object = message.decode<T>();
+  }
+  return py::cast(std::move(object));
 }
 
 py::bytes encode_parameter_container(const ParameterContainer& container) {
@@ -58,9 +73,13 @@ py::bytes encode_parameter_container(const ParameterContainer& container) {
 }
 
 template<typename T>
-inline py::object message_to_parameter(const std::string& msg) {
+inline py::object message_to_parameter(const Message& message) {
   py::object PyParameter = py::module_::import("state_representation").attr("Parameter");
-  auto param = decode<Parameter<T>>(msg);
+  Parameter<T> param("");
+  {
+    py::gil_scoped_release release;
+    param = message.decode<Parameter<T>>();
+  }
   if (param.is_empty()) {
     return PyParameter(param.get_name(), param.get_parameter_type());
   } else {
@@ -68,37 +87,37 @@ inline py::object message_to_parameter(const std::string& msg) {
   }
 }
 
-py::object decode_parameter(const std::string& msg) {
-  switch (check_parameter_message_type(msg)) {
+py::object decode_parameter(const Message& message) {
+  switch (message.get_parameter_type()) {
     case ParameterMessageType::INT: {
-      return message_to_parameter<int>(msg);
+      return message_to_parameter<int>(message);
     }
     case ParameterMessageType::INT_ARRAY: {
-      return message_to_parameter<std::vector<int>>(msg);
+      return message_to_parameter<std::vector<int>>(message);
     }
     case ParameterMessageType::DOUBLE: {
-      return message_to_parameter<double>(msg);
+      return message_to_parameter<double>(message);
     }
     case ParameterMessageType::DOUBLE_ARRAY: {
-      return message_to_parameter<std::vector<double>>(msg);
+      return message_to_parameter<std::vector<double>>(message);
     }
     case ParameterMessageType::BOOL: {
-      return message_to_parameter<bool>(msg);
+      return message_to_parameter<bool>(message);
     }
     case ParameterMessageType::BOOL_ARRAY: {
-      return message_to_parameter<std::vector<bool>>(msg);
+      return message_to_parameter<std::vector<bool>>(message);
     }
     case ParameterMessageType::STRING: {
-      return message_to_parameter<std::string>(msg);
+      return message_to_parameter<std::string>(message);
     }
     case ParameterMessageType::STRING_ARRAY: {
-      return message_to_parameter<std::vector<std::string>>(msg);
+      return message_to_parameter<std::vector<std::string>>(message);
     }
     case ParameterMessageType::VECTOR: {
-      return message_to_parameter<Eigen::VectorXd>(msg);
+      return message_to_parameter<Eigen::VectorXd>(message);
     }
     case ParameterMessageType::MATRIX: {
-      return message_to_parameter<Eigen::MatrixXd>(msg);
+      return message_to_parameter<Eigen::MatrixXd>(message);
     }
     default:
       throw std::invalid_argument("The message is not a valid encoded Parameter.");
@@ -143,6 +162,7 @@ void message_type(py::module_& m) {
       .value("PARAMETER_MESSAGE", MessageType::PARAMETER_MESSAGE)
       .value("DIGITAL_IO_STATE_MESSAGE", MessageType::DIGITAL_IO_STATE_MESSAGE)
       .value("ANALOG_IO_STATE_MESSAGE", MessageType::ANALOG_IO_STATE_MESSAGE)
+      .value("BATCH_MESSAGE", MessageType::BATCH_MESSAGE)
       .export_values();
 }
 
@@ -213,39 +233,44 @@ void methods(py::module_& m) {
 
   m.def("decode", [](const std::string& msg) -> py::object {
     try{
-      switch (check_message_type(msg)) {
+      Message message;
+      {
+        py::gil_scoped_release release;
+        message.parse(msg);
+      }
+      switch (message.get_type()) {
         case MessageType::STATE_MESSAGE:
-          return py::cast(decode<State>(msg));
+          return decode_object<State>(message);
         case MessageType::DIGITAL_IO_STATE_MESSAGE:
-          return py::cast(decode<DigitalIOState>(msg));
+          return decode_object<DigitalIOState>(message);
         case MessageType::ANALOG_IO_STATE_MESSAGE:
-          return py::cast(decode<AnalogIOState>(msg));
+          return decode_object<AnalogIOState>(message);
         case MessageType::SPATIAL_STATE_MESSAGE:
-          return py::cast(decode<SpatialState>(msg));
+          return decode_object<SpatialState>(message);
         case MessageType::CARTESIAN_STATE_MESSAGE:
-          return py::cast<CartesianState>(decode<CartesianState>(msg));
+          return decode_object<CartesianState>(message);
         case MessageType::CARTESIAN_POSE_MESSAGE:
-          return py::cast(decode<CartesianPose>(msg));
+          return decode_object<CartesianPose>(message);
         case MessageType::CARTESIAN_TWIST_MESSAGE:
-          return py::cast(decode<CartesianTwist>(msg));
+          return decode_object<CartesianTwist>(message);
         case MessageType::CARTESIAN_ACCELERATION_MESSAGE:
-          return py::cast(decode<CartesianAcceleration>(msg));
+          return decode_object<CartesianAcceleration>(message);
         case MessageType::CARTESIAN_WRENCH_MESSAGE:
-          return py::cast(decode<CartesianWrench>(msg));
+          return decode_object<CartesianWrench>(message);
         case MessageType::JACOBIAN_MESSAGE:
-          return py::cast(decode<Jacobian>(msg));
+          return decode_object<Jacobian>(message);
         case MessageType::JOINT_STATE_MESSAGE:
-          return py::cast(decode<JointState>(msg));
+          return decode_object<JointState>(message);
         case MessageType::JOINT_POSITIONS_MESSAGE:
-          return py::cast(decode<JointPositions>(msg));
+          return decode_object<JointPositions>(message);
         case MessageType::JOINT_VELOCITIES_MESSAGE:
-          return py::cast(decode<JointVelocities>(msg));
+          return decode_object<JointVelocities>(message);
         case MessageType::JOINT_ACCELERATIONS_MESSAGE:
-          return py::cast(decode<JointAccelerations>(msg));
+          return decode_object<JointAccelerations>(message);
         case MessageType::JOINT_TORQUES_MESSAGE:
-          return py::cast(decode<JointTorques>(msg));
+          return decode_object<JointTorques>(message);
         case MessageType::PARAMETER_MESSAGE:
-          return decode_parameter(msg);
+          return decode_parameter(message);
         default:
           throw std::invalid_argument("Decoding not possible: Unknown or unsupported message type");
       }
@@ -1,5 +1,7 @@
 #include "parameter_container.hpp"
 
+#include <type_traits>
+
 #include <state_representation/exceptions/InvalidCastException.hpp>
 #include <state_representation/exceptions/InvalidParameterException.hpp>
 #include <state_representation/space/cartesian/CartesianState.hpp>
@@ -10,104 +12,95 @@
 
 namespace py_parameter {
 
-ParameterContainer::ParameterContainer(
-    const std::string& name, const ParameterType& type, const StateType& parameter_state_type
-) : ParameterInterface(name, type, parameter_state_type) {
-  if (type == ParameterType::STATE) {
-    switch (parameter_state_type) {
-      case StateType::CARTESIAN_STATE:
-        values.state_pointer = std::make_shared<CartesianState>();
-        break;
-      case StateType::CARTESIAN_POSE:
-        values.state_pointer = std::make_shared<CartesianPose>();
-        break;
-      case StateType::JOINT_STATE:
-        values.state_pointer = std::make_shared<JointState>();
-        break;
-      case StateType::JOINT_POSITIONS:
-        values.state_pointer = std::make_shared<JointPositions>();
-        break;
-      case StateType::GEOMETRY_ELLIPSOID:
-        values.state_pointer = std::make_shared<Ellipsoid>();
-        break;
-      default:
-        throw exceptions::InvalidParameterException(
-            "The desired StateType for parameter '" + this->get_name() + "' is not supported");
-    }
+/**
+ * @brief Create the default value of the alternative matching a parameter type and parameter state type.
+ * @param name The name of the parameter, for error messages
+ * @param type The type of the parameter
+ * @param parameter_state_type The state type of the parameter, if applicable
+ * @return The default value of the stored type
+ */
+static ParameterValue
+make_parameter_value(const std::string& name, const ParameterType& type, const StateType& parameter_state_type) {
+  switch (type) {
+    case ParameterType::INT:
+      return ParameterValue(std::in_place_type<int>);
+    case ParameterType::INT_ARRAY:
+      return ParameterValue(std::in_place_type<std::vector<int>>);
+    case ParameterType::DOUBLE:
+      return ParameterValue(std::in_place_type<double>);
+    case ParameterType::DOUBLE_ARRAY:
+      return ParameterValue(std::in_place_type<std::vector<double>>);
+    case ParameterType::BOOL:
+      return ParameterValue(std::in_place_type<bool>);
+    case ParameterType::BOOL_ARRAY:
+      return ParameterValue(std::in_place_type<std::vector<bool>>);
+    case ParameterType::STRING:
+      return ParameterValue(std::in_place_type<std::string>);
+    case ParameterType::STRING_ARRAY:
+      return ParameterValue(std::in_place_type<std::vector<std::string>>);
+    case ParameterType::STATE:
+      switch (parameter_state_type) {
+        case StateType::CARTESIAN_STATE:
+          return ParameterValue(std::in_place_type<CartesianState>);
+        case StateType::CARTESIAN_POSE:
+          return ParameterValue(std::in_place_type<CartesianPose>);
+        case StateType::JOINT_STATE:
+          return ParameterValue(std::in_place_type<JointState>);
+        case StateType::JOINT_POSITIONS:
+          return ParameterValue(std::in_place_type<JointPositions>);
+        case StateType::GEOMETRY_ELLIPSOID:
+          return ParameterValue(std::in_place_type<Ellipsoid>);
+        default:
+          throw exceptions::InvalidParameterException(
+              "The StateType of parameter '" + name + "' is not supported");
+      }
+    case ParameterType::MATRIX:
+      return ParameterValue(std::in_place_type<Eigen::MatrixXd>);
+    case ParameterType::VECTOR:
+      return ParameterValue(std::in_place_type<Eigen::VectorXd>);
+    default:
+      throw exceptions::InvalidParameterException("The ParameterType of parameter " + name + " is invalid.");
   }
 }
 
+ParameterContainer::ParameterContainer(
+    const std::string& name, const ParameterType& type, const StateType& parameter_state_type
+) : ParameterInterface(name, type, parameter_state_type),
+    values(make_parameter_value(name, type, parameter_state_type)) {}
+
 ParameterContainer::ParameterContainer(
     const std::string& name, const py::object& value, const ParameterType& type, const StateType& parameter_state_type
-) : ParameterInterface(name, type, parameter_state_type) {
+) : ParameterContainer(name, type, parameter_state_type) {
   set_value(value);
 }
 
-ParameterContainer::ParameterContainer(const ParameterContainer& parameter) :
-    ParameterInterface(parameter.get_name(), parameter.get_parameter_type(), parameter.get_parameter_state_type()) {
-  if (parameter) {
-    set_value(parameter.get_value());
+ParameterContainer::ParameterContainer(const std::shared_ptr<ParameterInterface>& parameter) :
+    ParameterContainer(parameter->get_name(), parameter->get_parameter_type(), parameter->get_parameter_state_type()) {
+  if (parameter->is_empty()) {
+    return;
   }
+  std::visit(
+      [&parameter](auto& value) {
+        using T = std::decay_t<decltype(value)>;
+        value = parameter->get_parameter<T>()->get_value();
+      }, this->values
+  );
+  this->set_empty(false);
 }
 
-void ParameterContainer::set_value(py::object value) {
+void ParameterContainer::set_value(const py::object& value) {
   try {
-    switch (this->get_parameter_type()) {
-      case ParameterType::INT:
-        values.int_value = value.cast<int>();
-        break;
-      case ParameterType::INT_ARRAY:
-        values.int_array_value = value.cast < std::vector < int >> ();
-        break;
-      case ParameterType::DOUBLE:
-        values.double_value = value.cast<double>();
-        break;
-      case ParameterType::DOUBLE_ARRAY:
-        values.double_array_value = value.cast < std::vector < double >> ();
-        break;
-      case ParameterType::BOOL:
-        values.bool_value = value.cast<bool>();
-        break;
-      case ParameterType::BOOL_ARRAY:
-        values.bool_array_value = value.cast < std::vector < bool >> ();
-        break;
-      case ParameterType::STRING:
-        values.string_value = value.cast<std::string>();
-        break;
-      case ParameterType::STRING_ARRAY:
-        values.string_array_value = value.cast < std::vector < std::string >> ();
-        break;
-      case ParameterType::STATE:
-        switch (this->get_parameter_state_type()) {
-          case StateType::CARTESIAN_STATE:
-            values.state_pointer = std::make_shared<CartesianState>(value.cast<CartesianState>());
-            break;
-          case StateType::CARTESIAN_POSE:
-            values.state_pointer = std::make_shared<CartesianPose>(value.cast<CartesianPose>());
-            break;
-          case StateType::JOINT_STATE:
-            values.state_pointer = std::make_shared<JointState>(value.cast<JointState>());
-            break;
-          case StateType::JOINT_POSITIONS:
-            values.state_pointer = std::make_shared<JointPositions>(value.cast<JointPositions>());
-            break;
-          case StateType::GEOMETRY_ELLIPSOID:
-            values.state_pointer = std::make_shared<Ellipsoid>(value.cast<Ellipsoid>());
-            break;
-          default:
-            throw exceptions::InvalidParameterException(
-                "The StateType of parameter '" + this->get_name() + "' is not supported");
-        }
-        break;
-      case ParameterType::MATRIX:
-        values.matrix_value = value.cast<Eigen::MatrixXd>();
-        break;
-      case ParameterType::VECTOR:
-        values.vector_value = value.cast<Eigen::VectorXd>();
-        break;
-      default:
-        throw exceptions::InvalidParameterException("The ParameterType of parameter " + this->get_name() + " is invalid.");
-    }
+    std::visit(
+        [&value](auto& stored_value) {
+          using T = std::decay_t<decltype(stored_value)>;
+          if constexpr (std::is_base_of_v<State, T>) {
+            // bound classes are read by reference to copy the state only once
+            stored_value = value.cast<const T&>();
+          } else {
+            stored_value = value.cast<T>();
+          }
+        }, this->values
+    );
   } catch (const pybind11::cast_error& ex) {
     throw exceptions::InvalidCastException(
         std::string("Could not cast the given object to the required parameter type: ") + ex.what());
@@ -117,46 +110,7 @@ void ParameterContainer::set_value(py::object value) {
 
 py::object ParameterContainer::get_value() const {
   try {
-    switch (this->get_parameter_type()) {
-      case ParameterType::INT:
-        return py::cast(values.int_value);
-      case ParameterType::INT_ARRAY:
-        return py::cast(values.int_array_value);
-      case ParameterType::DOUBLE:
-        return py::cast(values.double_value);
-      case ParameterType::DOUBLE_ARRAY:
-        return py::cast(values.double_array_value);
-      case ParameterType::BOOL:
-        return py::cast(values.bool_value);
-      case ParameterType::BOOL_ARRAY:
-        return py::cast(values.bool_array_value);
-      case ParameterType::STRING:
-        return py::cast(values.string_value);
-      case ParameterType::STRING_ARRAY:
-        return py::cast(values.string_array_value);
-      case ParameterType::STATE:
-        switch (this->get_parameter_state_type()) {
-          case StateType::CARTESIAN_STATE:
-            return py::cast(*std::dynamic_pointer_cast<CartesianState>(values.state_pointer));
-          case StateType::CARTESIAN_POSE:
-            return py::cast(*std::dynamic_pointer_cast<CartesianPose>(values.state_pointer));
-          case StateType::JOINT_STATE:
-            return py::cast(*std::dynamic_pointer_cast<JointState>(values.state_pointer));
-          case StateType::JOINT_POSITIONS:
-            return py::cast(*std::dynamic_pointer_cast<JointPositions>(values.state_pointer));
-          case StateType::GEOMETRY_ELLIPSOID:
-            return py::cast(*std::dynamic_pointer_cast<Ellipsoid>(values.state_pointer));
-          default:
-            throw exceptions::InvalidParameterException(
-                "The StateType of parameter '" + this->get_name() + "' is not supported");
-        }
-      case ParameterType::MATRIX:
-        return py::cast(values.matrix_value);
-      case ParameterType::VECTOR:
-        return py::cast(values.vector_value);
-      default:
-        throw exceptions::InvalidParameterException("The ParameterType of parameter " + this->get_name() + " is invalid.");
-    }
+    return std::visit([](const auto& value) { return py::cast(value); }, this->values);
   } catch (const pybind11::cast_error& ex) {
     throw exceptions::InvalidCastException(std::string("Could not cast the value to a Python object: ") + ex.what());
   }
@@ -164,130 +118,27 @@ py::object ParameterContainer::get_value() const {
 
 void ParameterContainer::reset() {
   this->State::reset();
-  values = ParameterValues();
+  std::visit([](auto& value) { value = std::decay_t<decltype(value)>(); }, this->values);
 }
 
-ParameterContainer interface_ptr_to_container(const std::shared_ptr<ParameterInterface>& parameter) {
-  if (parameter->is_empty()) {
-    return ParameterContainer(
-        parameter->get_name(), parameter->get_parameter_type(), parameter->get_parameter_state_type());
-  }
-  try {
-    switch (parameter->get_parameter_type()) {
-      case ParameterType::INT:
-        return ParameterContainer(
-            parameter->get_name(), py::cast(parameter->get_parameter_value<int>()), ParameterType::INT);
-      case ParameterType::INT_ARRAY:
-        return ParameterContainer(
-            parameter->get_name(), py::cast(parameter->get_parameter_value<std::vector<int>>()), ParameterType::INT_ARRAY);
-      case ParameterType::DOUBLE:
-        return ParameterContainer(
-            parameter->get_name(), py::cast(parameter->get_parameter_value<double>()), ParameterType::DOUBLE);
-      case ParameterType::DOUBLE_ARRAY:
-        return ParameterContainer(
-            parameter->get_name(), py::cast(parameter->get_parameter_value < std::vector<double>>()), ParameterType::DOUBLE_ARRAY);
-      case ParameterType::BOOL:
-        return ParameterContainer(
-            parameter->get_name(), py::cast(parameter->get_parameter_value<bool>()), ParameterType::BOOL);
-      case ParameterType::BOOL_ARRAY:
-        return ParameterContainer(
-            parameter->get_name(), py::cast(parameter->get_parameter_value<std::vector<bool>>()), ParameterType::BOOL_ARRAY);
-      case ParameterType::STRING:
-        return ParameterContainer(
-            parameter->get_name(), py::cast(parameter->get_parameter_value<std::string>()), ParameterType::STRING);
-      case ParameterType::STRING_ARRAY:
-        return ParameterContainer(
-            parameter->get_name(), py::cast(parameter->get_parameter_value<std::vector<std::string>>()), ParameterType::STRING_ARRAY);
-      case ParameterType::STATE:
-        switch (parameter->get_parameter_state_type()) {
-          case StateType::CARTESIAN_STATE:
-            return ParameterContainer(
-                parameter->get_name(), py::cast(parameter->get_parameter_value<CartesianState>()), ParameterType::STATE,
-                StateType::CARTESIAN_STATE);
-          case StateType::CARTESIAN_POSE:
-            return ParameterContainer(
-                parameter->get_name(), py::cast(parameter->get_parameter_value<CartesianPose>()), ParameterType::STATE,
-                StateType::CARTESIAN_POSE);
-          case StateType::JOINT_STATE:
-            return ParameterContainer(
-                parameter->get_name(), py::cast(parameter->get_parameter_value<JointState>()), ParameterType::STATE,
-                StateType::JOINT_STATE);
-          case StateType::JOINT_POSITIONS:
-            return ParameterContainer(
-                parameter->get_name(), py::cast(parameter->get_parameter_value<JointPositions>()), ParameterType::STATE,
-                StateType::JOINT_POSITIONS);
-          case StateType::GEOMETRY_ELLIPSOID:
-            return ParameterContainer(
-                parameter->get_name(), py::cast(parameter->get_parameter_value<Ellipsoid>()), ParameterType::STATE,
-                StateType::GEOMETRY_ELLIPSOID);
-          default:
-            throw exceptions::InvalidParameterException(
-                "The StateType of parameter '" + parameter->get_name() + "' is not supported");
-        }
-      case ParameterType::MATRIX:
-        return ParameterContainer(
-            parameter->get_name(), py::cast(parameter->get_parameter_value<Eigen::MatrixXd>()), ParameterType::MATRIX);
-      case ParameterType::VECTOR:
-        return ParameterContainer(
-            parameter->get_name(), py::cast(parameter->get_parameter_value<Eigen::VectorXd>()), ParameterType::VECTOR);
-      default:
-        throw exceptions::InvalidParameterException("The ParameterType of parameter " + parameter->get_name() + " is invalid.");
-    }
-  } catch (const pybind11::cast_error& ex) {
-    throw exceptions::InvalidCastException(std::string("Could not cast the value to a Python object: ") + ex.what());
+std::shared_ptr<ParameterInterface> ParameterContainer::to_interface_ptr() const {
+  if (this->is_empty()) {
+    return make_shared_parameter_interface(
+        this->get_name(), this->get_parameter_type(), this->get_parameter_state_type());
   }
+  return std::visit(
+      [this](const auto& value) -> std::shared_ptr<ParameterInterface> {
+        return make_shared_parameter(this->get_name(), value);
+      }, this->values
+  );
+}
+
+ParameterContainer interface_ptr_to_container(const std::shared_ptr<ParameterInterface>& parameter) {
+  return ParameterContainer(parameter);
 }
 
 std::shared_ptr<ParameterInterface> container_to_interface_ptr(const ParameterContainer& parameter) {
-  if (parameter.is_empty()) {
-    return make_shared_parameter_interface(
-        parameter.get_name(), parameter.get_parameter_type(), parameter.get_parameter_state_type());
-  }
-  switch (parameter.get_parameter_type()) {
-    case ParameterType::INT:
-      return make_shared_parameter(parameter.get_name(), parameter.values.int_value);
-    case ParameterType::INT_ARRAY:
-      return make_shared_parameter(parameter.get_name(), parameter.values.int_array_value);
-    case ParameterType::DOUBLE:
-      return make_shared_parameter(parameter.get_name(), parameter.values.double_value);
-    case ParameterType::DOUBLE_ARRAY:
-      return make_shared_parameter(parameter.get_name(), parameter.values.double_array_value);
-    case ParameterType::BOOL:
-      return make_shared_parameter(parameter.get_name(), parameter.values.bool_value);
-    case ParameterType::BOOL_ARRAY:
-      return make_shared_parameter(parameter.get_name(), parameter.values.bool_array_value);
-    case ParameterType::STRING:
-      return make_shared_parameter(parameter.get_name(), parameter.values.string_value);
-    case ParameterType::STRING_ARRAY:
-      return make_shared_parameter(parameter.get_name(), parameter.values.string_array_value);
-    case ParameterType::STATE:
-      switch (parameter.get_parameter_state_type()) {
-        case StateType::CARTESIAN_STATE:
-          return make_shared_parameter(
-              parameter.get_name(), *std::dynamic_pointer_cast<CartesianState>(parameter.values.state_pointer));
-        case StateType::CARTESIAN_POSE:
-          return make_shared_parameter(
-              parameter.get_name(), *std::dynamic_pointer_cast<CartesianPose>(parameter.values.state_pointer));
-        case StateType::JOINT_STATE:
-          return make_shared_parameter(
-              parameter.get_name(), *std::dynamic_pointer_cast<JointState>(parameter.values.state_pointer));
-        case StateType::JOINT_POSITIONS:
-          return make_shared_parameter(
-              parameter.get_name(), *std::dynamic_pointer_cast<JointPositions>(parameter.values.state_pointer));
-        case StateType::GEOMETRY_ELLIPSOID:
-          return make_shared_parameter(
-              parameter.get_name(), *std::dynamic_pointer_cast<Ellipsoid>(parameter.values.state_pointer));
-        default:
-          throw exceptions::InvalidParameterException(
-              "The StateType of parameter '" + parameter.get_name() + "' is not supported");
-      }
-    case ParameterType::MATRIX:
-      return make_shared_parameter(parameter.get_name(), parameter.values.matrix_value);
-    case ParameterType::VECTOR:
-      return make_shared_parameter(parameter.get_name(), parameter.values.vector_value);
-    default:
-      throw exceptions::InvalidParameterException("The ParameterType of parameter " + parameter.get_name() + " is invalid.");
-  }
+  return parameter.to_interface_ptr();
 }
 
 std::map<std::string, ParameterContainer>
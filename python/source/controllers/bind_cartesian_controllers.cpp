@@ -9,6 +9,7 @@
 #include <state_representation/space/joint/JointState.hpp>
 
 #include "py_controller.hpp"
+#include "state_batch.hpp"
 
 using namespace state_representation;
 using namespace py_parameter;
@@ -26,6 +27,16 @@ void cartesian_controller(py::module_& m) {
   c.def(
       "compute_command", py::overload_cast<const CartesianState&, const CartesianState&, const JointPositions&, const std::string&>(&IController<CartesianState>::compute_command),
       "Compute the command output in joint space from command and feedback states in task space.", "command_state"_a, "feedback_state"_a, "joint_positions"_a, "frame"_a = std::string(""));
+  c.def(
+      "compute_command_batch",
+      [](IController<CartesianState>& self, const CartesianState& command_state, const CartesianState& feedback_state,
+         const Eigen::Ref<const RowMatrixXd>& command_data, const Eigen::Ref<const RowMatrixXd>& feedback_data) -> RowMatrixXd {
+        return evaluate_state_batch(
+            command_state, command_data, feedback_state, feedback_data,
+            [&self](const CartesianState& command, const CartesianState& feedback) { return self.compute_command(command, feedback); });
+      },
+      "Compute the command output for (N, m) batches of command and feedback state data, where each row is the data of the corresponding template state, and return the (N, m) batch of data of the command outputs.",
+      "command_state"_a, "feedback_state"_a, "command_data"_a, "feedback_data"_a);
 
   c.def("get_robot_model", &IController<CartesianState>::get_robot_model, "Get the robot model associated with the controller.");
   c.def("set_robot_model", &IController<CartesianState>::set_robot_model, "Set the robot model associated with the controller.", "robot_model"_a);
@@ -6,6 +6,7 @@
 #include <state_representation/space/joint/JointState.hpp>
 
 #include "py_controller.hpp"
+#include "state_batch.hpp"
 
 using namespace state_representation;
 using namespace py_parameter;
@@ -17,6 +18,16 @@ void joint_controller(py::module_& m) {
   c.def(
       "compute_command", py::overload_cast<const JointState&, const JointState&>(&IController<JointState>::compute_command),
       "Compute the command output based on the commanded state and a feedback state.", "command_state"_a, "feedback_state"_a);
+  c.def(
+      "compute_command_batch",
+      [](IController<JointState>& self, const JointState& command_state, const JointState& feedback_state,
+         const Eigen::Ref<const RowMatrixXd>& command_data, const Eigen::Ref<const RowMatrixXd>& feedback_data) -> RowMatrixXd {
+        return evaluate_state_batch(
+            command_state, command_data, feedback_state, feedback_data,
+            [&self](const JointState& command, const JointState& feedback) { return self.compute_command(command, feedback); });
+      },
+      "Compute the command output for (N, m) batches of command and feedback state data, where each row is the data of the corresponding template state, and return the (N, m) batch of data of the command outputs.",
+      "command_state"_a, "feedback_state"_a, "command_data"_a, "feedback_data"_a);
 
   c.def("get_robot_model", &IController<JointState>::get_robot_model, "Get the robot model associated with the controller.");
   c.def("set_robot_model", &IController<JointState>::set_robot_model, "Set the robot model associated with the controller.", "robot_model"_a);
@@ -5,6 +5,7 @@
 #include <state_representation/space/cartesian/CartesianState.hpp>
 
 #include "py_dynamical_system.hpp"
+#include "state_batch.hpp"
 
 using namespace state_representation;
 using namespace py_parameter;
@@ -15,6 +16,13 @@ void cartesian(py::module_& m) {
 
   c.def("is_compatible", &IDynamicalSystem<CartesianState>::is_compatible);
   c.def("evaluate", &IDynamicalSystem<CartesianState>::evaluate);
+  c.def(
+      "evaluate_batch",
+      [](IDynamicalSystem<CartesianState>& self, const CartesianState& state, const Eigen::Ref<const RowMatrixXd>& data) -> RowMatrixXd {
+        return evaluate_state_batch(state, data, [&self](const CartesianState& current) { return self.evaluate(current); });
+      },
+      "Evaluate the dynamical system for a (N, m) batch of state data, where each row is the data of the template state, and return the (N, m) batch of data of the evaluated states.",
+      "state"_a, "data"_a);
   c.def("get_base_frame", &IDynamicalSystem<CartesianState>::get_base_frame);
   c.def("set_base_frame", &IDynamicalSystem<CartesianState>::set_base_frame);
 }
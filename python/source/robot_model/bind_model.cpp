@@ -1,9 +1,83 @@
 #include "robot_model_bindings.hpp"
 
+#include <algorithm>
+#include <exception>
+#include <thread>
+
 #include <robot_model/Model.hpp>
+#include <robot_model/exceptions/InvalidJointStateSizeException.hpp>
+
+#include "state_batch.hpp"
 
 using namespace state_representation;
 
+/**
+ * @brief Compute a joint space quantity of the model for a batch of joint positions.
+ * @details The rows of the batch are split in contiguous chunks over the threads. The first chunk is computed
+ * with the model itself and every other chunk with a copy of the model, so that the threads do not contend on the
+ * computation workspace of the model. Exceptions raised in a thread are rethrown once all threads are joined.
+ * @tparam F The function type, writing the result for a joint positions sample in the corresponding output row
+ * @param model The robot model
+ * @param joint_positions The batch of joint positions with one sample per row
+ * @param cols The number of columns of the result
+ * @param nb_threads The number of threads to split the batch over
+ * @param function The function to evaluate for each sample
+ * @return The batch of results with one sample per row
+ */
+template<typename F>
+static RowMatrixXd compute_batch(
+    Model& model, const Eigen::Ref<const RowMatrixXd>& joint_positions, Eigen::Index cols, unsigned int nb_threads,
+    const F& function
+) {
+  if (joint_positions.cols() != model.get_number_of_joints()) {
+    throw robot_model::exceptions::InvalidJointStateSizeException(joint_positions.cols(), model.get_number_of_joints());
+  }
+  const Eigen::Index rows = joint_positions.rows();
+  RowMatrixXd result(rows, cols);
+  auto compute_rows = [&](Model& worker_model, Eigen::Index start, Eigen::Index end) {
+    JointPositions positions(worker_model.get_robot_name(), worker_model.get_joint_frames());
+    Eigen::VectorXd row(joint_positions.cols());
+    for (Eigen::Index i = start; i < end; ++i) {
+      row = joint_positions.row(i).transpose();
+      positions.set_positions(row);
+      function(worker_model, positions, result.row(i));
+    }
+  };
+  nb_threads = static_cast<unsigned int>(std::max<Eigen::Index>(1, std::min<Eigen::Index>(nb_threads, rows)));
+  if (nb_threads == 1) {
+    compute_rows(model, 0, rows);
+    return result;
+  }
+  const Eigen::Index chunk = (rows + nb_threads - 1) / nb_threads;
+  std::vector<Model> models(nb_threads - 1, model);
+  std::vector<std::exception_ptr> errors(nb_threads);
+  std::vector<std::thread> threads;
+  threads.reserve(nb_threads - 1);
+  for (unsigned int t = 1; t < nb_threads; ++t) {
+    threads.emplace_back([&, t]() {
+      try {
+        compute_rows(models.at(t - 1), std::min(rows, t * chunk), std::min(rows, (t + 1) * chunk));
+      } catch (...) {
+        errors.at(t) = std::current_exception();
+      }
+    });
+  }
+  try {
+    compute_rows(model, 0, std::min(rows, chunk));
+  } catch (...) {
+    errors.at(0) = std::current_exception();
+  }
+  for (auto& thread: threads) {
+    thread.join();
+  }
+  for (const auto& error: errors) {
+    if (error) {
+      std::rethrow_exception(error);
+    }
+  }
+  return result;
+}
+
 void inverse_kinematics_parameters(py::module_& m) {
   py::class_<InverseKinematicsParameters> c(m, "InverseKinematicsParameters");
   c.def(py::init());
@@ -62,49 +136,83 @@ void model(py::module_& m) {
 //  c.def("get_pinocchio_model", &Model::get_pinocchio_model, "Getter of the pinocchio model.");
 
   
-  c.def("check_collision", py::overload_cast<const JointPositions&>(&Model::check_collision), "Check if the robot is in collision at a given joint state.", "joint_positions"_a);
-  c.def("compute_minimum_collision_distances", py::overload_cast<const JointPositions&>(&Model::compute_minimum_collision_distances), "Compute the minimum distances between the robot links.", "joint_positions"_a);
+  c.def("check_collision", py::overload_cast<const JointPositions&>(&Model::check_collision), "Check if the robot is in collision at a given joint state.", "joint_positions"_a, py::call_guard<py::gil_scoped_release>());
+  c.def("compute_minimum_collision_distances", py::overload_cast<const JointPositions&>(&Model::compute_minimum_collision_distances), "Compute the minimum distances between the robot links.", "joint_positions"_a, py::call_guard<py::gil_scoped_release>());
   c.def("get_number_of_collision_pairs", &Model::get_number_of_collision_pairs, "Get the number of collision pairs in the model.");
   c.def("is_geometry_model_initialized", &Model::is_geometry_model_initialized, "Check if the geometry model is initialized.");
   c.def(
       "compute_jacobian", py::overload_cast<const JointPositions&, const std::string&>(&Model::compute_jacobian),
-      "Compute the Jacobian from a given joint state at the frame given in parameter.", "joint_positions"_a, "frame"_a = std::string(""));
+      "Compute the Jacobian from a given joint state at the frame given in parameter.", "joint_positions"_a, "frame"_a = std::string(""), py::call_guard<py::gil_scoped_release>());
   c.def(
       "compute_jacobian_time_derivative", py::overload_cast<const JointPositions&, const JointVelocities&, const std::string&>(&Model::compute_jacobian_time_derivative),
-      "Compute the time derivative of the Jacobian from given joint positions and velocities at the frame in parameter.", "joint_positions"_a, "joint_velocities"_a, "frame"_a = std::string(""));
-  c.def("compute_inertia_matrix", py::overload_cast<const JointPositions&>(&Model::compute_inertia_matrix), "Compute the Inertia matrix from given joint positions.", "joint_positions"_a);
+      "Compute the time derivative of the Jacobian from given joint positions and velocities at the frame in parameter.", "joint_positions"_a, "joint_velocities"_a, "frame"_a = std::string(""), py::call_guard<py::gil_scoped_release>());
+  c.def("compute_inertia_matrix", py::overload_cast<const JointPositions&>(&Model::compute_inertia_matrix), "Compute the Inertia matrix from given joint positions.", "joint_positions"_a, py::call_guard<py::gil_scoped_release>());
   c.def(
       "compute_inertia_torques", py::overload_cast<const JointState&>(&Model::compute_inertia_torques),
-      "Compute the Inertia torques, i.e the inertia matrix multiplied by the joint accelerations. Joint positions are needed as well for computations of the inertia matrix.", "joint_state"_a);
-  c.def("compute_coriolis_matrix", py::overload_cast<const JointState&>(&Model::compute_coriolis_matrix), "Compute the Coriolis matrix from a given joint state.", "joint_state"_a);
+      "Compute the Inertia torques, i.e the inertia matrix multiplied by the joint accelerations. Joint positions are needed as well for computations of the inertia matrix.", "joint_state"_a, py::call_guard<py::gil_scoped_release>());
+  c.def("compute_coriolis_matrix", py::overload_cast<const JointState&>(&Model::compute_coriolis_matrix), "Compute the Coriolis matrix from a given joint state.", "joint_state"_a, py::call_guard<py::gil_scoped_release>());
   c.def(
       "compute_coriolis_torques", py::overload_cast<const JointState&>(&Model::compute_coriolis_torques),
-      "Compute the Coriolis torques, i.e. the Coriolis matrix multiplied by the joint velocities and express the result as a JointTorques.", "joint_state"_a);
-  c.def("compute_gravity_torques", py::overload_cast<const JointPositions&>(&Model::compute_gravity_torques), "Compute the gravity torques.", "joint_positions"_a);
+      "Compute the Coriolis torques, i.e. the Coriolis matrix multiplied by the joint velocities and express the result as a JointTorques.", "joint_state"_a, py::call_guard<py::gil_scoped_release>());
+  c.def("compute_gravity_torques", py::overload_cast<const JointPositions&>(&Model::compute_gravity_torques), "Compute the gravity torques.", "joint_positions"_a, py::call_guard<py::gil_scoped_release>());
 
   c.def("forward_kinematics", py::overload_cast<const JointPositions&, const std::vector<std::string>&>(&Model::forward_kinematics),
-        "Compute the forward kinematics, i.e. the pose of certain frames from the joint positions", "joint_positions"_a, "frames"_a);
+        "Compute the forward kinematics, i.e. the pose of certain frames from the joint positions", "joint_positions"_a, "frames"_a, py::call_guard<py::gil_scoped_release>());
   c.def("forward_kinematics", py::overload_cast<const JointPositions&, const std::string&>(&Model::forward_kinematics),
-      "Compute the forward kinematics, i.e. the pose of the frame from the joint positions", "joint_positions"_a, "frame"_a = std::string(""));
+      "Compute the forward kinematics, i.e. the pose of the frame from the joint positions", "joint_positions"_a, "frame"_a = std::string(""), py::call_guard<py::gil_scoped_release>());
+
+  c.def(
+      "forward_kinematics_batch",
+      [](Model& self, const Eigen::Ref<const RowMatrixXd>& joint_positions, const std::string& frame, unsigned int nb_threads) -> RowMatrixXd {
+        return compute_batch(self, joint_positions, 7, nb_threads, [&frame](Model& model, const JointPositions& positions, Eigen::Ref<Eigen::RowVectorXd> output) {
+          output = model.forward_kinematics(positions, frame).get_pose().transpose();
+        });
+      },
+      "Compute the forward kinematics of the frame for a (N, dof) batch of joint positions and return the (N, 7) batch of poses as [x, y, z, qw, qx, qy, qz]",
+      "joint_positions"_a, "frame"_a = std::string(""), "nb_threads"_a = 1, py::call_guard<py::gil_scoped_release>());
+  c.def(
+      "compute_jacobian_batch",
+      [](Model& self, const Eigen::Ref<const RowMatrixXd>& joint_positions, const std::string& frame, unsigned int nb_threads) -> py::array_t<double> {
+        auto nb_joints = static_cast<Eigen::Index>(self.get_number_of_joints());
+        RowMatrixXd jacobians;
+        {
+          py::gil_scoped_release release;
+          jacobians = compute_batch(self, joint_positions, 6 * nb_joints, nb_threads, [&frame, nb_joints](Model& model, const JointPositions& positions, Eigen::Ref<Eigen::RowVectorXd> output) {
+            Eigen::Map<RowMatrixXd>(output.data(), 6, nb_joints) = model.compute_jacobian(positions, frame).data();
+          });
+        }
+        return py::array_t<double>({jacobians.rows(), Eigen::Index(6), nb_joints}, jacobians.data());
+      },
+      "Compute the Jacobian at the frame for a (N, dof) batch of joint positions and return the (N, 6, dof) batch of Jacobian matrices",
+      "joint_positions"_a, "frame"_a = std::string(""), "nb_threads"_a = 1);
+  c.def(
+      "compute_gravity_torques_batch",
+      [](Model& self, const Eigen::Ref<const RowMatrixXd>& joint_positions, unsigned int nb_threads) -> RowMatrixXd {
+        return compute_batch(self, joint_positions, self.get_number_of_joints(), nb_threads, [](Model& model, const JointPositions& positions, Eigen::Ref<Eigen::RowVectorXd> output) {
+          output = model.compute_gravity_torques(positions).get_torques().transpose();
+        });
+      },
+      "Compute the gravity torques for a (N, dof) batch of joint positions and return the (N, dof) batch of torques",
+      "joint_positions"_a, "nb_threads"_a = 1, py::call_guard<py::gil_scoped_release>());
 
   c.def("inverse_kinematics", py::overload_cast<const CartesianPose&, const InverseKinematicsParameters&, const std::string&>(&Model::inverse_kinematics),
-        "Compute the inverse kinematics, i.e. joint positions from the pose of the end-effector in an iterative manner", "cartesian_pose"_a, "parameters"_a = InverseKinematicsParameters(), "frame"_a = std::string(""));
+        "Compute the inverse kinematics, i.e. joint positions from the pose of the end-effector in an iterative manner", "cartesian_pose"_a, "parameters"_a = InverseKinematicsParameters(), "frame"_a = std::string(""), py::call_guard<py::gil_scoped_release>());
   c.def("inverse_kinematics", py::overload_cast<const CartesianPose&, const JointPositions&, const InverseKinematicsParameters&, const std::string&>(&Model::inverse_kinematics),
-        " Compute the inverse kinematics, i.e. joint positions from the pose of the end-effector", "cartesian_pose"_a, "joint_positions"_a, "parameters"_a = InverseKinematicsParameters(), "frame"_a = std::string(""));
+        " Compute the inverse kinematics, i.e. joint positions from the pose of the end-effector", "cartesian_pose"_a, "joint_positions"_a, "parameters"_a = InverseKinematicsParameters(), "frame"_a = std::string(""), py::call_guard<py::gil_scoped_release>());
 
   c.def("forward_velocity", py::overload_cast<const JointState&, const std::vector<std::string>&>(&Model::forward_velocity),
-        "Compute the forward velocity kinematics, i.e. the twist of certain frames from the joint states", "joint_state"_a, "frames"_a);
+        "Compute the forward velocity kinematics, i.e. the twist of certain frames from the joint states", "joint_state"_a, "frames"_a, py::call_guard<py::gil_scoped_release>());
   c.def("forward_velocity", py::overload_cast<const JointState&, const std::string&>(&Model::forward_velocity),
-        "Compute the forward velocity kinematics, i.e. the twist of the end-effector from the joint velocities", "joint_state"_a, "frame"_a = std::string(""));
+        "Compute the forward velocity kinematics, i.e. the twist of the end-effector from the joint velocities", "joint_state"_a, "frame"_a = std::string(""), py::call_guard<py::gil_scoped_release>());
 
   c.def("inverse_velocity", py::overload_cast<const std::vector<CartesianTwist>&, const JointPositions&, const std::vector<std::string>&, const double>(&Model::inverse_velocity),
-        "Compute the inverse velocity kinematics, i.e. joint velocities from the velocities of the frames in parameter the Jacobian", "cartesian_twists"_a, "joint_positions"_a, "frames"_a, "dls_lambda"_a = 0.0);
+        "Compute the inverse velocity kinematics, i.e. joint velocities from the velocities of the frames in parameter the Jacobian", "cartesian_twists"_a, "joint_positions"_a, "frames"_a, "dls_lambda"_a = 0.0, py::call_guard<py::gil_scoped_release>());
   c.def("inverse_velocity", py::overload_cast<const CartesianTwist&, const JointPositions&, const std::string&, const double>(&Model::inverse_velocity),
-        "Compute the inverse velocity kinematics, i.e. joint velocities from the twist of the end-effector using the Jacobian", "cartesian_twist"_a, "joint_positions"_a, "frame"_a = std::string(""), "dls_lambda"_a = 0.0);
+        "Compute the inverse velocity kinematics, i.e. joint velocities from the twist of the end-effector using the Jacobian", "cartesian_twist"_a, "joint_positions"_a, "frame"_a = std::string(""), "dls_lambda"_a = 0.0, py::call_guard<py::gil_scoped_release>());
   c.def("inverse_velocity", py::overload_cast<const std::vector<CartesianTwist>&, const JointPositions&, const QPInverseVelocityParameters&, const std::vector<std::string>&>(&Model::inverse_velocity),
-        "Compute the inverse velocity kinematics, i.e. joint velocities from the velocities of the frames in parameter using the QP optimization method", "cartesian_twists"_a, "joint_positions"_a, "parameters"_a, "frames"_a);
+        "Compute the inverse velocity kinematics, i.e. joint velocities from the velocities of the frames in parameter using the QP optimization method", "cartesian_twists"_a, "joint_positions"_a, "parameters"_a, "frames"_a, py::call_guard<py::gil_scoped_release>());
   c.def("inverse_velocity", py::overload_cast<const CartesianTwist&, const JointPositions&, const QPInverseVelocityParameters&, const std::string&>(&Model::inverse_velocity),
-        "Compute the inverse velocity kinematics, i.e. joint velocities from the twist of the end-effector using the QP optimization method", "cartesian_twist"_a, "joint_positions"_a, "parameters"_a, "frame"_a = std::string(""));
+        "Compute the inverse velocity kinematics, i.e. joint velocities from the twist of the end-effector using the QP optimization method", "cartesian_twist"_a, "joint_positions"_a, "parameters"_a, "frame"_a = std::string(""), py::call_guard<py::gil_scoped_release>());
 
   c.def("in_range", [](Model& self, const JointPositions& joint_positions) -> bool { return self.in_range(joint_positions); },
         "Check if the joint positions are inside the limits provided by the model", "joint_positions"_a);
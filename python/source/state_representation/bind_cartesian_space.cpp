@@ -85,6 +85,14 @@ void cartesian_state(py::module_& m) {
   c.def("get_torque", &CartesianState::get_torque, "Getter of the torque attribute");
   c.def("get_wrench", &CartesianState::get_wrench, "Getter of the 6d wrench from force and torque attributes");
 
+  c.def("get_position_view", [](const py::object& self) { return state_variable_view(self.cast<const CartesianState&>().get_position(), self); }, "Getter of the position attribute as a writable array sharing the memory of the state, without copy");
+  c.def("get_linear_velocity_view", [](const py::object& self) { return state_variable_view(self.cast<const CartesianState&>().get_linear_velocity(), self); }, "Getter of the linear velocity attribute as a writable array sharing the memory of the state, without copy");
+  c.def("get_angular_velocity_view", [](const py::object& self) { return state_variable_view(self.cast<const CartesianState&>().get_angular_velocity(), self); }, "Getter of the angular velocity attribute as a writable array sharing the memory of the state, without copy");
+  c.def("get_linear_acceleration_view", [](const py::object& self) { return state_variable_view(self.cast<const CartesianState&>().get_linear_acceleration(), self); }, "Getter of the linear acceleration attribute as a writable array sharing the memory of the state, without copy");
+  c.def("get_angular_acceleration_view", [](const py::object& self) { return state_variable_view(self.cast<const CartesianState&>().get_angular_acceleration(), self); }, "Getter of the angular acceleration attribute as a writable array sharing the memory of the state, without copy");
+  c.def("get_force_view", [](const py::object& self) { return state_variable_view(self.cast<const CartesianState&>().get_force(), self); }, "Getter of the force attribute as a writable array sharing the memory of the state, without copy");
+  c.def("get_torque_view", [](const py::object& self) { return state_variable_view(self.cast<const CartesianState&>().get_torque(), self); }, "Getter of the torque attribute as a writable array sharing the memory of the state, without copy");
+
   c.def("set_position", py::overload_cast<const Eigen::Vector3d&>(&CartesianState::set_position), "Setter of the position");
   c.def("set_position", py::overload_cast<const std::vector<double>&>(&CartesianState::set_position), "Setter of the position from a list");
   c.def("set_position", py::overload_cast<const double&, const double&, const double&>(&CartesianState::set_position), "Setter of the position from three scalar coordinates", "x"_a, "y"_a, "z"_a);
@@ -222,6 +230,9 @@ void cartesian_pose(py::module_& m) {
   for (const std::string& attr : deleted_attributes) {
     c.def(std::string("get_" + attr).c_str(), [](const CartesianPose&) -> void {}, "Deleted method from parent class.");
     c.def(std::string("set_" + attr).c_str(), [](const CartesianPose& pose) -> CartesianPose { return pose; }, "Deleted method from parent class.");
+    if (py::hasattr(c, std::string("get_" + attr + "_view").c_str())) {
+      c.def(std::string("get_" + attr + "_view").c_str(), [](const CartesianPose&) -> void {}, "Deleted method from parent class.");
+    }
   }
 
   c.def(py::self *= py::self);
@@ -326,6 +337,9 @@ void cartesian_twist(py::module_& m) {
   for (const std::string& attr : deleted_attributes) {
     c.def(std::string("get_" + attr).c_str(), [](const CartesianTwist&) -> void {}, "Deleted method from parent class.");
     c.def(std::string("set_" + attr).c_str(), [](const CartesianTwist& twist) -> CartesianTwist { return twist; }, "Deleted method from parent class.");
+    if (py::hasattr(c, std::string("get_" + attr + "_view").c_str())) {
+      c.def(std::string("get_" + attr + "_view").c_str(), [](const CartesianTwist&) -> void {}, "Deleted method from parent class.");
+    }
   }
   c.def(std::string("get_orientation_coefficients").c_str(), [](const CartesianTwist&) -> void {}, "Deleted method from parent class.");
   c.def(std::string("set_pose_from_transformation_matrix").c_str(), [](const CartesianTwist&) -> void {}, "Deleted method from parent class.");
@@ -437,6 +451,9 @@ void cartesian_acceleration(py::module_& m) {
   for (const std::string& attr : deleted_attributes) {
     c.def(std::string("get_" + attr).c_str(), [](const CartesianAcceleration&) -> void {}, "Deleted method from parent class.");
     c.def(std::string("set_" + attr).c_str(), [](const CartesianAcceleration& acceleration) -> CartesianAcceleration { return acceleration; }, "Deleted method from parent class.");
+    if (py::hasattr(c, std::string("get_" + attr + "_view").c_str())) {
+      c.def(std::string("get_" + attr + "_view").c_str(), [](const CartesianAcceleration&) -> void {}, "Deleted method from parent class.");
+    }
   }
   c.def(std::string("get_orientation_coefficients").c_str(), [](const CartesianAcceleration&) -> void {}, "Deleted method from parent class.");
   c.def(std::string("set_pose_from_transformation_matrix").c_str(), [](const CartesianTwist&) -> void {}, "Deleted method from parent class.");
@@ -534,6 +551,9 @@ void cartesian_wrench(py::module_& m) {
   for (const std::string& attr : deleted_attributes) {
     c.def(std::string("get_" + attr).c_str(), [](const CartesianWrench&) -> void {}, "Deleted method from parent class.");
     c.def(std::string("set_" + attr).c_str(), [](const CartesianWrench& wrench) -> CartesianWrench { return wrench; }, "Deleted method from parent class.");
+    if (py::hasattr(c, std::string("get_" + attr + "_view").c_str())) {
+      c.def(std::string("get_" + attr + "_view").c_str(), [](const CartesianWrench&) -> void {}, "Deleted method from parent class.");
+    }
   }
   c.def(std::string("get_orientation_coefficients").c_str(), [](const CartesianWrench&) -> void {}, "Deleted method from parent class.");
   c.def(std::string("set_pose_from_transformation_matrix").c_str(), [](const CartesianTwist&) -> void {}, "Deleted method from parent class.");
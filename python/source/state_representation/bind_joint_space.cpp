@@ -49,6 +49,11 @@ void joint_state(py::module_& m) {
   c.def("get_torque", [](const JointState& joint_state, const std::string& joint_name) { return joint_state.get_torque(joint_name); }, "Get the torque of a joint by its name, if it exists.", "joint_name"_a);
   c.def("get_torque", [](const JointState& joint_state, unsigned int joint_index) { return joint_state.get_torque(joint_index); }, "Get the torque of a joint by its name, if it exists.", "joint_index"_a);
 
+  c.def("get_positions_view", [](const py::object& self) { return state_variable_view(self.cast<const JointState&>().get_positions_view(), self); }, "Getter of the positions attribute as a writable array sharing the memory of the state, without copy.");
+  c.def("get_velocities_view", [](const py::object& self) { return state_variable_view(self.cast<const JointState&>().get_velocities_view(), self); }, "Getter of the velocities attribute as a writable array sharing the memory of the state, without copy.");
+  c.def("get_accelerations_view", [](const py::object& self) { return state_variable_view(self.cast<const JointState&>().get_accelerations_view(), self); }, "Getter of the accelerations attribute as a writable array sharing the memory of the state, without copy.");
+  c.def("get_torques_view", [](const py::object& self) { return state_variable_view(self.cast<const JointState&>().get_torques_view(), self); }, "Getter of the torques attribute as a writable array sharing the memory of the state, without copy.");
+
   c.def("set_names", py::overload_cast<unsigned int>(&JointState::set_names), "Setter of the names attribute from the number of joints.", "nb_joints"_a);
   c.def("set_names", py::overload_cast<const std::vector<std::string>&>(&JointState::set_names), "Setter of the names attribute.", "names"_a);
   c.def("set_positions", py::overload_cast<const Eigen::VectorXd&>(&JointState::set_positions), "Setter of the positions attribute from a vector.", "positions"_a);
@@ -145,6 +150,9 @@ void joint_positions(py::module_& m) {
   for (const std::string& attr : deleted_attributes) {
     c.def(std::string("get_" + attr).c_str(), [](const JointPositions&) -> void {}, "Deleted method from parent class.");
     c.def(std::string("set_" + attr).c_str(), [](const JointPositions& positions) -> JointPositions { return positions; }, "Deleted method from parent class.");
+    if (py::hasattr(c, std::string("get_" + attr + "_view").c_str())) {
+      c.def(std::string("get_" + attr + "_view").c_str(), [](const JointPositions&) -> void {}, "Deleted method from parent class.");
+    }
   }
 
   c.def(py::self *= double());
@@ -235,6 +243,9 @@ void joint_velocities(py::module_& m) {
   for (const std::string& attr : deleted_attributes) {
     c.def(std::string("get_" + attr).c_str(), [](const JointVelocities&) -> void {}, "Deleted method from parent class.");
     c.def(std::string("set_" + attr).c_str(), [](const JointVelocities& velocities) -> JointVelocities { return velocities; }, "Deleted method from parent class.");
+    if (py::hasattr(c, std::string("get_" + attr + "_view").c_str())) {
+      c.def(std::string("get_" + attr + "_view").c_str(), [](const JointVelocities&) -> void {}, "Deleted method from parent class.");
+    }
   }
 
   c.def(py::self *= double());
@@ -337,6 +348,9 @@ void joint_accelerations(py::module_& m) {
   for (const std::string& attr : deleted_attributes) {
     c.def(std::string("get_" + attr).c_str(), [](const JointAccelerations&) -> void {}, "Deleted method from parent class.");
     c.def(std::string("set_" + attr).c_str(), [](const JointAccelerations& accelerations) -> JointAccelerations { return accelerations; }, "Deleted method from parent class.");
+    if (py::hasattr(c, std::string("get_" + attr + "_view").c_str())) {
+      c.def(std::string("get_" + attr + "_view").c_str(), [](const JointAccelerations&) -> void {}, "Deleted method from parent class.");
+    }
   }
 
   c.def(py::self *= double());
@@ -431,6 +445,9 @@ void joint_torques(py::module_& m) {
   for (const std::string& attr : deleted_attributes) {
     c.def(std::string("get_" + attr).c_str(), [](const JointTorques&) -> void {}, "Deleted method from parent class.");
     c.def(std::string("set_" + attr).c_str(), [](const JointTorques& torques) -> JointTorques { return torques; }, "Deleted method from parent class.");
+    if (py::hasattr(c, std::string("get_" + attr + "_view").c_str())) {
+      c.def(std::string("get_" + attr + "_view").c_str(), [](const JointTorques&) -> void {}, "Deleted method from parent class.");
+    }
   }
 
   c.def(py::self *= double());
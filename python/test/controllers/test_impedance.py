@@ -32,6 +32,25 @@ class TestImpedance(unittest.TestCase):
         command = ctrl.compute_command(desired_state, feedback_state)
         self.assertTrue(np.linalg.norm(command.data()) > 0)
 
+    def test_joint_impedance_batch(self):
+        nb_joints = 3
+        ctrl = create_joint_controller(CONTROLLER_TYPE.IMPEDANCE, nb_joints)
+
+        desired_state = sr.JointState("test", nb_joints)
+        feedback_state = sr.JointState("test", nb_joints)
+        desired_data = np.random.rand(10, desired_state.data().size)
+        feedback_data = np.random.rand(10, feedback_state.data().size)
+
+        commands = ctrl.compute_command_batch(desired_state, feedback_state, desired_data, feedback_data)
+        self.assertEqual(commands.shape, desired_data.shape)
+        for i in range(desired_data.shape[0]):
+            desired_state.set_data(desired_data[i, :])
+            feedback_state.set_data(feedback_data[i, :])
+            command = ctrl.compute_command(desired_state, feedback_state)
+            self.assertTrue(np.allclose(commands[i, :], command.data()))
+        self.assertRaises(ValueError, ctrl.compute_command_batch, desired_state, feedback_state, desired_data,
+                          feedback_data[:5, :])
+
     def test_cartesian_to_joint_impedance(self):
         ctrl = create_cartesian_controller(CONTROLLER_TYPE.IMPEDANCE)
 
@@ -1,3 +1,4 @@
+import numpy as np
 import state_representation as sr
 import unittest
 from datetime import timedelta
@@ -32,5 +33,18 @@ class TestJointPointAttractor(unittest.TestCase):
         self.assertTrue(current_state.dist(attractor, sr.JointStateVariable.POSITIONS) < 1e-3)
 
 
+    def test_evaluate_batch(self):
+        ds = create_joint_ds(DYNAMICAL_SYSTEM_TYPE.POINT_ATTRACTOR)
+        attractor = sr.JointPositions.Random("robot", 3)
+        ds.set_parameter(sr.Parameter("attractor", attractor, sr.ParameterType.STATE, sr.StateType.JOINT_STATE))
+
+        state = sr.JointState("robot", 3)
+        data = np.random.rand(10, state.data().size)
+        velocities = ds.evaluate_batch(state, data)
+        self.assertEqual(velocities.shape, data.shape)
+        for i in range(data.shape[0]):
+            state.set_data(data[i, :])
+            self.assertTrue(np.allclose(velocities[i, :], ds.evaluate(state).data()))
+
 if __name__ == '__main__':
     unittest.main()
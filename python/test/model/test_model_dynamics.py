@@ -69,6 +69,16 @@ class TestRobotModelDynamics(unittest.TestCase):
         [self.assertAlmostEqual(gravity_torques.get_torques()[i], self.test_gravity_expects[i], delta=self.tol) for i
          in range(7)]
 
+    def test_gravity_torques_batch(self):
+        batch = np.array([JointPositions().Random("robot", 7).get_positions() for _ in range(10)])
+        batch[0, :] = self.joint_state.get_positions()
+        gravity_torques = self.robot_model.compute_gravity_torques_batch(batch, nb_threads=2)
+        self.assertEqual(gravity_torques.shape, (10, 7))
+        [self.assertAlmostEqual(gravity_torques[0, i], self.test_gravity_expects[i], delta=self.tol) for i in range(7)]
+        for i in range(batch.shape[0]):
+            expected = self.robot_model.compute_gravity_torques(JointPositions("robot", batch[i, :])).get_torques()
+            [self.assertAlmostEqual(gravity_torques[i, j], expected[j], delta=self.tol) for j in range(7)]
+
 
 if __name__ == '__main__':
     unittest.main()
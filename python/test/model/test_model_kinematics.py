@@ -1,6 +1,7 @@
 import numpy as np
 import os
 import unittest
+from concurrent.futures import ThreadPoolExecutor
 from datetime import timedelta
 from robot_model import Model, InverseKinematicsParameters, QPInverseVelocityParameters
 from robot_model.exceptions import FrameNotFoundError, InvalidJointStateSizeError, InverseKinematicsNotConvergingErrors
@@ -91,6 +92,40 @@ class TestRobotModelKinematics(unittest.TestCase):
         X = self.robot_model.forward_kinematics(q, "panda_link8")
         self.assertTrue(max(abs(((reference - X) / dt).data())) < self.tol)
 
+    def test_ik_threads(self):
+        config = JointPositions("robot", self.robot_model.get_joint_frames(),
+                                [-0.059943, 1.667088, 1.439900, -1.367141, -1.164922, 0.948034, 2.239983])
+        param = InverseKinematicsParameters()
+        param.tolerance = self.tol
+        dt = timedelta(seconds=1)
+        reference = self.robot_model.forward_kinematics(config, "panda_link8")
+
+        # calls on the same model are serialized, copies of the model run in parallel
+        models = [self.robot_model, self.robot_model, Model(self.robot_model), Model(self.robot_model)]
+        with ThreadPoolExecutor(max_workers=len(models)) as executor:
+            solutions = list(executor.map(lambda model: model.inverse_kinematics(reference, param, "panda_link8"), models))
+        for q in solutions:
+            X = self.robot_model.forward_kinematics(q, "panda_link8")
+            self.assertTrue(max(abs(((reference - X) / dt).data())) < self.tol)
+
+    def test_kinematics_batch(self):
+        batch = np.array([JointPositions.Random("robot", self.robot_model.get_joint_frames()).get_positions()
+                          for _ in range(10)])
+        poses = self.robot_model.forward_kinematics_batch(batch, "panda_link4")
+        jacobians = self.robot_model.compute_jacobian_batch(batch, "panda_link4", nb_threads=3)
+        self.assertEqual(poses.shape, (10, 7))
+        self.assertEqual(jacobians.shape, (10, 6, 7))
+        self.assert_np_array_equal(self.robot_model.forward_kinematics_batch(batch, "panda_link4", nb_threads=4), poses)
+        for i in range(batch.shape[0]):
+            config = JointPositions("robot", self.robot_model.get_joint_frames(), batch[i, :])
+            self.assert_np_array_equal(poses[i, :],
+                                       self.robot_model.forward_kinematics(config, "panda_link4").get_pose())
+            self.assert_np_array_equal(jacobians[i, :, :].flatten(),
+                                       self.robot_model.compute_jacobian(config, "panda_link4").data().flatten())
+
+        dummy = np.zeros((10, 6))
+        self.assertRaises(InvalidJointStateSizeError, self.robot_model.forward_kinematics_batch, dummy)
+
     def test_ik_no_convergence(self):
         config = JointPositions("robot", self.robot_model.get_joint_frames(),
                                 [-0.059943, 1.667088, 1.439900, -1.367141, -1.164922, 0.948034, 2.239983])
@@ -25,17 +25,24 @@ CARTESIAN_STATE_METHOD_EXPECTS = [
     'dist',
     'get_acceleration',
     'get_angular_acceleration',
+    'get_angular_acceleration_view',
     'get_angular_velocity',
+    'get_angular_velocity_view',
     'get_force',
+    'get_force_view',
     'get_linear_acceleration',
+    'get_linear_acceleration_view',
     'get_linear_velocity',
+    'get_linear_velocity_view',
     'get_name',
     'get_orientation',
     'get_orientation_coefficients',
     'get_pose',
     'get_position',
+    'get_position_view',
     'get_reference_frame',
     'get_torque',
+    'get_torque_view',
     'get_transformation_matrix',
     'get_twist',
     'get_type',
@@ -466,6 +473,30 @@ class TestCartesianState(unittest.TestCase):
         with self.assertRaises(EmptyStateError):
             empty / scalar
 
+    def test_state_variable_views(self):
+        with self.assertRaises(EmptyStateError):
+            CartesianState("test").get_position_view()
+
+        cs = CartesianState.Random("test")
+        position = cs.get_position_view()
+        assert_array_equal(position, cs.get_position())
+        position[:] = [1.0, 2.0, 3.0]
+        assert_array_equal(cs.get_position(), [1.0, 2.0, 3.0])
+        cs.set_position(4.0, 5.0, 6.0)
+        assert_array_equal(position, [4.0, 5.0, 6.0])
+
+        force = CartesianState.Random("test").get_force_view()
+        force *= 2
+        self.assertEqual(force.shape, (3,))
+
+        views = [cs.get_linear_velocity_view(), cs.get_angular_velocity_view(), cs.get_linear_acceleration_view(),
+                 cs.get_angular_acceleration_view(), cs.get_force_view(), cs.get_torque_view()]
+        for view in views:
+            view[:] = [1.0, 2.0, 3.0]
+        assert_array_equal(cs.get_twist(), [1.0, 2.0, 3.0, 1.0, 2.0, 3.0])
+        assert_array_equal(cs.get_acceleration(), [1.0, 2.0, 3.0, 1.0, 2.0, 3.0])
+        assert_array_equal(cs.get_wrench(), [1.0, 2.0, 3.0, 1.0, 2.0, 3.0])
+
     def test_truthiness(self):
         empty = CartesianState("test")
         self.assertTrue(empty.is_empty())
@@ -4,7 +4,7 @@ import copy
 import numpy as np
 from state_representation import JointState, JointPositions, JointVelocities, JointAccelerations, JointTorques, \
     JointStateVariable, string_to_joint_state_variable, joint_state_variable_to_string
-from state_representation.exceptions import InvalidStateVariableError, IncompatibleSizeError
+from state_representation.exceptions import EmptyStateError, InvalidStateVariableError, IncompatibleSizeError
 from datetime import timedelta
 
 JOINT_STATE_METHOD_EXPECTS = [
@@ -17,17 +17,21 @@ JOINT_STATE_METHOD_EXPECTS = [
     'set_data',
     'dist',
     'get_accelerations',
+    'get_accelerations_view',
     'get_acceleration',
     'get_joint_index',
     'get_name',
     'get_names',
     'get_positions',
+    'get_positions_view',
     'get_position',
     'get_size',
     'get_torques',
+    'get_torques_view',
     'get_torque',
     'get_type',
     'get_velocities',
+    'get_velocities_view',
     'get_velocity',
     'reset',
     'is_incompatible',
@@ -470,6 +474,29 @@ class TestJointState(unittest.TestCase):
         with self.assertRaises(TypeError):
             torques / timedelta(seconds=1)
 
+    def test_state_variable_views(self):
+        state = JointState("test", 3)
+        with self.assertRaises(EmptyStateError):
+            state.get_positions_view()
+
+        state = JointState.Random("test", 3)
+        positions = state.get_positions_view()
+        self.assert_np_array_equal(positions, state.get_positions())
+        positions[:] = [1.0, 2.0, 3.0]
+        self.assert_np_array_equal(state.get_positions(), [1.0, 2.0, 3.0])
+        state.set_positions([4.0, 5.0, 6.0])
+        self.assert_np_array_equal(positions, [4.0, 5.0, 6.0])
+
+        torques = JointState.Random("test", 3).get_torques_view()
+        torques *= 2
+        self.assertEqual(torques.shape, (3,))
+
+        for view in [state.get_velocities_view(), state.get_accelerations_view(), state.get_torques_view()]:
+            view[0] = 10.0
+        self.assertEqual(state.get_velocity(0), 10.0)
+        self.assertEqual(state.get_acceleration(0), 10.0)
+        self.assertEqual(state.get_torque(0), 10.0)
+
     def test_utilities(self):
         state_variable_type = string_to_joint_state_variable("positions")
         self.assertIsInstance(state_variable_type, JointStateVariable)
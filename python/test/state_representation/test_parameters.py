@@ -127,3 +127,20 @@ def test_param_map():
         m.remove_parameter("int")
     with pytest.raises(sr.exceptions.InvalidParameterError):
         m.get_parameter("int")
+
+
+@pytest.mark.parametrize("name,value,parameter_type,state_type,test_func", parameters)
+def test_param_map_values(name, value, parameter_type, state_type, test_func):
+    param = sr.Parameter(name, value, parameter_type, state_type)
+    m = sr.ParameterMap([param])
+    test_func(m.get_parameter_value(name), value)
+    test_func(m.get_parameter(name).get_value(), value)
+
+    # the parameter map holds a copy of the parameter
+    param.reset()
+    assert param.is_empty()
+    assert not m.get_parameter(name).is_empty()
+    test_func(m.get_parameter_value(name), value)
+
+    with pytest.raises(sr.exceptions.InvalidCastError):
+        param.set_value(object())
@@ -1,4 +1,5 @@
 import pytest
+from concurrent.futures import ThreadPoolExecutor
 
 import clproto
 import numpy as np
@@ -137,6 +138,17 @@ def test_json_string_comparison():
                    "\"referenceFrame\":\"world\",\"rows\":6,\"cols\":3}}"
 
 
+def test_encode_decode_threads(helpers):
+    joint_states = [sr.JointState().Random("test", 7) for _ in range(64)]
+
+    def encode_decode(state):
+        return clproto.decode(clproto.encode(state, clproto.MessageType.JOINT_STATE_MESSAGE))
+
+    with ThreadPoolExecutor(max_workers=4) as executor:
+        for state, decoded in zip(joint_states, executor.map(encode_decode, joint_states)):
+            helpers.assert_state_equal(state, decoded)
+
+
 def test_decode_invalid_string():
     dummy_msg = "hello world"
     assert not clproto.is_valid(dummy_msg)
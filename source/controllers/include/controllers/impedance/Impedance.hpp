@@ -101,7 +101,8 @@ Impedance<S>::Impedance(
 template<class S>
 void Impedance<S>::clamp_force(Eigen::VectorXd& force) {
   if (*this->force_limit_) {
-    force = force.cwiseMax(-this->force_limit_->get_value()).cwiseMin(this->force_limit_->get_value());
+    const auto& force_limit = this->force_limit_->get_value_unchecked();
+    force = force.cwiseMax(-force_limit).cwiseMin(force_limit);
   }
 }
 
@@ -84,10 +84,10 @@ Eigen::MatrixXd Dissipative<JointState>::compute_orthonormal_basis(const JointSt
   }
   double tolerance = 1e-4;
   // only update the damping if the commanded velocity is non-null
-  if (desired_velocity.get_velocities().norm() < tolerance) {
+  if (desired_velocity.get_velocities_view().norm() < tolerance) {
     return Eigen::MatrixXd::Identity(this->dimensions_, this->dimensions_);
   }
   // return the full damping matrix
-  return Dissipative<JointState>::orthonormalize_basis(this->basis_, desired_velocity.get_velocities());
+  return Dissipative<JointState>::orthonormalize_basis(this->basis_, desired_velocity.get_velocities_view());
 }
 }// namespace controllers
\ No newline at end of file
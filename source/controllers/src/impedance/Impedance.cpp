@@ -17,28 +17,34 @@ template<>
 CartesianState Impedance<CartesianState>::compute_command(
     const CartesianState& command_state, const CartesianState& feedback_state
 ) {
+  // the subtraction validates both states, and the gains always hold a value, such that the control law reads the
+  // state variables and gains without checks
   CartesianState state_error = command_state - feedback_state;
+  const auto& stiffness = this->stiffness_->get_value_unchecked();
+  const auto& damping = this->damping_->get_value_unchecked();
+  const auto& inertia = this->inertia_->get_value_unchecked();
   // compute the wrench using the formula W = I * acc_desired + K * e_pose + D * e_twist
   CartesianState command(feedback_state.get_name(), feedback_state.get_reference_frame());
   // compute force
-  Eigen::Vector3d position_control = this->stiffness_->get_value().topLeftCorner<3, 3>() * state_error.get_position()
-      + this->damping_->get_value().topLeftCorner<3, 3>() * state_error.get_linear_velocity()
-      + this->inertia_->get_value().topLeftCorner<3, 3>() * command_state.get_linear_acceleration();
+  Eigen::Vector3d position_control = stiffness.topLeftCorner<3, 3>() * state_error.get_position_unchecked()
+      + damping.topLeftCorner<3, 3>() * state_error.get_linear_velocity_unchecked()
+      + inertia.topLeftCorner<3, 3>() * command_state.get_linear_acceleration_unchecked();
 
   // compute torque (orientation requires special care)
-  if (state_error.get_orientation().w() < 0) {
-    state_error.set_orientation(state_error.get_orientation().conjugate());
+  if (state_error.get_orientation_unchecked().w() < 0) {
+    state_error.set_orientation(state_error.get_orientation_unchecked().conjugate());
   }
   Eigen::Vector3d orientation_control =
-      this->stiffness_->get_value().bottomRightCorner<3, 3>() * state_error.get_orientation().vec()
-          + this->damping_->get_value().bottomRightCorner<3, 3>() * state_error.get_angular_velocity()
-          + this->inertia_->get_value().bottomRightCorner<3, 3>() * command_state.get_angular_acceleration();
+      stiffness.bottomRightCorner<3, 3>() * state_error.get_orientation_unchecked().vec()
+          + damping.bottomRightCorner<3, 3>() * state_error.get_angular_velocity_unchecked()
+          + inertia.bottomRightCorner<3, 3>() * command_state.get_angular_acceleration_unchecked();
 
   Eigen::VectorXd wrench(6);
   wrench << position_control, orientation_control;
   // if the 'feed_forward_force' parameter is set to true, also add the wrench error to the command
-  if (this->feed_forward_force_->get_value()) {
-    wrench += state_error.get_wrench();
+  if (this->feed_forward_force_->get_value_unchecked()) {
+    wrench.head<3>() += state_error.get_force_unchecked();
+    wrench.tail<3>() += state_error.get_torque_unchecked();
   }
   clamp_force(wrench);
 
@@ -50,17 +56,19 @@ template<>
 JointState Impedance<JointState>::compute_command(
     const JointState& command_state, const JointState& feedback_state
 ) {
+  // the subtraction validates both states, and the gains always hold a value
   JointState state_error = command_state - feedback_state;
   // compute the wrench using the formula T = I * acc_desired + K * e_pos + D * e_vel
   JointState command(feedback_state.get_name(), feedback_state.get_names());
   // compute torques
-  Eigen::VectorXd torque_control = this->stiffness_->get_value() * state_error.get_positions()
-      + this->damping_->get_value() * state_error.get_velocities()
-      + this->inertia_->get_value() * command_state.get_accelerations();
+  Eigen::VectorXd torque_control =
+      this->stiffness_->get_value_unchecked() * state_error.get_variable_map(JointStateVariable::POSITIONS)
+          + this->damping_->get_value_unchecked() * state_error.get_variable_map(JointStateVariable::VELOCITIES)
+          + this->inertia_->get_value_unchecked() * command_state.get_variable_map(JointStateVariable::ACCELERATIONS);
 
   // if the 'feed_forward_force' parameter is set to true, also add the torque error to the command
-  if (this->feed_forward_force_->get_value()) {
-    torque_control += state_error.get_torques();
+  if (this->feed_forward_force_->get_value_unchecked()) {
+    torque_control += state_error.get_variable_map(JointStateVariable::TORQUES);
   }
   clamp_force(torque_control);
 
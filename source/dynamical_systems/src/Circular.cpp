@@ -35,8 +35,8 @@ void Circular::set_limit_cycle(Ellipsoid& limit_cycle) {
         CartesianState::Identity(
             center.get_reference_frame(), center.get_reference_frame()));
   }
-  if (center.get_reference_frame() != this->get_base_frame().get_name()) {
-    if (center.get_reference_frame() != this->get_base_frame().get_reference_frame()) {
+  if (center.get_reference_frame_id() != this->get_base_frame().get_name_id()) {
+    if (center.get_reference_frame_id() != this->get_base_frame().get_reference_frame_id()) {
       throw state_representation::exceptions::IncompatibleReferenceFramesException(
           "The reference frame of the center " + center.get_name() + " in frame " + center.get_reference_frame()
               + " is incompatible with the base frame of the dynamical system " + this->get_base_frame().get_name()
@@ -82,34 +82,36 @@ void Circular::validate_and_set_parameter(const std::shared_ptr<ParameterInterfa
 }
 
 CartesianState Circular::compute_dynamics(const CartesianState& state) const {
-  if (this->limit_cycle_->get_value().is_empty()) {
+  const auto& limit_cycle = this->limit_cycle_->get_value();
+  if (limit_cycle.is_empty()) {
     throw exceptions::EmptyAttractorException("The limit cycle of the dynamical system is empty.");
   }
-  // put the point in the reference of the center
+  // put the point in the reference of the center, which validates the state
   auto pose = CartesianPose(state);
-  pose = this->limit_cycle_->get_value().get_rotation().inverse()
-      * this->limit_cycle_->get_value().get_center_pose().inverse() * pose;
+  pose = limit_cycle.get_rotation().inverse() * limit_cycle.get_center_pose().inverse() * pose;
+  const auto& position = pose.get_position_unchecked();
 
   CartesianTwist velocity(pose.get_name(), pose.get_reference_frame());
   Eigen::Vector3d linear_velocity;
-  linear_velocity(2) = -this->normal_gain_->get_value() * pose.get_position()(2);
+  linear_velocity(2) = -this->normal_gain_->get_value_unchecked() * position(2);
 
-  std::vector<double> radiuses = this->limit_cycle_->get_value().get_axis_lengths();
+  std::vector<double> radiuses = limit_cycle.get_axis_lengths();
 
-  double a2ratio = (pose.get_position()[0] * pose.get_position()[0]) / (radiuses[0] * radiuses[0]);
-  double b2ratio = (pose.get_position()[1] * pose.get_position()[1]) / (radiuses[1] * radiuses[1]);
-  double dradius = -this->planar_gain_->get_value() * radiuses[0] * radiuses[1] * (a2ratio + b2ratio - 1);
-  double tangent_velocity_x = -radiuses[0] / radiuses[1] * pose.get_position()[1];
-  double tangent_velocity_y = radiuses[1] / radiuses[0] * pose.get_position()[0];
+  double a2ratio = (position[0] * position[0]) / (radiuses[0] * radiuses[0]);
+  double b2ratio = (position[1] * position[1]) / (radiuses[1] * radiuses[1]);
+  double dradius = -this->planar_gain_->get_value_unchecked() * radiuses[0] * radiuses[1] * (a2ratio + b2ratio - 1);
+  double tangent_velocity_x = -radiuses[0] / radiuses[1] * position[1];
+  double tangent_velocity_y = radiuses[1] / radiuses[0] * position[0];
 
-  linear_velocity(0) = this->circular_velocity_->get_value() * tangent_velocity_x + dradius * tangent_velocity_y;
-  linear_velocity(1) = this->circular_velocity_->get_value() * tangent_velocity_y - dradius * tangent_velocity_x;
+  double circular_velocity = this->circular_velocity_->get_value_unchecked();
+  linear_velocity(0) = circular_velocity * tangent_velocity_x + dradius * tangent_velocity_y;
+  linear_velocity(1) = circular_velocity * tangent_velocity_y - dradius * tangent_velocity_x;
 
   velocity.set_linear_velocity(linear_velocity);
   velocity.set_angular_velocity(Eigen::Vector3d::Zero());
 
   //compute back the linear velocity in the desired frame
-  auto frame = this->limit_cycle_->get_value().get_center_pose() * this->limit_cycle_->get_value().get_rotation();
+  auto frame = limit_cycle.get_center_pose() * limit_cycle.get_rotation();
   return CartesianState(frame) * velocity;
 }
 }// namespace dynamical_systems
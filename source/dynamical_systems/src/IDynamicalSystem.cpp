@@ -18,8 +18,8 @@ bool IDynamicalSystem<S>::is_compatible(const S&) const {
 
 template<>
 bool IDynamicalSystem<CartesianState>::is_compatible(const CartesianState& state) const {
-  return !(state.get_reference_frame() != this->get_base_frame().get_name()
-      && state.get_reference_frame() != this->get_base_frame().get_reference_frame());
+  return !(state.get_reference_frame_id() != this->get_base_frame().get_name_id()
+      && state.get_reference_frame_id() != this->get_base_frame().get_reference_frame_id());
 }
 
 template<>
@@ -37,8 +37,8 @@ CartesianState IDynamicalSystem<CartesianState>::evaluate(const CartesianState&
   if (this->get_base_frame().is_empty()) {
     throw exceptions::EmptyBaseFrameException("The base frame of the dynamical system is empty.");
   }
-  if (state.get_reference_frame() != this->get_base_frame().get_name()) {
-    if (state.get_reference_frame() != this->get_base_frame().get_reference_frame()) {
+  if (state.get_reference_frame_id() != this->get_base_frame().get_name_id()) {
+    if (state.get_reference_frame_id() != this->get_base_frame().get_reference_frame_id()) {
       throw state_representation::exceptions::IncompatibleReferenceFramesException(
           "The evaluated state " + state.get_name() + " in frame " + state.get_reference_frame()
               + " is incompatible with the base frame of the dynamical system " + this->get_base_frame().get_name()
@@ -94,8 +94,8 @@ void PointAttractor<CartesianState>::set_attractor(const CartesianState& attract
         CartesianState::Identity(attractor.get_reference_frame(), attractor.get_reference_frame()));
   }
   // validate that the reference frame of the attractor is always compatible with the DS reference frame
-  if (attractor.get_reference_frame() != this->get_base_frame().get_name()) {
-    if (attractor.get_reference_frame() != this->get_base_frame().get_reference_frame()) {
+  if (attractor.get_reference_frame_id() != this->get_base_frame().get_name_id()) {
+    if (attractor.get_reference_frame_id() != this->get_base_frame().get_reference_frame_id()) {
       throw state_representation::exceptions::IncompatibleReferenceFramesException(
           "The reference frame of the attractor " + attractor.get_name() + " in frame "
               + attractor.get_reference_frame() + " is incompatible with the base frame of the dynamical system "
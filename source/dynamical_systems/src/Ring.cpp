@@ -44,8 +44,8 @@ void Ring::set_center(const CartesianPose& center) {
         CartesianState::Identity(center.get_reference_frame(), center.get_reference_frame()));
   }
   // validate that the reference frame of the center is always compatible with the DS reference frame
-  if (center.get_reference_frame() != this->get_base_frame().get_name()) {
-    if (center.get_reference_frame() != this->get_base_frame().get_reference_frame()) {
+  if (center.get_reference_frame_id() != this->get_base_frame().get_name_id()) {
+    if (center.get_reference_frame_id() != this->get_base_frame().get_reference_frame_id()) {
       throw state_representation::exceptions::IncompatibleReferenceFramesException(
           "The reference frame of the center " + center.get_name() + " in frame " + center.get_reference_frame()
               + " is incompatible with the base frame of the dynamical system " + this->get_base_frame().get_name()
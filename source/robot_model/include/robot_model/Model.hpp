@@ -1,5 +1,6 @@
 #pragma once
 
+#include <mutex>
 #include <string>
 #include <vector>
 #include <optional>
@@ -16,8 +17,10 @@
 #include <state_representation/space/Jacobian.hpp>
 #include <state_representation/space/joint/JointState.hpp>
 #include <state_representation/space/cartesian/CartesianState.hpp>
+#include <state_representation/trajectories/Trajectory.hpp>
 
 #include "robot_model/QPSolver.hpp"
+#include "robot_model/TimeParameterization.hpp"
 
 using namespace std::chrono_literals;
 
@@ -48,6 +51,9 @@ struct InverseKinematicsParameters {
  * @class Model
  * @brief The Model class is a wrapper around pinocchio dynamic computation library with state_representation
  * encapsulations.
+ * @details The kinematics and dynamics computations use the pinocchio data and the QP solver of the model
+ * as a workspace. Concurrent computations on the same instance are serialized by an internal lock, so computations
+ * only run in parallel on different instances, for example one copy of the model per thread.
  */
 class Model {
 private:
@@ -62,6 +68,7 @@ private:
   pinocchio::GeometryData geom_data_;     ///< the robot geometry data with pinocchio
   std::unique_ptr<QPSolver> qp_solver_;   ///< the QP solver for the inverse velocity kinematics
   bool load_collision_geometries_ = false;///< flag to load collision geometries
+  std::recursive_mutex mutex_;            ///< lock of the computation workspace, not copied or swapped
 
   /**
    * @brief Initialize the pinocchio model from the URDF
@@ -218,12 +225,19 @@ public:
    */
   Model(const Model& model);
 
+  /**
+   * @brief Move constructor
+   * @param model the model to move from, which is left without QP solver such that it can be destroyed, assigned or
+   * copied, but not used for the inverse velocity with a QP solver
+   */
+  Model(Model&& model) noexcept;
+
   /**
    * @brief Swap the values of the two Model
    * @param model1 Model to be swapped with 2
    * @param model2 Model to be swapped with 1
    */
-  friend void swap(Model& model1, Model& model2);
+  friend void swap(Model& model1, Model& model2) noexcept;
 
   /**
    * @brief Copy assignment operator that have to be defined due to the custom assignment operator
@@ -232,6 +246,13 @@ public:
    */
   Model& operator=(const Model& Model);
 
+  /**
+   * @brief Move assignment operator
+   * @param model the model to move from, which is left in a valid but unspecified state
+   * @return reference to the current model with new values
+   */
+  Model& operator=(Model&& model) noexcept;
+
   /**
    * @brief Creates a URDF file with desired path and name from a string (possibly the robot description
    * string from the ROS parameter server)
@@ -387,6 +408,21 @@ public:
    */
   state_representation::JointTorques compute_gravity_torques(const state_representation::JointPositions& joint_positions);
 
+  /**
+   * @brief Compute the time-optimal trajectory following a geometric joint path under the velocity and effort limits
+   * of the model and optional acceleration limits, using time-optimal path parameterization by reachability analysis
+   * @details The waypoints are interpolated by a cubic spline and the trajectory has one point per gridpoint of the
+   * parameterization, with the joint positions, velocities and accelerations of the robot at that point. The waypoints
+   * are among the gridpoints, and the trajectory starts and ends at rest.
+   * @param path the joint positions of the waypoints of the path
+   * @param parameters the parameters of the time parameterization
+   * @return the time-optimal trajectory
+   */
+  state_representation::Trajectory<state_representation::JointState> compute_time_optimal_trajectory(
+      const std::vector<state_representation::JointPositions>& path,
+      const TimeParameterizationParameters& parameters = TimeParameterizationParameters()
+  );
+
   /**
    * @brief Compute the forward kinematics, i.e. the pose of certain frames from the joint positions
    * @param joint_positions the joint state of the robot
@@ -560,7 +596,7 @@ inline const std::string& Model::get_robot_name() const {
   return this->robot_name_;
 }
 
-inline void swap(Model& first, Model& second) {
+inline void swap(Model& first, Model& second) noexcept {
   using std::swap;
   swap(first.robot_name_, second.robot_name_);
   swap(first.urdf_path_, second.urdf_path_);
@@ -580,6 +616,11 @@ inline Model& Model::operator=(const Model& model) {
   return *this;
 }
 
+inline Model& Model::operator=(Model&& model) noexcept {
+  swap(*this, model);
+  return *this;
+}
+
 inline void Model::set_robot_name(const std::string& robot_name) {
   this->robot_name_ = robot_name;
 }
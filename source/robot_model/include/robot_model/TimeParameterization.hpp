@@ -0,0 +1,154 @@
+#pragma once
+
+#include <vector>
+
+#include <eigen3/Eigen/Core>
+
+namespace robot_model {
+
+/**
+ * @brief parameters for the time-optimal parameterization of a joint path
+ * @param velocity_scaling scaling of the joint velocity limits of the URDF, no velocity constraints if 0
+ * @param acceleration_limits maximum joint accelerations (rad/s^2), no acceleration constraints if empty
+ * as they are not provided by the URDF
+ * @param effort_scaling scaling of the joint effort limits of the URDF, no effort constraints if 0
+ * @param nb_gridpoints number of gridpoints of a uniform grid over the path, setting the spacing of the gridpoints
+ */
+struct TimeParameterizationParameters {
+  double velocity_scaling = 1.0;
+  Eigen::VectorXd acceleration_limits = Eigen::VectorXd();
+  double effort_scaling = 1.0;
+  unsigned int nb_gridpoints = 100;
+};
+
+/**
+ * @class TimeParameterization
+ * @brief Time-optimal parameterization of a geometric joint path by reachability analysis (TOPP-RA).
+ * @details The waypoints are interpolated by a natural cubic spline q(s), where the path parameter s is the cumulative
+ * distance between the waypoints. Each segment between waypoints is divided into equal parts no longer than the spacing
+ * of a uniform grid with the given number of gridpoints, such that the constraints are enforced between sparse
+ * waypoints and the waypoints remain gridpoints. At each gridpoint, including the last one, the path acceleration
+ * u = s'' and the squared path velocity x = s'^2 are subject to first order constraints on x and to second order
+ * constraints lower <= a * u + b * x <= upper, the latter including joint accelerations and efforts. A backward pass
+ * computes the intervals of controllable x at each gridpoint, each by a two-dimensional linear program, and a forward
+ * pass greedily picks the largest path acceleration keeping the next state controllable. The path starts and ends
+ * at rest.
+ */
+class TimeParameterization {
+public:
+  /**
+   * @brief Constructor from the waypoints of the path
+   * @param waypoints the joint positions of the waypoints, at least two with the same size
+   * @param nb_gridpoints the number of gridpoints of a uniform grid over the path, at least two, setting the maximum
+   * spacing of the gridpoints
+   */
+  explicit TimeParameterization(const std::vector<Eigen::VectorXd>& waypoints, unsigned int nb_gridpoints = 100);
+
+  /**
+   * @brief Getter of the path parameter at each gridpoint
+   */
+  const Eigen::VectorXd& get_gridpoints() const;
+
+  /**
+   * @brief Getter of the joint positions at each gridpoint, one column per gridpoint
+   */
+  const Eigen::MatrixXd& get_path() const;
+
+  /**
+   * @brief Getter of the first derivative of the path with respect to the path parameter at each gridpoint
+   */
+  const Eigen::MatrixXd& get_path_first_derivatives() const;
+
+  /**
+   * @brief Getter of the second derivative of the path with respect to the path parameter at each gridpoint
+   */
+  const Eigen::MatrixXd& get_path_second_derivatives() const;
+
+  /**
+   * @brief Constrain the joint velocities, ignoring joints with a non-positive limit
+   * @param velocity_limits the maximum absolute joint velocities
+   */
+  void add_velocity_limits(const Eigen::VectorXd& velocity_limits);
+
+  /**
+   * @brief Constrain the joint accelerations, ignoring joints with a non-positive limit
+   * @param acceleration_limits the maximum absolute joint accelerations
+   */
+  void add_acceleration_limits(const Eigen::VectorXd& acceleration_limits);
+
+  /**
+   * @brief Add second order constraints lower <= a * u + b * x <= upper, one row per constraint and one column
+   * per gridpoint. Infinite bounds are ignored.
+   * @param a the coefficients of the path acceleration
+   * @param b the coefficients of the squared path velocity
+   * @param lower the lower bounds
+   * @param upper the upper bounds
+   */
+  void add_constraints(
+      const Eigen::MatrixXd& a, const Eigen::MatrixXd& b, const Eigen::MatrixXd& lower, const Eigen::MatrixXd& upper
+  );
+
+  /**
+   * @brief Compute the time-optimal parameterization under the added constraints
+   * @throws std::runtime_error if the path can not be followed under the constraints
+   */
+  void compute();
+
+  /**
+   * @brief Getter of the squared path velocity at each gridpoint
+   */
+  const Eigen::VectorXd& get_squared_path_velocities() const;
+
+  /**
+   * @brief Getter of the path acceleration at each gridpoint, the last one being the closest to the acceleration of
+   * the last segment that satisfies the constraints at rest
+   */
+  const Eigen::VectorXd& get_path_accelerations() const;
+
+  /**
+   * @brief Getter of the time in seconds at each gridpoint, starting at 0
+   */
+  const Eigen::VectorXd& get_times() const;
+
+private:
+  /**
+   * @brief Linear bounds on the path acceleration u at one gridpoint, as functions of the squared path velocity x,
+   * and bounds on x only
+   */
+  struct PathAccelerationBounds {
+    std::vector<Eigen::Vector2d> lower; ///< bounds u >= c(0) + c(1) * x
+    std::vector<Eigen::Vector2d> upper; ///< bounds u <= c(0) + c(1) * x
+    double x_min = 0; ///< lower bound of x
+    double x_max = 0; ///< upper bound of x
+
+    void add(double a, double b, double lower_bound, double upper_bound);
+    bool get_feasible_interval(double& interval_min, double& interval_max) const;
+    void get_acceleration_interval(double x, double& u_min, double& u_max) const;
+  };
+
+  /**
+   * @brief Collect the bounds of the constraints at a gridpoint
+   */
+  PathAccelerationBounds get_bounds(Eigen::Index index) const;
+
+  /**
+   * @brief Second order constraints lower <= a * u + b * x <= upper, one row per constraint and one column per gridpoint
+   */
+  struct SecondOrderConstraints {
+    Eigen::MatrixXd a;
+    Eigen::MatrixXd b;
+    Eigen::MatrixXd lower;
+    Eigen::MatrixXd upper;
+  };
+
+  Eigen::VectorXd gridpoints_; ///< path parameter at each gridpoint
+  Eigen::MatrixXd path_; ///< joint positions at each gridpoint
+  Eigen::MatrixXd first_derivatives_; ///< first derivative of the path at each gridpoint
+  Eigen::MatrixXd second_derivatives_; ///< second derivative of the path at each gridpoint
+  Eigen::VectorXd max_squared_velocities_; ///< first order bound on the squared path velocity at each gridpoint
+  std::vector<SecondOrderConstraints> constraints_; ///< second order constraints
+  Eigen::VectorXd squared_velocities_; ///< squared path velocity at each gridpoint
+  Eigen::VectorXd accelerations_; ///< path acceleration at each gridpoint
+  Eigen::VectorXd times_; ///< time at each gridpoint
+};
+}// namespace robot_model
@@ -1,3 +1,6 @@
+#include <chrono>
+#include <cmath>
+#include <limits>
 #include <regex>
 #include <set>
 #include <pinocchio/algorithm/frames.hpp>
@@ -37,7 +40,19 @@ Model::Model(const Model& other):
     meshloader_callback_(other.meshloader_callback_),
     geom_model_(other.geom_model_),
     geom_data_(other.geom_data_),
-    qp_solver_(std::make_unique<QPSolver>(*other.qp_solver_)),
+    qp_solver_(other.qp_solver_ ? std::make_unique<QPSolver>(*other.qp_solver_) : nullptr),
+    load_collision_geometries_(other.load_collision_geometries_) {}
+
+Model::Model(Model&& other) noexcept :
+    robot_name_(std::move(other.robot_name_)),
+    urdf_path_(std::move(other.urdf_path_)),
+    frames_(std::move(other.frames_)),
+    robot_model_(std::move(other.robot_model_)),
+    robot_data_(std::move(other.robot_data_)),
+    meshloader_callback_(std::move(other.meshloader_callback_)),
+    geom_model_(std::move(other.geom_model_)),
+    geom_data_(std::move(other.geom_data_)),
+    qp_solver_(std::move(other.qp_solver_)),
     load_collision_geometries_(other.load_collision_geometries_) {}
 
 bool Model::create_urdf_from_string(const std::string& urdf_string, const std::string& desired_path) {
@@ -172,6 +187,7 @@ bool Model::is_geometry_model_initialized() {
 }
 
 bool Model::check_collision(const state_representation::JointPositions& joint_positions) {
+  std::lock_guard<std::recursive_mutex> lock(this->mutex_);
   if (!this->is_geometry_model_initialized()) {
     throw robot_model::exceptions::CollisionGeometryException(
         "Geometry model not loaded for " + this->get_robot_name());
@@ -192,6 +208,7 @@ bool Model::check_collision(const state_representation::JointPositions& joint_po
 }
 
 Eigen::MatrixXd Model::compute_minimum_collision_distances(const state_representation::JointPositions& joint_positions) {
+  std::lock_guard<std::recursive_mutex> lock(this->mutex_);
   if (!this->is_geometry_model_initialized()) {
     throw robot_model::exceptions::CollisionGeometryException(
         "Geometry model not loaded for " + this->get_robot_name());
@@ -266,6 +283,7 @@ state_representation::Jacobian Model::compute_jacobian(const state_representatio
 
 state_representation::Jacobian Model::compute_jacobian(const state_representation::JointPositions& joint_positions,
                                                        const std::string& frame) {
+  std::lock_guard<std::recursive_mutex> lock(this->mutex_);
   auto frame_id = get_frame_id(frame);
   return this->compute_jacobian(joint_positions, frame_id);
 }
@@ -297,11 +315,13 @@ Eigen::MatrixXd Model::compute_jacobian_time_derivative(const state_representati
 Eigen::MatrixXd Model::compute_jacobian_time_derivative(const state_representation::JointPositions& joint_positions,
                                                         const state_representation::JointVelocities& joint_velocities,
                                                         const std::string& frame) {
+  std::lock_guard<std::recursive_mutex> lock(this->mutex_);
   auto frame_id = get_frame_id(frame);
   return this->compute_jacobian_time_derivative(joint_positions, joint_velocities, frame_id);
 }
 
 Eigen::MatrixXd Model::compute_inertia_matrix(const state_representation::JointPositions& joint_positions) {
+  std::lock_guard<std::recursive_mutex> lock(this->mutex_);
   // compute only the upper part of the triangular inertia matrix stored in robot_data_.M
   pinocchio::crba(this->robot_model_, this->robot_data_, joint_positions.data());
   // copy the symmetric lower part
@@ -311,34 +331,104 @@ Eigen::MatrixXd Model::compute_inertia_matrix(const state_representation::JointP
 }
 
 state_representation::JointTorques Model::compute_inertia_torques(const state_representation::JointState& joint_state) {
+  std::lock_guard<std::recursive_mutex> lock(this->mutex_);
   Eigen::MatrixXd inertia = this->compute_inertia_matrix(joint_state);
   return state_representation::JointTorques(joint_state.get_name(),
                                             joint_state.get_names(),
-                                            inertia * joint_state.get_accelerations());
+                                            inertia * joint_state.get_accelerations_view());
 }
 
 Eigen::MatrixXd Model::compute_coriolis_matrix(const state_representation::JointState& joint_state) {
+  std::lock_guard<std::recursive_mutex> lock(this->mutex_);
   return pinocchio::computeCoriolisMatrix(this->robot_model_,
                                           this->robot_data_,
-                                          joint_state.get_positions(),
-                                          joint_state.get_velocities());
+                                          joint_state.get_positions_view(),
+                                          joint_state.get_velocities_view());
 }
 
 state_representation::JointTorques
 Model::compute_coriolis_torques(const state_representation::JointState& joint_state) {
+  std::lock_guard<std::recursive_mutex> lock(this->mutex_);
   Eigen::MatrixXd coriolis_matrix = this->compute_coriolis_matrix(joint_state);
   return state_representation::JointTorques(joint_state.get_name(),
                                             joint_state.get_names(),
-                                            coriolis_matrix * joint_state.get_velocities());
+                                            coriolis_matrix * joint_state.get_velocities_view());
 }
 
 state_representation::JointTorques
 Model::compute_gravity_torques(const state_representation::JointPositions& joint_positions) {
+  std::lock_guard<std::recursive_mutex> lock(this->mutex_);
   Eigen::VectorXd gravity_torque =
       pinocchio::computeGeneralizedGravity(this->robot_model_, this->robot_data_, joint_positions.data());
   return state_representation::JointTorques(joint_positions.get_name(), joint_positions.get_names(), gravity_torque);
 }
 
+state_representation::Trajectory<state_representation::JointState> Model::compute_time_optimal_trajectory(
+    const std::vector<state_representation::JointPositions>& path, const TimeParameterizationParameters& parameters
+) {
+  std::lock_guard<std::recursive_mutex> lock(this->mutex_);
+  std::vector<Eigen::VectorXd> waypoints;
+  waypoints.reserve(path.size());
+  for (const auto& joint_positions : path) {
+    if (joint_positions.get_size() != this->get_number_of_joints()) {
+      throw exceptions::InvalidJointStateSizeException(joint_positions.get_size(), this->get_number_of_joints());
+    }
+    waypoints.push_back(joint_positions.data());
+  }
+  TimeParameterization parameterization(waypoints, parameters.nb_gridpoints);
+  if (parameters.velocity_scaling > 0) {
+    parameterization.add_velocity_limits(parameters.velocity_scaling * this->robot_model_.velocityLimit);
+  }
+  if (parameters.acceleration_limits.size() > 0) {
+    parameterization.add_acceleration_limits(parameters.acceleration_limits);
+  }
+
+  const Eigen::MatrixXd& q = parameterization.get_path();
+  const Eigen::MatrixXd& dq = parameterization.get_path_first_derivatives();
+  const Eigen::MatrixXd& ddq = parameterization.get_path_second_derivatives();
+  auto nb_points = q.cols();
+  if (parameters.effort_scaling > 0) {
+    // tau = M(q) (q' u + q'' x) + C(q, q') q' x + g(q) = a u + b x + g(q)
+    Eigen::VectorXd effort_limits = parameters.effort_scaling * this->robot_model_.effortLimit;
+    for (Eigen::Index j = 0; j < effort_limits.size(); ++j) {
+      if (effort_limits(j) <= 0) {
+        effort_limits(j) = std::numeric_limits<double>::infinity();
+      }
+    }
+    Eigen::VectorXd zero = Eigen::VectorXd::Zero(this->robot_model_.nv);
+    Eigen::MatrixXd a(this->robot_model_.nv, nb_points);
+    Eigen::MatrixXd b(this->robot_model_.nv, nb_points);
+    Eigen::MatrixXd lower(this->robot_model_.nv, nb_points);
+    Eigen::MatrixXd upper(this->robot_model_.nv, nb_points);
+    for (Eigen::Index i = 0; i < nb_points; ++i) {
+      Eigen::VectorXd gravity =
+          pinocchio::computeGeneralizedGravity(this->robot_model_, this->robot_data_, q.col(i));
+      a.col(i) = pinocchio::rnea(this->robot_model_, this->robot_data_, q.col(i), zero, dq.col(i)) - gravity;
+      b.col(i) = pinocchio::rnea(this->robot_model_, this->robot_data_, q.col(i), dq.col(i), ddq.col(i)) - gravity;
+      lower.col(i) = -effort_limits - gravity;
+      upper.col(i) = effort_limits - gravity;
+    }
+    parameterization.add_constraints(a, b, lower, upper);
+  }
+  parameterization.compute();
+
+  const Eigen::VectorXd& x = parameterization.get_squared_path_velocities();
+  const Eigen::VectorXd& u = parameterization.get_path_accelerations();
+  const Eigen::VectorXd& times = parameterization.get_times();
+  state_representation::Trajectory<state_representation::JointState> trajectory(this->robot_name_ + "_trajectory");
+  state_representation::JointState point(this->robot_name_, this->get_joint_frames());
+  std::chrono::nanoseconds previous_time(0);
+  for (Eigen::Index i = 0; i < nb_points; ++i) {
+    point.set_positions(q.col(i));
+    point.set_velocities(dq.col(i) * std::sqrt(x(i)));
+    point.set_accelerations(dq.col(i) * u(i) + ddq.col(i) * x(i));
+    std::chrono::nanoseconds time(static_cast<int64_t>(std::round(times(i) * 1e9)));
+    trajectory.add_point(point, time - previous_time);
+    previous_time = time;
+  }
+  return trajectory;
+}
+
 state_representation::CartesianPose Model::forward_kinematics(const state_representation::JointPositions& joint_positions,
                                                               unsigned int frame_id) {
   return this->forward_kinematics(joint_positions, std::vector<unsigned int>{frame_id}).front();
@@ -371,12 +461,14 @@ std::vector<state_representation::CartesianPose> Model::forward_kinematics(const
 
 state_representation::CartesianPose Model::forward_kinematics(const state_representation::JointPositions& joint_positions,
                                                               const std::string& frame) {
+  std::lock_guard<std::recursive_mutex> lock(this->mutex_);
   std::string actual_frame = frame.empty() ? this->robot_model_.frames.back().name : frame;
   return this->forward_kinematics(joint_positions, std::vector<std::string>{actual_frame}).front();
 }
 
 std::vector<state_representation::CartesianPose> Model::forward_kinematics(const state_representation::JointPositions& joint_positions,
                                                                            const std::vector<std::string>& frames) {
+  std::lock_guard<std::recursive_mutex> lock(this->mutex_);
   auto frame_ids = get_frame_ids(frames);
   return this->forward_kinematics(joint_positions, frame_ids);
 }
@@ -384,7 +476,7 @@ std::vector<state_representation::CartesianPose> Model::forward_kinematics(const
 Eigen::MatrixXd
 Model::cwln_weighted_matrix(const state_representation::JointPositions& joint_positions, const double margin) {
   Eigen::VectorXd diag = Eigen::VectorXd::Ones(joint_positions.get_size());
-  const auto positions = joint_positions.get_positions();
+  const auto positions = joint_positions.get_positions_view();
   for (int i = 0; i < positions.size(); ++i) {
     if (positions(i) < this->robot_model_.lowerPositionLimit(i) + margin) {
       if (positions(i) < this->robot_model_.lowerPositionLimit(i)) {
@@ -408,7 +500,7 @@ Model::cwln_weighted_matrix(const state_representation::JointPositions& joint_po
 Eigen::VectorXd
 Model::cwln_repulsive_potential_field(const state_representation::JointPositions& joint_positions, double margin) {
   Eigen::VectorXd psi = Eigen::VectorXd::Zero(joint_positions.get_size());
-  const auto positions = joint_positions.get_positions();
+  const auto positions = joint_positions.get_positions_view();
   for (int i = 0; i < positions.size(); ++i) {
     if (positions(i) < this->robot_model_.lowerPositionLimit(i) + margin) {
       psi(i) = this->robot_model_.upperPositionLimit(i) - margin
@@ -425,6 +517,7 @@ state_representation::JointPositions Model::inverse_kinematics(
     const state_representation::CartesianPose& cartesian_pose,
     const state_representation::JointPositions& joint_positions, const InverseKinematicsParameters& parameters,
     const std::string& frame) {
+  std::lock_guard<std::recursive_mutex> lock(this->mutex_);
   std::string actual_frame = frame.empty() ? this->robot_model_.frames.back().name : frame;
   if (!this->robot_model_.existFrame(actual_frame)) {
     throw exceptions::FrameNotFoundException(actual_frame);
@@ -446,7 +539,7 @@ state_representation::JointPositions Model::inverse_kinematics(
     Eigen::VectorXd qd(this->robot_model_.nv);
     Eigen::MatrixXd J = Eigen::MatrixXd::Zero(6, this->robot_model_.nv);
     for (unsigned int i = 0; i < parameters.max_number_of_iterations; ++i) {
-      pinocchio::forwardKinematics(this->robot_model_, this->robot_data_, q.get_positions());
+      pinocchio::forwardKinematics(this->robot_model_, this->robot_data_, q.get_positions_view());
       const pinocchio::SE3 iMd = this->robot_data_.oMi[joint_id].actInv(oMdes);
       err = pinocchio::log6(iMd).toVector();
       if (err.norm() < parameters.tolerance) {
@@ -456,7 +549,7 @@ state_representation::JointPositions Model::inverse_kinematics(
         }
         return q;
       }
-      pinocchio::computeJointJacobian(this->robot_model_, this->robot_data_, q.get_positions(), joint_id, J);
+      pinocchio::computeJointJacobian(this->robot_model_, this->robot_data_, q.get_positions_view(), joint_id, J);
       pinocchio::Data::Matrix6 Jlog;
       pinocchio::Jlog6(iMd.inverse(), Jlog);
       J = -Jlog * J;
@@ -468,7 +561,7 @@ state_representation::JointPositions Model::inverse_kinematics(
       JJt.noalias() = J_b * J_b.transpose();
       JJt.diagonal().array() += parameters.damp;
       qd.noalias() = W_c * psi - parameters.alpha * W_b * (J_b.transpose() * JJt.ldlt().solve(err - J * W_c * psi));
-      q.set_positions(pinocchio::integrate(this->robot_model_, q.get_positions(), qd * dt));
+      q.set_positions(pinocchio::integrate(this->robot_model_, q.get_positions_view(), qd * dt));
     }
     q.set_positions(pinocchio::randomConfiguration(this->robot_model_));
     ++retries;
@@ -480,6 +573,7 @@ state_representation::JointPositions
 Model::inverse_kinematics(const state_representation::CartesianPose& cartesian_pose,
                           const InverseKinematicsParameters& parameters,
                           const std::string& frame) {
+  std::lock_guard<std::recursive_mutex> lock(this->mutex_);
   state_representation::JointPositions positions(this->get_robot_name(), this->get_joint_frames());
   return this->inverse_kinematics(cartesian_pose, positions, parameters, frame);
 }
@@ -487,6 +581,7 @@ Model::inverse_kinematics(const state_representation::CartesianPose& cartesian_p
 std::vector<state_representation::CartesianTwist>
 Model::forward_velocity(const state_representation::JointState& joint_state,
                         const std::vector<std::string>& frames) {
+  std::lock_guard<std::recursive_mutex> lock(this->mutex_);
   std::vector<state_representation::CartesianTwist> cartesian_twists(frames.size());
   for (std::size_t i = 0; i < frames.size(); ++i) {
     cartesian_twists.at(i) = this->compute_jacobian(joint_state, frames.at(i))
@@ -497,6 +592,7 @@ Model::forward_velocity(const state_representation::JointState& joint_state,
 
 state_representation::CartesianTwist Model::forward_velocity(const state_representation::JointState& joint_state,
                                                              const std::string& frame) {
+  std::lock_guard<std::recursive_mutex> lock(this->mutex_);
   return this->forward_velocity(joint_state, std::vector<std::string>{frame}).front();
 }
 
@@ -521,8 +617,12 @@ Model::inverse_velocity(const std::vector<state_representation::CartesianTwist>&
                         const state_representation::JointPositions& joint_positions,
                         const std::vector<std::string>& frames,
                         const double dls_lambda) {
+  std::lock_guard<std::recursive_mutex> lock(this->mutex_);
   // sanity check
   this->check_inverse_velocity_arguments(cartesian_twists, joint_positions, frames);
+  if (!this->qp_solver_) {
+    throw std::runtime_error("The model " + this->get_robot_name() + " has been moved from and has no QP solver");
+  }
 
   const unsigned int nb_joints = this->get_number_of_joints();
   // the velocity vector contains position of the intermediate frame and full pose of the end-effector
@@ -564,6 +664,7 @@ state_representation::JointVelocities Model::inverse_velocity(const state_repres
                                                               const state_representation::JointPositions& joint_positions,
                                                               const std::string& frame,
                                                               const double dls_lambda) {
+  std::lock_guard<std::recursive_mutex> lock(this->mutex_);
   std::string actual_frame = frame.empty() ? this->robot_model_.frames.back().name : frame;
   return this->inverse_velocity(std::vector<state_representation::CartesianTwist>({cartesian_twist}),
                                 joint_positions,
@@ -576,10 +677,14 @@ Model::inverse_velocity(const std::vector<state_representation::CartesianTwist>&
                         const state_representation::JointPositions& joint_positions,
                         const QPInverseVelocityParameters& parameters,
                         const std::vector<std::string>& frames) {
+  std::lock_guard<std::recursive_mutex> lock(this->mutex_);
   using namespace state_representation;
   using namespace std::chrono;
   // sanity check
   this->check_inverse_velocity_arguments(cartesian_twists, joint_positions, frames);
+  if (!this->qp_solver_) {
+    throw std::runtime_error("The model " + this->get_robot_name() + " has been moved from and has no QP solver");
+  }
 
   const unsigned int nb_joints = this->get_number_of_joints();
   // the velocity vector contains position of the intermediate frame and full pose of the end-effector
@@ -627,6 +732,7 @@ state_representation::JointVelocities Model::inverse_velocity(const state_repres
                                                               const state_representation::JointPositions& joint_positions,
                                                               const QPInverseVelocityParameters& parameters,
                                                               const std::string& frame) {
+  std::lock_guard<std::recursive_mutex> lock(this->mutex_);
   std::string actual_frame = frame.empty() ? this->robot_model_.frames.back().name : frame;
   return this->inverse_velocity(std::vector<state_representation::CartesianTwist>({cartesian_twist}),
                                 joint_positions,
@@ -641,19 +747,19 @@ bool Model::in_range(const Eigen::VectorXd& vector,
 }
 
 bool Model::in_range(const state_representation::JointPositions& joint_positions) const {
-  return this->in_range(joint_positions.get_positions(),
+  return this->in_range(joint_positions.get_positions_view(),
                         this->robot_model_.lowerPositionLimit,
                         this->robot_model_.upperPositionLimit);
 }
 
 bool Model::in_range(const state_representation::JointVelocities& joint_velocities) const {
-  return this->in_range(joint_velocities.get_velocities(),
+  return this->in_range(joint_velocities.get_velocities_view(),
                         -this->robot_model_.velocityLimit,
                         this->robot_model_.velocityLimit);
 }
 
 bool Model::in_range(const state_representation::JointTorques& joint_torques) const {
-  return this->in_range(joint_torques.get_torques(), -this->robot_model_.effortLimit, this->robot_model_.effortLimit);
+  return this->in_range(joint_torques.get_torques_view(), -this->robot_model_.effortLimit, this->robot_model_.effortLimit);
 }
 
 bool Model::in_range(const state_representation::JointState& joint_state) const {
@@ -676,15 +782,15 @@ state_representation::JointState Model::clamp_in_range(
   switch (state_variable_type) {
     case JointStateVariable::POSITIONS:
       clamped_vector = this->clamp_in_range(
-          joint_state.get_positions(), this->robot_model_.lowerPositionLimit, this->robot_model_.upperPositionLimit);
+          joint_state.get_positions_view(), this->robot_model_.lowerPositionLimit, this->robot_model_.upperPositionLimit);
       break;
     case JointStateVariable::VELOCITIES:
       clamped_vector = this->clamp_in_range(
-          joint_state.get_velocities(), -this->robot_model_.velocityLimit, this->robot_model_.velocityLimit);
+          joint_state.get_velocities_view(), -this->robot_model_.velocityLimit, this->robot_model_.velocityLimit);
       break;
     case JointStateVariable::TORQUES:
       clamped_vector = this->clamp_in_range(
-          joint_state.get_torques(), -this->robot_model_.effortLimit, this->robot_model_.effortLimit);
+          joint_state.get_torques_view(), -this->robot_model_.effortLimit, this->robot_model_.effortLimit);
       break;
     default:
       return joint_state;
@@ -696,13 +802,13 @@ state_representation::JointState Model::clamp_in_range(
 
 state_representation::JointState Model::clamp_in_range(const state_representation::JointState& joint_state) const {
   state_representation::JointState joint_state_clamped(joint_state);
-  joint_state_clamped.set_positions(this->clamp_in_range(joint_state.get_positions(),
+  joint_state_clamped.set_positions(this->clamp_in_range(joint_state.get_positions_view(),
                                                          this->robot_model_.lowerPositionLimit,
                                                          this->robot_model_.upperPositionLimit));
-  joint_state_clamped.set_velocities(this->clamp_in_range(joint_state.get_velocities(),
+  joint_state_clamped.set_velocities(this->clamp_in_range(joint_state.get_velocities_view(),
                                                           -this->robot_model_.velocityLimit,
                                                           this->robot_model_.velocityLimit));
-  joint_state_clamped.set_torques(this->clamp_in_range(joint_state.get_torques(),
+  joint_state_clamped.set_torques(this->clamp_in_range(joint_state.get_torques_view(),
                                                        -this->robot_model_.effortLimit,
                                                        this->robot_model_.effortLimit));
   return joint_state_clamped;
@@ -0,0 +1,306 @@
+#include "robot_model/TimeParameterization.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+namespace robot_model {
+
+static constexpr double EPSILON = 1e-9;
+
+TimeParameterization::TimeParameterization(const std::vector<Eigen::VectorXd>& waypoints, unsigned int nb_gridpoints) {
+  if (waypoints.size() < 2) {
+    throw std::invalid_argument("The path must contain at least two waypoints");
+  }
+  if (nb_gridpoints < 2) {
+    throw std::invalid_argument("The path must be subdivided into at least two gridpoints");
+  }
+  auto nb_waypoints = static_cast<Eigen::Index>(waypoints.size());
+  auto dimension = waypoints.front().size();
+  Eigen::MatrixXd knots(dimension, nb_waypoints);
+  Eigen::VectorXd knot_parameters(nb_waypoints);
+  knot_parameters(0) = 0;
+  for (Eigen::Index i = 0; i < nb_waypoints; ++i) {
+    if (waypoints[i].size() != dimension) {
+      throw std::invalid_argument(
+          "The waypoint " + std::to_string(i) + " is of size " + std::to_string(waypoints[i].size()) + " instead of "
+              + std::to_string(dimension));
+    }
+    knots.col(i) = waypoints[i];
+    if (i > 0) {
+      double chord = (knots.col(i) - knots.col(i - 1)).norm();
+      if (chord < EPSILON) {
+        throw std::invalid_argument("The waypoints " + std::to_string(i - 1) + " and " + std::to_string(i) + " are equal");
+      }
+      knot_parameters(i) = knot_parameters(i - 1) + chord;
+    }
+  }
+
+  // second derivatives of the natural cubic spline, solving the tridiagonal system with the Thomas algorithm
+  Eigen::VectorXd h = knot_parameters.tail(nb_waypoints - 1) - knot_parameters.head(nb_waypoints - 1);
+  Eigen::MatrixXd knot_second_derivatives = Eigen::MatrixXd::Zero(dimension, nb_waypoints);
+  if (nb_waypoints > 2) {
+    Eigen::VectorXd diagonal(nb_waypoints);
+    Eigen::MatrixXd rhs = Eigen::MatrixXd::Zero(dimension, nb_waypoints);
+    for (Eigen::Index i = 1; i < nb_waypoints - 1; ++i) {
+      diagonal(i) = 2 * (h(i - 1) + h(i));
+      rhs.col(i) = 6 * ((knots.col(i + 1) - knots.col(i)) / h(i) - (knots.col(i) - knots.col(i - 1)) / h(i - 1));
+    }
+    for (Eigen::Index i = 2; i < nb_waypoints - 1; ++i) {
+      double factor = h(i - 1) / diagonal(i - 1);
+      diagonal(i) -= factor * h(i - 1);
+      rhs.col(i) -= factor * rhs.col(i - 1);
+    }
+    for (Eigen::Index i = nb_waypoints - 2; i > 0; --i) {
+      knot_second_derivatives.col(i) = (rhs.col(i) - h(i) * knot_second_derivatives.col(i + 1)) / diagonal(i);
+    }
+  }
+
+  // each segment between waypoints is split in equal parts no longer than the spacing of a uniform grid over the path,
+  // such that the constraints are enforced along the whole path and the waypoints remain gridpoints
+  double spacing = knot_parameters(nb_waypoints - 1) / (nb_gridpoints - 1);
+  std::vector<Eigen::Index> nb_parts(nb_waypoints - 1);
+  Eigen::Index nb_points = 1;
+  for (Eigen::Index k = 0; k < nb_waypoints - 1; ++k) {
+    nb_parts[k] = std::max<Eigen::Index>(1, static_cast<Eigen::Index>(std::ceil(h(k) / spacing - EPSILON)));
+    nb_points += nb_parts[k];
+  }
+  this->gridpoints_.resize(nb_points);
+  this->path_.resize(dimension, nb_points);
+  this->first_derivatives_.resize(dimension, nb_points);
+  this->second_derivatives_.resize(dimension, nb_points);
+  Eigen::Index index = 0;
+  for (Eigen::Index k = 0; k < nb_waypoints - 1; ++k) {
+    Eigen::VectorXd slope = (knots.col(k + 1) - knots.col(k)) / h(k)
+        - h(k) * (knot_second_derivatives.col(k + 1) - knot_second_derivatives.col(k)) / 6;
+    // the last segment also evaluates its end, which is the last waypoint
+    Eigen::Index nb_evaluations = k < nb_waypoints - 2 ? nb_parts[k] : nb_parts[k] + 1;
+    for (Eigen::Index part = 0; part < nb_evaluations; ++part, ++index) {
+      double t = static_cast<double>(part) / nb_parts[k];
+      double before = t * h(k);
+      double after = h(k) - before;
+      this->gridpoints_(index) = part == nb_parts[k] ? knot_parameters(k + 1) : knot_parameters(k) + before;
+      this->path_.col(index) = knot_second_derivatives.col(k) * after * after * after / (6 * h(k))
+          + knot_second_derivatives.col(k + 1) * before * before * before / (6 * h(k))
+          + (knots.col(k) / h(k) - knot_second_derivatives.col(k) * h(k) / 6) * after
+          + (knots.col(k + 1) / h(k) - knot_second_derivatives.col(k + 1) * h(k) / 6) * before;
+      this->first_derivatives_.col(index) = -knot_second_derivatives.col(k) * after * after / (2 * h(k))
+          + knot_second_derivatives.col(k + 1) * before * before / (2 * h(k)) + slope;
+      this->second_derivatives_.col(index) =
+          (knot_second_derivatives.col(k) * after + knot_second_derivatives.col(k + 1) * before) / h(k);
+    }
+  }
+
+  this->max_squared_velocities_ = Eigen::VectorXd::Constant(nb_points, std::numeric_limits<double>::infinity());
+}
+
+const Eigen::VectorXd& TimeParameterization::get_gridpoints() const {
+  return this->gridpoints_;
+}
+
+const Eigen::MatrixXd& TimeParameterization::get_path() const {
+  return this->path_;
+}
+
+const Eigen::MatrixXd& TimeParameterization::get_path_first_derivatives() const {
+  return this->first_derivatives_;
+}
+
+const Eigen::MatrixXd& TimeParameterization::get_path_second_derivatives() const {
+  return this->second_derivatives_;
+}
+
+void TimeParameterization::add_velocity_limits(const Eigen::VectorXd& velocity_limits) {
+  if (velocity_limits.size() != this->path_.rows()) {
+    throw std::invalid_argument(
+        "The velocity limits are of size " + std::to_string(velocity_limits.size()) + " instead of "
+            + std::to_string(this->path_.rows()));
+  }
+  for (Eigen::Index i = 0; i < this->path_.cols(); ++i) {
+    for (Eigen::Index j = 0; j < this->path_.rows(); ++j) {
+      double derivative = std::abs(this->first_derivatives_(j, i));
+      if (velocity_limits(j) > 0 && derivative > EPSILON) {
+        double max_velocity = velocity_limits(j) / derivative;
+        this->max_squared_velocities_(i) = std::min(this->max_squared_velocities_(i), max_velocity * max_velocity);
+      }
+    }
+  }
+}
+
+void TimeParameterization::add_acceleration_limits(const Eigen::VectorXd& acceleration_limits) {
+  if (acceleration_limits.size() != this->path_.rows()) {
+    throw std::invalid_argument(
+        "The acceleration limits are of size " + std::to_string(acceleration_limits.size()) + " instead of "
+            + std::to_string(this->path_.rows()));
+  }
+  Eigen::VectorXd limits = acceleration_limits;
+  for (Eigen::Index j = 0; j < limits.size(); ++j) {
+    if (limits(j) <= 0) {
+      limits(j) = std::numeric_limits<double>::infinity();
+    }
+  }
+  Eigen::MatrixXd upper = limits.replicate(1, this->path_.cols());
+  this->add_constraints(this->first_derivatives_, this->second_derivatives_, -upper, upper);
+}
+
+void TimeParameterization::add_constraints(
+    const Eigen::MatrixXd& a, const Eigen::MatrixXd& b, const Eigen::MatrixXd& lower, const Eigen::MatrixXd& upper
+) {
+  auto nb_points = this->path_.cols();
+  if (a.cols() != nb_points || b.cols() != nb_points || lower.cols() != nb_points || upper.cols() != nb_points) {
+    throw std::invalid_argument("The constraints must have one column per gridpoint");
+  }
+  if (b.rows() != a.rows() || lower.rows() != a.rows() || upper.rows() != a.rows()) {
+    throw std::invalid_argument("The constraint coefficients and bounds must have the same number of rows");
+  }
+  this->constraints_.push_back(SecondOrderConstraints{a, b, lower, upper});
+}
+
+void TimeParameterization::PathAccelerationBounds::add(double a, double b, double lower_bound, double upper_bound) {
+  if (std::abs(a) < EPSILON) {
+    // the constraint only bounds x
+    if (std::abs(b) < EPSILON) {
+      if (lower_bound > EPSILON || upper_bound < -EPSILON) {
+        this->x_max = -std::numeric_limits<double>::infinity();
+      }
+      return;
+    }
+    double bound_min = (b > 0 ? lower_bound : upper_bound) / b;
+    double bound_max = (b > 0 ? upper_bound : lower_bound) / b;
+    this->x_min = std::max(this->x_min, bound_min);
+    this->x_max = std::min(this->x_max, bound_max);
+    return;
+  }
+  double u_lower = a > 0 ? lower_bound : upper_bound;
+  double u_upper = a > 0 ? upper_bound : lower_bound;
+  if (std::isfinite(u_lower)) {
+    this->lower.emplace_back(u_lower / a, -b / a);
+  }
+  if (std::isfinite(u_upper)) {
+    this->upper.emplace_back(u_upper / a, -b / a);
+  }
+}
+
+bool TimeParameterization::PathAccelerationBounds::get_feasible_interval(double& interval_min,
+                                                                         double& interval_max) const {
+  interval_min = this->x_min;
+  interval_max = this->x_max;
+  // each pair of lower and upper bounds on u gives a linear bound on x
+  for (const auto& l : this->lower) {
+    for (const auto& u : this->upper) {
+      double offset = u(0) - l(0);
+      double slope = u(1) - l(1);
+      if (std::abs(slope) < EPSILON) {
+        if (offset < -EPSILON) {
+          return false;
+        }
+      } else if (slope > 0) {
+        interval_min = std::max(interval_min, -offset / slope);
+      } else {
+        interval_max = std::min(interval_max, -offset / slope);
+      }
+    }
+  }
+  if (interval_min > interval_max + EPSILON) {
+    return false;
+  }
+  interval_min = std::min(interval_min, interval_max);
+  return true;
+}
+
+void TimeParameterization::PathAccelerationBounds::get_acceleration_interval(
+    double x, double& u_min, double& u_max
+) const {
+  u_min = -std::numeric_limits<double>::infinity();
+  u_max = std::numeric_limits<double>::infinity();
+  for (const auto& l : this->lower) {
+    u_min = std::max(u_min, l(0) + l(1) * x);
+  }
+  for (const auto& u : this->upper) {
+    u_max = std::min(u_max, u(0) + u(1) * x);
+  }
+}
+
+TimeParameterization::PathAccelerationBounds TimeParameterization::get_bounds(Eigen::Index index) const {
+  PathAccelerationBounds bounds;
+  bounds.x_max = this->max_squared_velocities_(index);
+  for (const auto& constraints: this->constraints_) {
+    for (Eigen::Index j = 0; j < constraints.a.rows(); ++j) {
+      bounds.add(
+          constraints.a(j, index), constraints.b(j, index), constraints.lower(j, index), constraints.upper(j, index));
+    }
+  }
+  return bounds;
+}
+
+void TimeParameterization::compute() {
+  auto nb_points = this->path_.cols();
+  auto last = nb_points - 1;
+  Eigen::VectorXd controllable_min = Eigen::VectorXd::Zero(nb_points);
+  Eigen::VectorXd controllable_max = Eigen::VectorXd::Zero(nb_points);
+  std::vector<PathAccelerationBounds> bounds(nb_points);
+
+  // the path ends at rest, where the constraints of the last gridpoint must still hold for some path acceleration
+  bounds[last] = this->get_bounds(last);
+  if (!bounds[last].get_feasible_interval(controllable_min(last), controllable_max(last))
+      || controllable_min(last) > EPSILON || controllable_max(last) < -EPSILON) {
+    throw std::runtime_error("The path can not be stopped at rest under the constraints");
+  }
+  controllable_min(last) = 0;
+  controllable_max(last) = 0;
+
+  // backward pass: controllable intervals of x from which the rest of the path can be followed to rest
+  for (Eigen::Index i = last - 1; i >= 0; --i) {
+    bounds[i] = this->get_bounds(i);
+    // x_{i+1} = x_i + 2 * delta * u_i must lie in the controllable interval of the next gridpoint
+    double delta = this->gridpoints_(i + 1) - this->gridpoints_(i);
+    bounds[i].add(2 * delta, 1, controllable_min(i + 1), controllable_max(i + 1));
+    if (!bounds[i].get_feasible_interval(controllable_min(i), controllable_max(i))) {
+      throw std::runtime_error(
+          "The path can not be followed under the constraints, infeasible at gridpoint " + std::to_string(i));
+    }
+  }
+  if (controllable_min(0) > EPSILON) {
+    throw std::runtime_error("The path can not be started at rest under the constraints");
+  }
+
+  // forward pass: greedily select the largest path acceleration that keeps the next state controllable
+  this->squared_velocities_ = Eigen::VectorXd::Zero(nb_points);
+  this->accelerations_ = Eigen::VectorXd::Zero(nb_points);
+  this->times_ = Eigen::VectorXd::Zero(nb_points);
+  double u_min, u_max;
+  for (Eigen::Index i = 0; i < last; ++i) {
+    double x = this->squared_velocities_(i);
+    bounds[i].get_acceleration_interval(x, u_min, u_max);
+    double u = std::max(u_min, u_max);
+    double delta = this->gridpoints_(i + 1) - this->gridpoints_(i);
+    double next_x = std::clamp(x + 2 * delta * u, controllable_min(i + 1), controllable_max(i + 1));
+    next_x = std::max(next_x, 0.0);
+    this->accelerations_(i) = (next_x - x) / (2 * delta);
+    this->squared_velocities_(i + 1) = next_x;
+    double velocity_sum = std::sqrt(x) + std::sqrt(next_x);
+    if (velocity_sum < EPSILON) {
+      throw std::runtime_error(
+          "The path can not be followed under the constraints, stopped at gridpoint " + std::to_string(i));
+    }
+    this->times_(i + 1) = this->times_(i) + 2 * delta / velocity_sum;
+  }
+  // at rest, the path acceleration closest to the one of the last segment that satisfies the last constraints
+  bounds[last].get_acceleration_interval(0, u_min, u_max);
+  this->accelerations_(last) = std::min(std::max(this->accelerations_(last - 1), u_min), u_max);
+}
+
+const Eigen::VectorXd& TimeParameterization::get_squared_path_velocities() const {
+  return this->squared_velocities_;
+}
+
+const Eigen::VectorXd& TimeParameterization::get_path_accelerations() const {
+  return this->accelerations_;
+}
+
+const Eigen::VectorXd& TimeParameterization::get_times() const {
+  return this->times_;
+}
+}// namespace robot_model
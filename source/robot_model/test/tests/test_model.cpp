@@ -2,6 +2,7 @@
 
 #include <stdexcept>
 #include <memory>
+#include <type_traits>
 #include <gtest/gtest.h>
 
 #include "robot_model/exceptions/InvalidJointStateSizeException.hpp"
@@ -57,6 +58,18 @@ TEST_F(RobotModelTest, TestEqualityConstructor) {
   EXPECT_NO_THROW(*franka = tmp);
 }
 
+TEST_F(RobotModelTest, TestMoveConstructor) {
+  static_assert(std::is_nothrow_move_constructible_v<Model>);
+  static_assert(std::is_nothrow_move_assignable_v<Model>);
+  Model tmp(robot_name, urdf_path);
+  Model moved(std::move(tmp));
+  EXPECT_EQ(moved.get_number_of_joints(), 7);
+  // the moved-from model has no QP solver but can still be copied and assigned
+  EXPECT_NO_THROW(Model copy(tmp));
+  tmp = moved;
+  EXPECT_EQ(tmp.get_number_of_joints(), 7);
+}
+
 TEST_F(RobotModelTest, TestNumberOfJoints) {
   EXPECT_EQ(franka->get_number_of_joints(), 7);
 }
@@ -0,0 +1,124 @@
+#include "robot_model/Model.hpp"
+#include "robot_model/TimeParameterization.hpp"
+
+#include <memory>
+#include <gtest/gtest.h>
+
+using namespace robot_model;
+
+TEST(TimeParameterizationTest, StraightLine) {
+  // rest to rest over a distance of 2 with v_max = 1 and a_max = 2 takes D / v_max + v_max / a_max
+  std::vector<Eigen::VectorXd> waypoints;
+  for (int i = 0; i <= 100; ++i) {
+    waypoints.push_back(Eigen::VectorXd::Constant(1, 2.0 * i / 100));
+  }
+  TimeParameterization parameterization(waypoints);
+  parameterization.add_velocity_limits(Eigen::VectorXd::Constant(1, 1.0));
+  parameterization.add_acceleration_limits(Eigen::VectorXd::Constant(1, 2.0));
+  parameterization.compute();
+  // the switching points are not on the grid, the error is bounded by its resolution
+  EXPECT_NEAR(parameterization.get_times()(100), 2.5, 1e-3);
+  EXPECT_NEAR(parameterization.get_squared_path_velocities()(0), 0, 1e-12);
+  EXPECT_NEAR(parameterization.get_squared_path_velocities()(50), 1, 1e-9);
+  EXPECT_NEAR(parameterization.get_squared_path_velocities()(100), 0, 1e-12);
+}
+
+TEST(TimeParameterizationTest, InvalidPath) {
+  EXPECT_THROW(TimeParameterization(std::vector<Eigen::VectorXd>{Eigen::VectorXd::Zero(2)}), std::invalid_argument);
+  EXPECT_THROW(TimeParameterization({Eigen::VectorXd::Zero(2), Eigen::VectorXd::Zero(3)}), std::invalid_argument);
+  EXPECT_THROW(TimeParameterization({Eigen::VectorXd::Zero(2), Eigen::VectorXd::Zero(2)}), std::invalid_argument);
+  EXPECT_THROW(TimeParameterization({Eigen::VectorXd::Zero(2), Eigen::VectorXd::Ones(2)}, 1), std::invalid_argument);
+  TimeParameterization parameterization({Eigen::VectorXd::Zero(2), Eigen::VectorXd::Ones(2)});
+  EXPECT_THROW(parameterization.add_velocity_limits(Eigen::VectorXd::Ones(3)), std::invalid_argument);
+  EXPECT_THROW(parameterization.add_constraints(
+      Eigen::MatrixXd::Zero(2, 2), Eigen::MatrixXd::Zero(2, 2), Eigen::MatrixXd::Zero(2, 2),
+      Eigen::MatrixXd::Zero(2, 2)), std::invalid_argument);
+  // the path can not be followed if the accelerations must stay positive
+  auto nb_points = parameterization.get_gridpoints().size();
+  Eigen::MatrixXd upper = Eigen::MatrixXd::Constant(2, nb_points, std::numeric_limits<double>::infinity());
+  parameterization.add_constraints(
+      parameterization.get_path_first_derivatives(), parameterization.get_path_second_derivatives(),
+      Eigen::MatrixXd::Constant(2, nb_points, 0.1), upper);
+  EXPECT_THROW(parameterization.compute(), std::runtime_error);
+}
+
+TEST(TimeParameterizationTest, TwoWaypoints) {
+  TimeParameterization parameterization({Eigen::VectorXd::Zero(2), Eigen::VectorXd::Ones(2)});
+  parameterization.add_velocity_limits(Eigen::VectorXd::Constant(2, 100.0));
+  parameterization.add_acceleration_limits(Eigen::VectorXd::Constant(2, 100.0));
+  ASSERT_NO_THROW(parameterization.compute());
+  ASSERT_EQ(parameterization.get_gridpoints().size(), 100);
+  EXPECT_TRUE(parameterization.get_path().col(0).isZero());
+  EXPECT_TRUE(parameterization.get_path().col(99).isApprox(Eigen::VectorXd::Ones(2)));
+  // rest to rest with the acceleration limit only, reaching the middle of the path at the largest velocity
+  double acceleration = 100 * std::sqrt(2);
+  EXPECT_NEAR(parameterization.get_times()(99), 2 * std::sqrt(std::sqrt(2) / acceleration), 1e-2);
+  EXPECT_NEAR(parameterization.get_squared_path_velocities()(99), 0, 1e-12);
+}
+
+TEST(TimeParameterizationTest, ConstraintsBetweenWaypoints) {
+  // the velocity limit is enforced along the curved spline between sparse waypoints
+  std::vector<Eigen::VectorXd> waypoints{Eigen::Vector2d(0, 0), Eigen::Vector2d(1, 1), Eigen::Vector2d(2, 0)};
+  TimeParameterization parameterization(waypoints, 50);
+  EXPECT_GE(parameterization.get_gridpoints().size(), 50);
+  EXPECT_TRUE(parameterization.get_path().col(0).isApprox(waypoints[0]));
+  EXPECT_TRUE(parameterization.get_path().rightCols<1>().isApprox(waypoints[2]));
+  Eigen::VectorXd velocity_limits = Eigen::Vector2d(1, 1);
+  parameterization.add_velocity_limits(velocity_limits);
+  parameterization.add_acceleration_limits(Eigen::Vector2d(5, 5));
+  parameterization.compute();
+  const auto& x = parameterization.get_squared_path_velocities();
+  for (Eigen::Index i = 0; i < x.size(); ++i) {
+    Eigen::VectorXd velocities = parameterization.get_path_first_derivatives().col(i) * std::sqrt(x(i));
+    EXPECT_TRUE((velocities.cwiseAbs().array() <= velocity_limits.array() + 1e-6).all());
+  }
+  // the spacing of the gridpoints does not exceed the one of a uniform grid
+  const auto& gridpoints = parameterization.get_gridpoints();
+  double spacing = gridpoints(gridpoints.size() - 1) / 49;
+  for (Eigen::Index i = 1; i < gridpoints.size(); ++i) {
+    EXPECT_LE(gridpoints(i) - gridpoints(i - 1), spacing + 1e-9);
+  }
+}
+
+TEST(TimeParameterizationTest, ConstraintsAtLastGridpoint) {
+  TimeParameterization parameterization({Eigen::VectorXd::Zero(1), Eigen::VectorXd::Ones(1)}, 10);
+  auto nb_points = parameterization.get_gridpoints().size();
+  Eigen::MatrixXd lower = Eigen::MatrixXd::Constant(1, nb_points, -std::numeric_limits<double>::infinity());
+  Eigen::MatrixXd upper = Eigen::MatrixXd::Constant(1, nb_points, std::numeric_limits<double>::infinity());
+  // a constraint that no path acceleration satisfies at rest, only at the end of the path
+  lower(0, nb_points - 1) = 1;
+  parameterization.add_constraints(
+      Eigen::MatrixXd::Zero(1, nb_points), Eigen::MatrixXd::Ones(1, nb_points), lower, upper);
+  EXPECT_THROW(parameterization.compute(), std::runtime_error);
+}
+
+TEST(TimeParameterizationTest, ModelLimits) {
+  Model franka("franka", std::string(TEST_FIXTURES) + "panda_arm.urdf");
+  std::vector<state_representation::JointPositions> path;
+  for (int i = 0; i < 50; ++i) {
+    Eigen::VectorXd positions(7);
+    for (int j = 0; j < 7; ++j) {
+      positions(j) = 0.5 * std::sin(0.05 * i * (j + 1)) + 0.01 * i;
+    }
+    path.emplace_back(franka.get_robot_name(), franka.get_joint_frames(), positions);
+  }
+  TimeParameterizationParameters parameters;
+  parameters.velocity_scaling = 0.5;
+  parameters.acceleration_limits = Eigen::VectorXd::Constant(7, 5.0);
+  auto trajectory = franka.compute_time_optimal_trajectory(path, parameters);
+  ASSERT_GE(trajectory.get_size(), path.size());
+  auto last = trajectory.get_size() - 1;
+  EXPECT_NEAR(trajectory.get_point(0).get_velocities().norm(), 0, 1e-9);
+  EXPECT_NEAR(trajectory.get_point(last).get_velocities().norm(), 0, 1e-9);
+  EXPECT_TRUE(trajectory.get_point(0).get_positions().isApprox(path.front().get_positions()));
+  EXPECT_TRUE(trajectory.get_point(last).get_positions().isApprox(path.back().get_positions()));
+  Eigen::VectorXd velocity_limits = 0.5 * franka.get_pinocchio_model().velocityLimit;
+  for (std::size_t i = 0; i < trajectory.get_size(); ++i) {
+    auto point = trajectory.get_point(i);
+    EXPECT_TRUE((point.get_velocities().cwiseAbs().array() <= velocity_limits.array() + 1e-6).all());
+    if (i < last) {
+      EXPECT_TRUE((point.get_accelerations().cwiseAbs().array() <= 5.0 + 1e-6).all());
+      EXPECT_GT(trajectory.get_times()[i + 1], trajectory.get_times()[i]);
+    }
+  }
+}
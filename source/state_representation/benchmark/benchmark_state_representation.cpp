@@ -0,0 +1,63 @@
+#include <benchmark/benchmark.h>
+
+#include <state_representation/space/cartesian/CartesianAcceleration.hpp>
+#include <state_representation/space/cartesian/CartesianPose.hpp>
+#include <state_representation/space/cartesian/CartesianTwist.hpp>
+#include <state_representation/space/cartesian/CartesianWrench.hpp>
+
+using namespace state_representation;
+
+/*
+ * Composing a pose with a pose, twist, acceleration or wrench, and inverting a pose, twist or acceleration, with the
+ * operators of the derived types that only compute their own state variables, against the operators of the full
+ * CartesianState followed by the conversion to the derived type.
+ */
+template<class S>
+static void BM_ComposeWithPose(benchmark::State& state) {
+  auto pose = CartesianPose::Random("frame", "world");
+  auto other = S::Random("child", "frame");
+  for (auto _: state) {
+    benchmark::DoNotOptimize(pose * other);
+  }
+}
+BENCHMARK_TEMPLATE(BM_ComposeWithPose, CartesianPose);
+BENCHMARK_TEMPLATE(BM_ComposeWithPose, CartesianTwist);
+BENCHMARK_TEMPLATE(BM_ComposeWithPose, CartesianAcceleration);
+BENCHMARK_TEMPLATE(BM_ComposeWithPose, CartesianWrench);
+
+template<class S>
+static void BM_ComposeWithPoseAsCartesianState(benchmark::State& state) {
+  auto pose = CartesianPose::Random("frame", "world");
+  auto other = S::Random("child", "frame");
+  for (auto _: state) {
+    benchmark::DoNotOptimize(S(static_cast<const CartesianState&>(pose) * static_cast<const CartesianState&>(other)));
+  }
+}
+BENCHMARK_TEMPLATE(BM_ComposeWithPoseAsCartesianState, CartesianPose);
+BENCHMARK_TEMPLATE(BM_ComposeWithPoseAsCartesianState, CartesianTwist);
+BENCHMARK_TEMPLATE(BM_ComposeWithPoseAsCartesianState, CartesianAcceleration);
+BENCHMARK_TEMPLATE(BM_ComposeWithPoseAsCartesianState, CartesianWrench);
+
+template<class S>
+static void BM_Inverse(benchmark::State& state) {
+  auto value = S::Random("frame", "world");
+  for (auto _: state) {
+    benchmark::DoNotOptimize(value.inverse());
+  }
+}
+BENCHMARK_TEMPLATE(BM_Inverse, CartesianPose);
+BENCHMARK_TEMPLATE(BM_Inverse, CartesianTwist);
+BENCHMARK_TEMPLATE(BM_Inverse, CartesianAcceleration);
+
+template<class S>
+static void BM_InverseAsCartesianState(benchmark::State& state) {
+  auto value = S::Random("frame", "world");
+  for (auto _: state) {
+    benchmark::DoNotOptimize(S(static_cast<const CartesianState&>(value).inverse()));
+  }
+}
+BENCHMARK_TEMPLATE(BM_InverseAsCartesianState, CartesianPose);
+BENCHMARK_TEMPLATE(BM_InverseAsCartesianState, CartesianTwist);
+BENCHMARK_TEMPLATE(BM_InverseAsCartesianState, CartesianAcceleration);
+
+BENCHMARK_MAIN();
@@ -31,6 +31,12 @@ public:
    */
   AnalogIOState(const AnalogIOState& state);
 
+  /**
+   * @brief Move constructor, leaving the moved-from state empty
+   * @param state The state to move from
+   */
+  AnalogIOState(AnalogIOState&& state) noexcept;
+
   /**
    * @brief Constructor for a zero analog IO state
    * @param name The name of the associated analog IO state
@@ -70,6 +76,13 @@ public:
    */
   AnalogIOState& operator=(const AnalogIOState& state);
 
+  /**
+   * @brief Move assignment operator, leaving the moved-from state empty
+   * @param state The state to move from
+   * @return Reference to the current state with new values
+   */
+  AnalogIOState& operator=(AnalogIOState&& state) noexcept;
+
   /**
    * @brief Return a copy of the analog IO state
    */
@@ -31,6 +31,12 @@ public:
    */
   DigitalIOState(const DigitalIOState& state);
 
+  /**
+   * @brief Move constructor, leaving the moved-from state empty
+   * @param state The state to move from
+   */
+  DigitalIOState(DigitalIOState&& state) noexcept;
+
   /**
    * @brief Constructor for a zero digital IO state
    * @param name The name of the associated digital IO state
@@ -70,6 +76,13 @@ public:
    */
   DigitalIOState& operator=(const DigitalIOState& state);
 
+  /**
+   * @brief Move assignment operator, leaving the moved-from state empty
+   * @param state The state to move from
+   * @return Reference to the current state with new values
+   */
+  DigitalIOState& operator=(DigitalIOState&& state) noexcept;
+
   /**
    * @brief Check if a digital IO is true by its name, if it exists
    * @param name The name of the IO
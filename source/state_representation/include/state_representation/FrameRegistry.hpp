@@ -0,0 +1,199 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <utility>
+
+namespace state_representation {
+
+/**
+ * @brief Identifier of a name interned in the frame registry
+ */
+using FrameId = std::uint32_t;
+
+class FrameReference;
+
+/**
+ * @class FrameRegistry
+ * @brief Process-wide registry interning the names of states and reference frames as small integers
+ * @details Each distinct name is registered while at least one FrameReference refers to it, such that states can
+ * compare and assign their name and reference frame by identifier instead of comparing and copying strings. When the
+ * last reference to a name is released, the name is removed from the registry and its identifier can be reused for
+ * another name. Registering a new name takes a lock and allocates, looking up a registered name only takes a shared
+ * lock, and getting the name of an identifier is lock-free. The empty name and "world" are always registered.
+ */
+class FrameRegistry {
+public:
+  static constexpr FrameId EMPTY = 0;                                   ///< identifier of the empty name
+  static constexpr FrameId WORLD = 1;                                   ///< identifier of "world"
+  static constexpr FrameId UNKNOWN = std::numeric_limits<FrameId>::max();///< identifier of names not registered
+
+  /**
+   * @brief Get the identifier of a registered name, without registering it
+   * @param name The name of the state or frame
+   * @return The identifier of the name, or UNKNOWN if the name is not registered
+   */
+  static FrameId find_id(const std::string& name);
+
+  /**
+   * @brief Get the name corresponding to an identifier
+   * @param id The identifier of a FrameReference
+   * @return The name, as a reference that stays valid as long as a FrameReference refers to the identifier
+   */
+  static const std::string& get_name(FrameId id);
+
+  /**
+   * @brief Get the number of registered names
+   */
+  static std::size_t size();
+
+private:
+  friend class FrameReference;
+
+  /**
+   * @brief Get the identifier of a name and add a reference to it, registering it if needed
+   * @throws std::length_error if the registry is full
+   */
+  static FrameId acquire(const std::string& name);
+
+  /**
+   * @brief Add a reference to the identifier of a registered name
+   */
+  static void acquire(FrameId id) noexcept;
+
+  /**
+   * @brief Remove a reference to the identifier of a registered name, removing the name from the registry if it was
+   * the last reference
+   */
+  static void release(FrameId id) noexcept;
+};
+
+/**
+ * @class FrameReference
+ * @brief Counted reference to a name of the frame registry, keeping the name registered while it exists
+ * @details Copying or assigning a reference only increments and decrements the reference counts of the names,
+ * without lock nor allocation unless the last reference to a name is released.
+ */
+class FrameReference {
+public:
+  /**
+   * @brief Empty constructor, referring to the empty name
+   */
+  FrameReference() noexcept;
+
+  /**
+   * @brief Constructor from a name, registering it if needed
+   * @param name The name of the state or frame
+   * @throws std::length_error if the name is not registered and the registry is full
+   */
+  explicit FrameReference(const std::string& name);
+
+  /**
+   * @brief Constructor from the identifier of a name that is already referred to
+   * @param id The identifier of the name
+   */
+  explicit FrameReference(FrameId id) noexcept;
+
+  /**
+   * @brief Copy constructor
+   */
+  FrameReference(const FrameReference& reference) noexcept;
+
+  /**
+   * @brief Move constructor, leaving the moved-from reference referring to the empty name
+   */
+  FrameReference(FrameReference&& reference) noexcept;
+
+  /**
+   * @brief Destructor releasing the reference to the name
+   */
+  ~FrameReference();
+
+  /**
+   * @brief Copy assignment operator
+   */
+  FrameReference& operator=(const FrameReference& reference) noexcept;
+
+  /**
+   * @brief Move assignment operator, leaving the moved-from reference referring to the empty name
+   */
+  FrameReference& operator=(FrameReference&& reference) noexcept;
+
+  /**
+   * @brief Swap the names of two references
+   */
+  friend void swap(FrameReference& reference1, FrameReference& reference2) noexcept;
+
+  /**
+   * @brief Getter of the identifier of the name
+   */
+  FrameId get_id() const noexcept;
+
+  /**
+   * @brief Getter of the name
+   */
+  const std::string& get_name() const;
+
+  /**
+   * @brief Refer to the name of another identifier that is already referred to
+   * @param id The identifier of the name
+   */
+  void set_id(FrameId id) noexcept;
+
+private:
+  FrameId id_;///< identifier of the name
+};
+
+inline FrameReference::FrameReference() noexcept : id_(FrameRegistry::EMPTY) {}
+
+inline FrameReference::FrameReference(const std::string& name) : id_(FrameRegistry::acquire(name)) {}
+
+inline FrameReference::FrameReference(FrameId id) noexcept : id_(id) {
+  FrameRegistry::acquire(id);
+}
+
+inline FrameReference::FrameReference(const FrameReference& reference) noexcept : FrameReference(reference.id_) {}
+
+inline FrameReference::FrameReference(FrameReference&& reference) noexcept : id_(reference.id_) {
+  reference.id_ = FrameRegistry::EMPTY;
+}
+
+inline FrameReference::~FrameReference() {
+  FrameRegistry::release(this->id_);
+}
+
+inline FrameReference& FrameReference::operator=(const FrameReference& reference) noexcept {
+  this->set_id(reference.id_);
+  return *this;
+}
+
+inline FrameReference& FrameReference::operator=(FrameReference&& reference) noexcept {
+  if (this != &reference) {
+    FrameRegistry::release(this->id_);
+    this->id_ = reference.id_;
+    reference.id_ = FrameRegistry::EMPTY;
+  }
+  return *this;
+}
+
+inline void swap(FrameReference& reference1, FrameReference& reference2) noexcept {
+  std::swap(reference1.id_, reference2.id_);
+}
+
+inline FrameId FrameReference::get_id() const noexcept {
+  return this->id_;
+}
+
+inline const std::string& FrameReference::get_name() const {
+  return FrameRegistry::get_name(this->id_);
+}
+
+inline void FrameReference::set_id(FrameId id) noexcept {
+  if (id != this->id_) {
+    FrameRegistry::acquire(id);
+    FrameRegistry::release(this->id_);
+    this->id_ = id;
+  }
+}
+}// namespace state_representation
@@ -19,6 +19,57 @@ const Eigen::Quaterniond log(const Eigen::Quaterniond& q);
  */
 const Eigen::Quaterniond exp(const Eigen::Quaterniond& q, double lambda = 1);
 
+/**
+ * @brief Calculate the log of an array of quaternions as non-unit quaternions
+ * @details The quaternions are the columns of the matrix, with the coefficients in the order (x, y, z, w) of
+ * Eigen::Quaterniond::coeffs(), such that a contiguous array of Eigen::Quaterniond can be mapped to it. The batch
+ * functions are compiled for AVX-512 and AVX2 in addition to the baseline instruction set, and the version supported
+ * by the processor is selected at runtime. The result can be the input itself.
+ * @param quaternions The quaternions to apply the log on
+ * @param result The matrix of the same size to write the logs to
+ */
+void log(
+    const Eigen::Ref<const Eigen::Matrix4Xd, 0, Eigen::OuterStride<4>>& quaternions,
+    Eigen::Ref<Eigen::Matrix4Xd, 0, Eigen::OuterStride<4>> result
+);
+
+/**
+ * @brief Calculate the exp of an array of quaternions, see the batch log for the layout
+ * @param quaternions The quaternions to apply the exp on
+ * @param result The matrix of the same size to write the exps to
+ * @param lambda The factor applied to the quaternions before the exp
+ */
+void exp(
+    const Eigen::Ref<const Eigen::Matrix4Xd, 0, Eigen::OuterStride<4>>& quaternions,
+    Eigen::Ref<Eigen::Matrix4Xd, 0, Eigen::OuterStride<4>> result, double lambda = 1
+);
+
+/**
+ * @brief Multiply two arrays of quaternions element-wise, see the batch log for the layout
+ * @param lhs The left-hand side quaternions
+ * @param rhs The right-hand side quaternions
+ * @param result The matrix of the same size to write the products to
+ */
+void multiply(
+    const Eigen::Ref<const Eigen::Matrix4Xd, 0, Eigen::OuterStride<4>>& lhs,
+    const Eigen::Ref<const Eigen::Matrix4Xd, 0, Eigen::OuterStride<4>>& rhs,
+    Eigen::Ref<Eigen::Matrix4Xd, 0, Eigen::OuterStride<4>> result
+);
+
+/**
+ * @brief Interpolate two arrays of quaternions element-wise with the spherical linear interpolation of
+ * Eigen::Quaterniond::slerp, see the batch log for the layout
+ * @param start The quaternions at parameter 0
+ * @param end The quaternions at parameter 1
+ * @param t The interpolation parameter of each pair
+ * @param result The matrix of the same size to write the interpolated quaternions to
+ */
+void slerp(
+    const Eigen::Ref<const Eigen::Matrix4Xd, 0, Eigen::OuterStride<4>>& start,
+    const Eigen::Ref<const Eigen::Matrix4Xd, 0, Eigen::OuterStride<4>>& end, const Eigen::Ref<const Eigen::VectorXd>& t,
+    Eigen::Ref<Eigen::Matrix4Xd, 0, Eigen::OuterStride<4>> result
+);
+
 /**
  * @brief Create a vector values from start to end
  * @param start the starting value
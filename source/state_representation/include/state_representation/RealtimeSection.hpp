@@ -0,0 +1,34 @@
+#pragma once
+
+namespace state_representation {
+
+/**
+ * @class RealtimeSection
+ * @brief Scoped marker of a section of code that must not allocate on the heap, such as the update step of a
+ * real-time control loop
+ * @details Sections are tracked per thread and can be nested. Marking a section has no effect on its own. When the
+ * program is linked with the state_representation_allocation_check library, or preloads it, any heap allocation
+ * made by a thread inside a marked section aborts the program with a message. The states used in the section should
+ * be allocated beforehand and updated in place, for example by assignment to states of the same size.
+ */
+class RealtimeSection {
+public:
+  /**
+   * @brief Enter a real-time section on the current thread
+   */
+  RealtimeSection();
+
+  /**
+   * @brief Leave the real-time section
+   */
+  ~RealtimeSection();
+
+  RealtimeSection(const RealtimeSection&) = delete;
+  RealtimeSection& operator=(const RealtimeSection&) = delete;
+
+  /**
+   * @brief Check if the current thread is inside a real-time section
+   */
+  static bool is_active();
+};
+}// namespace state_representation
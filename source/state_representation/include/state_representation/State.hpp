@@ -4,11 +4,13 @@
 #include <chrono>
 #include <iostream>
 #include <memory>
+#include <memory_resource>
 #include <typeinfo>
 
 #include <eigen3/Eigen/Core>
 #include <eigen3/Eigen/Dense>
 
+#include "state_representation/FrameRegistry.hpp"
 #include "state_representation/StateType.hpp"
 #include "state_representation/MathTools.hpp"
 
@@ -40,6 +42,12 @@ public:
    */
   State(const State& state);
 
+  /**
+   * @brief Move constructor, leaving the moved-from state empty
+   * @param state The state to move from
+   */
+  State(State&& state) noexcept;
+
   /**
    * @brief Virtual destructor
    */
@@ -59,6 +67,13 @@ public:
    */
   State& operator=(const State& state);
 
+  /**
+   * @brief Move assignment operator, leaving the moved-from state empty
+   * @param state The state to move from
+   * @return Reference to the current state with new values
+   */
+  State& operator=(State&& state) noexcept;
+
   /**
    * @brief Getter of the type attribute
    */
@@ -69,6 +84,11 @@ public:
    */
   const std::string& get_name() const;
 
+  /**
+   * @brief Getter of the identifier of the name in the frame registry, to compare names without comparing strings
+   */
+  FrameId get_name_id() const;
+
   /**
    * @brief Getter of the empty attribute
    */
@@ -84,6 +104,26 @@ public:
    */
   virtual void set_name(const std::string& name);
 
+  /**
+   * @brief Setter of the name attribute from its identifier in the frame registry, without copying the string
+   * @param name_id The identifier of the name of another state or frame
+   */
+  void set_name_id(FrameId name_id);
+
+  /**
+   * @brief Setter of the empty attribute
+   * @details Calling this function will also reset the timestamp. Together with the variable maps of the derived
+   * states, it lets the state variables be written in place without allocation.
+   * @param empty Flag to specify if the state should be empty or not, default true
+   */
+  void set_empty(bool empty = true);
+
+  /**
+   * @brief Setter of the timestamp attribute
+   * @param timestamp The time of the last modification of the state
+   */
+  void set_timestamp(const std::chrono::time_point<std::chrono::steady_clock>& timestamp);
+
   /**
    * @brief Reset the timestamp attribute to now
    */
@@ -153,13 +193,6 @@ protected:
    */
   void set_type(const StateType& type);
 
-  /**
-   * @brief Setter of the empty attribute
-   * @details Calling this function will also reset the timestamp
-   * @param empty Flag to specify if the state should be empty or not, default true
-   */
-  void set_empty(bool empty = true);
-
   /**
    * @brief Throw an exception if the state is empty
    * @throws exceptions::EmptyStateException
@@ -173,13 +206,13 @@ protected:
 
 private:
   StateType type_;                                              ///< type of the State
-  std::string name_;                                            ///< name of the state
+  FrameReference name_;                                         ///< name of the state in the frame registry
   bool empty_;                                                  ///< indicate if the state is empty
   std::chrono::time_point<std::chrono::steady_clock> timestamp_;///< time since last modification made to the state
 };
 
 inline void swap(State& state1, State& state2) {
-  std::swap(state1.name_, state2.name_);
+  swap(state1.name_, state2.name_);
   std::swap(state1.empty_, state2.empty_);
   std::swap(state1.timestamp_, state2.timestamp_);
 }
@@ -193,4 +226,18 @@ template<typename T>
 std::shared_ptr<State> make_shared_state(const T& state) {
   return std::make_shared<T>(state);
 }
+
+/**
+ * @brief Create a shared pointer to a copy of a state, allocating the state and its control block from a memory
+ * resource instead of the heap
+ * @details With a std::pmr::monotonic_buffer_resource or a std::pmr::unsynchronized_pool_resource set up at startup,
+ * the shared states of a control loop can be created from preallocated memory. The dynamic members of the copy, such
+ * as the names and variables of a JointState, are still allocated on the heap.
+ * @param state The state to copy
+ * @param resource The memory resource, which must outlive the shared state
+ */
+template<typename T>
+std::shared_ptr<State> make_shared_state(const T& state, std::pmr::memory_resource* resource) {
+  return std::allocate_shared<T>(std::pmr::polymorphic_allocator<T>(resource), state);
+}
 }// namespace state_representation
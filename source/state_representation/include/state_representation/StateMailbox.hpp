@@ -0,0 +1,217 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <type_traits>
+#include <vector>
+
+#include "state_representation/exceptions/IncompatibleSizeException.hpp"
+#include "state_representation/exceptions/IncompatibleStatesException.hpp"
+#include "state_representation/space/cartesian/CartesianState.hpp"
+#include "state_representation/space/joint/JointState.hpp"
+
+namespace state_representation {
+
+/**
+ * @class StateMailbox
+ * @brief Container passing the latest value of a state from one writer thread to a fixed number of reader threads
+ * without locks
+ * @details Each reader has its own triple buffer of copies of the prototype state, allocated at construction: the
+ * writer fills the back buffer and exchanges it with the middle one, and the reader exchanges its front buffer with the
+ * middle one when it holds a newer value. Both exchanges are a single atomic operation, such that the writer and the
+ * readers are wait-free and never block each other. Reading always gives the latest value written, intermediate values
+ * being dropped when the writer is faster than a reader. The copies keep the timestamp of the written state, such
+ * that readers can detect stale data with State::is_deprecated.
+ *
+ * For Cartesian and joint states, the writes and reads copy the state variables, the name and reference frame
+ * identifiers, the timestamp and the empty attribute in place, without allocation. The joint names are never copied,
+ * such that the joint states written and read must have the joint names of the prototype. Other states are copied with
+ * their copy assignment operator.
+ * @tparam StateT The type of the state
+ */
+template<class StateT>
+class StateMailbox {
+public:
+  static_assert(std::is_base_of_v<State, StateT>, "The type of a StateMailbox must be a State");
+
+  /**
+   * @brief Constructor from a prototype of the states passed through the mailbox
+   * @param prototype The state to initialize the buffers with, which sets their joint names and size for joint states
+   * @param readers The number of reader threads (default is 1)
+   */
+  explicit StateMailbox(const StateT& prototype, std::size_t readers = 1);
+
+  StateMailbox(const StateMailbox& mailbox) = delete;
+
+  StateMailbox& operator=(const StateMailbox& mailbox) = delete;
+
+  /**
+   * @brief Getter of the number of readers
+   */
+  std::size_t get_readers() const;
+
+  /**
+   * @brief Write the latest value of the state, to be called from a single writer thread
+   * @param state The state to copy into the mailbox
+   * @throws IncompatibleSizeException if the size of a joint state differs from the size of the prototype
+   * @throws IncompatibleStatesException if the joint names of a joint state differ from those of the prototype
+   */
+  void write(const StateT& state);
+
+  /**
+   * @brief Check if a value was written since the last read of a reader
+   * @param reader The index of the reader (default is 0)
+   */
+  bool has_new_data(std::size_t reader = 0) const;
+
+  /**
+   * @brief Get the latest value of the state, to be called from the thread of the reader only
+   * @param reader The index of the reader (default is 0)
+   * @return The latest value, as a reference that stays valid until the next read of the reader
+   */
+  const StateT& read(std::size_t reader = 0);
+
+  /**
+   * @brief Copy the latest value of the state into a state, to be called from the thread of the reader only
+   * @param state The state to copy the latest value into
+   * @param reader The index of the reader (default is 0)
+   * @return True if a value was written since the last read of the reader
+   * @throws IncompatibleSizeException if the size of a joint state differs from the size of the prototype
+   * @throws IncompatibleStatesException if the joint names of a joint state differ from those of the prototype
+   */
+  bool read(StateT& state, std::size_t reader = 0);
+
+private:
+  static constexpr std::uint8_t DIRTY = 4;///< flag of the middle buffer index when it holds a value not read yet
+  static constexpr std::uint8_t INDEX = 3;///< mask of the buffer index
+
+  /**
+   * @brief Triple buffer of a reader, the indices owned by the writer and by the reader on separate cache lines
+   */
+  struct Channel {
+    explicit Channel(const StateT& prototype) : buffers{prototype, prototype, prototype} {}
+
+    std::array<StateT, 3> buffers;
+    alignas(64) std::uint8_t back = 0;
+    alignas(64) std::atomic<std::uint8_t> middle{1};
+    alignas(64) std::uint8_t front = 2;
+  };
+
+  /**
+   * @brief Exchange the front buffer of a reader with the middle buffer if it holds a value not read yet
+   * @return True if the buffers were exchanged
+   */
+  static bool update_front(Channel& channel);
+
+  /**
+   * @brief Throw if a joint state does not have the size and joint names of the prototype
+   */
+  void assert_compatible(const StateT& state) const;
+
+  /**
+   * @brief Copy the values of a state in place
+   */
+  static void copy(const StateT& source, StateT& destination);
+
+  Eigen::Index size_;                             ///< size of the joint states, 0 otherwise
+  std::vector<std::string> names_;                ///< joint names of the joint states, empty otherwise
+  std::vector<std::unique_ptr<Channel>> channels_;///< triple buffers of the readers
+};
+
+template<class StateT>
+StateMailbox<StateT>::StateMailbox(const StateT& prototype, std::size_t readers) : size_(0) {
+  if constexpr (std::is_base_of_v<JointState, StateT>) {
+    this->size_ = prototype.get_variable_map(JointStateVariable::ALL).size();
+    this->names_ = prototype.get_names();
+  }
+  this->channels_.reserve(readers);
+  for (std::size_t i = 0; i < readers; ++i) {
+    this->channels_.push_back(std::make_unique<Channel>(prototype));
+  }
+}
+
+template<class StateT>
+void StateMailbox<StateT>::assert_compatible(const StateT& state) const {
+  if constexpr (std::is_base_of_v<JointState, StateT>) {
+    if (state.get_variable_map(JointStateVariable::ALL).size() != this->size_) {
+      throw exceptions::IncompatibleSizeException(
+          "The joint state " + state.get_name() + " does not have the size of the states of the mailbox");
+    }
+    if (state.get_names() != this->names_) {
+      throw exceptions::IncompatibleStatesException(
+          "The joint state " + state.get_name() + " does not have the joint names of the states of the mailbox");
+    }
+  }
+}
+
+template<class StateT>
+void StateMailbox<StateT>::copy(const StateT& source, StateT& destination) {
+  if constexpr (std::is_base_of_v<CartesianState, StateT>) {
+    const CartesianState& from = source;
+    CartesianState& to = destination;
+    to.get_variable_map(CartesianStateVariable::POSITION) = from.get_position_unchecked();
+    to.set_orientation(from.get_orientation_unchecked());
+    to.get_variable_map(CartesianStateVariable::LINEAR_VELOCITY) = from.get_linear_velocity_unchecked();
+    to.get_variable_map(CartesianStateVariable::ANGULAR_VELOCITY) = from.get_angular_velocity_unchecked();
+    to.get_variable_map(CartesianStateVariable::LINEAR_ACCELERATION) = from.get_linear_acceleration_unchecked();
+    to.get_variable_map(CartesianStateVariable::ANGULAR_ACCELERATION) = from.get_angular_acceleration_unchecked();
+    to.get_variable_map(CartesianStateVariable::FORCE) = from.get_force_unchecked();
+    to.get_variable_map(CartesianStateVariable::TORQUE) = from.get_torque_unchecked();
+    to.set_reference_frame_id(from.get_reference_frame_id());
+  } else if constexpr (std::is_base_of_v<JointState, StateT>) {
+    const JointState& from = source;
+    JointState& to = destination;
+    to.get_variable_map(JointStateVariable::ALL) = from.get_variable_map(JointStateVariable::ALL);
+  } else {
+    destination = source;
+    return;
+  }
+  destination.set_name_id(source.get_name_id());
+  destination.set_empty(source.is_empty());
+  destination.set_timestamp(source.get_timestamp());
+}
+
+template<class StateT>
+void StateMailbox<StateT>::write(const StateT& state) {
+  this->assert_compatible(state);
+  for (auto& channel: this->channels_) {
+    copy(state, channel->buffers[channel->back]);
+    channel->back = channel->middle.exchange(channel->back | DIRTY, std::memory_order_acq_rel) & INDEX;
+  }
+}
+
+template<class StateT>
+bool StateMailbox<StateT>::has_new_data(std::size_t reader) const {
+  return this->channels_.at(reader)->middle.load(std::memory_order_acquire) & DIRTY;
+}
+
+template<class StateT>
+bool StateMailbox<StateT>::update_front(Channel& channel) {
+  if (!(channel.middle.load(std::memory_order_relaxed) & DIRTY)) {
+    return false;
+  }
+  channel.front = channel.middle.exchange(channel.front, std::memory_order_acq_rel) & INDEX;
+  return true;
+}
+
+template<class StateT>
+const StateT& StateMailbox<StateT>::read(std::size_t reader) {
+  auto& channel = *this->channels_.at(reader);
+  update_front(channel);
+  return channel.buffers[channel.front];
+}
+
+template<class StateT>
+bool StateMailbox<StateT>::read(StateT& state, std::size_t reader) {
+  this->assert_compatible(state);
+  auto& channel = *this->channels_.at(reader);
+  bool new_data = update_front(channel);
+  copy(channel.buffers[channel.front], state);
+  return new_data;
+}
+
+template<class StateT>
+inline std::size_t StateMailbox<StateT>::get_readers() const {
+  return this->channels_.size();
+}
+}// namespace state_representation
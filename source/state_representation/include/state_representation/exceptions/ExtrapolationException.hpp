@@ -0,0 +1,16 @@
+#pragma once
+
+#include <exception>
+#include <iostream>
+
+namespace state_representation::exceptions {
+
+/**
+ * @class ExtrapolationException
+ * @brief Exception that is thrown when a time is outside of the range of the buffered data
+ */
+class ExtrapolationException : public std::runtime_error {
+public:
+  explicit ExtrapolationException(const std::string& msg) : runtime_error(msg) {};
+};
+}// namespace state_representation::exceptions
@@ -0,0 +1,113 @@
+#pragma once
+
+#include "state_representation/space/joint/JointState.hpp"
+
+namespace state_representation {
+
+/**
+ * @class BiquadFilter
+ * @brief Second-order recursive filter applied in place to a variable of joint states, with one filter per joint
+ * @details The filter computes y[n] = b0 x[n] + b1 x[n-1] + b2 x[n-2] - a1 y[n-1] - a2 y[n-2] in the transposed
+ * direct form II, with the same coefficients for all the joints. The joints are filtered together in a loop that is
+ * vectorized over the joints, and the state of the filter is allocated at construction such that updating a joint
+ * state does not allocate. The first update initializes the filter to its steady state for the given input, to avoid
+ * the transient from zero.
+ */
+class BiquadFilter {
+public:
+  /**
+   * @brief Constructor from the coefficients of the filter, normalized such that a0 = 1
+   * @param nb_joints The number of joints of the filtered states
+   * @param variable The state variable to filter, or all of them
+   * @param b0 The coefficient of the input
+   * @param b1 The coefficient of the previous input
+   * @param b2 The coefficient of the input before the previous one
+   * @param a1 The coefficient of the previous output
+   * @param a2 The coefficient of the output before the previous one
+   */
+  explicit BiquadFilter(
+      unsigned int nb_joints, const JointStateVariable& variable, double b0, double b1, double b2, double a1, double a2
+  );
+
+  /**
+   * @brief Constructor of a first-order low-pass filter, y[n] = y[n-1] + alpha (x[n] - y[n-1])
+   * @param nb_joints The number of joints of the filtered states
+   * @param variable The state variable to filter, or all of them
+   * @param cutoff_frequency The cutoff frequency in Hz
+   * @param dt The sampling period in seconds
+   * @throws InvalidParameterException if the cutoff frequency or the sampling period is not positive
+   */
+  static BiquadFilter FirstOrderLowPass(
+      unsigned int nb_joints, const JointStateVariable& variable, double cutoff_frequency, double dt
+  );
+
+  /**
+   * @brief Constructor of a second-order Butterworth low-pass filter, discretized with the bilinear transform
+   * @param nb_joints The number of joints of the filtered states
+   * @param variable The state variable to filter, or all of them
+   * @param cutoff_frequency The cutoff frequency in Hz, below the Nyquist frequency
+   * @param dt The sampling period in seconds
+   * @throws InvalidParameterException if the sampling period is not positive or the cutoff frequency is not between
+   * 0 and the Nyquist frequency
+   */
+  static BiquadFilter ButterworthLowPass(
+      unsigned int nb_joints, const JointStateVariable& variable, double cutoff_frequency, double dt
+  );
+
+  /**
+   * @brief Getter of the number of joints
+   */
+  unsigned int get_size() const;
+
+  /**
+   * @brief Getter of the filtered state variable
+   */
+  const JointStateVariable& get_variable() const;
+
+  /**
+   * @brief Getter of the coefficients as (b0, b1, b2, a1, a2)
+   */
+  Eigen::Matrix<double, 5, 1> get_coefficients() const;
+
+  /**
+   * @brief Filter the state variable of a joint state in place, keeping the timestamp of the state
+   * @param state The joint state
+   * @throws EmptyStateException if the state is empty
+   * @throws IncompatibleSizeException if the number of joints of the state differs from the one of the filter
+   */
+  void update(JointState& state);
+
+  /**
+   * @brief Reset the filter, such that the next update initializes it again
+   */
+  void reset();
+
+private:
+  unsigned int nb_joints_;     ///< number of joints
+  JointStateVariable variable_;///< filtered state variable
+  double b0_;                  ///< coefficient of the input
+  double b1_;                  ///< coefficient of the previous input
+  double b2_;                  ///< coefficient of the input before the previous one
+  double a1_;                  ///< coefficient of the previous output
+  double a2_;                  ///< coefficient of the output before the previous one
+  Eigen::VectorXd z1_;         ///< first delay of the transposed direct form II, one per filtered value
+  Eigen::VectorXd z2_;         ///< second delay of the transposed direct form II, one per filtered value
+  bool initialized_;           ///< whether the delays were initialized from a first input
+};
+
+inline unsigned int BiquadFilter::get_size() const {
+  return this->nb_joints_;
+}
+
+inline const JointStateVariable& BiquadFilter::get_variable() const {
+  return this->variable_;
+}
+
+inline Eigen::Matrix<double, 5, 1> BiquadFilter::get_coefficients() const {
+  return (Eigen::Matrix<double, 5, 1>() << this->b0_, this->b1_, this->b2_, this->a1_, this->a2_).finished();
+}
+
+inline void BiquadFilter::reset() {
+  this->initialized_ = false;
+}
+}// namespace state_representation
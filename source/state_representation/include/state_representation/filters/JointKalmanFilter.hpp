@@ -0,0 +1,84 @@
+#pragma once
+
+#include "state_representation/space/joint/JointState.hpp"
+
+namespace state_representation {
+
+/**
+ * @class JointKalmanFilter
+ * @brief Kalman filter estimating the positions, velocities and accelerations of joints from measured positions
+ * @details Each joint follows a constant acceleration model driven by a white jerk noise, and its position is
+ * measured with a white noise. As the model and the noises are the same for all the joints, the covariance and the
+ * gain of the filter are shared and computed once per update, while the estimates are updated in a loop that is
+ * vectorized over the joints. The estimates are allocated at construction such that updating a joint state does not
+ * allocate. The first update sets the positions from the measurement with zero velocities and accelerations.
+ */
+class JointKalmanFilter {
+public:
+  /**
+   * @brief Constructor with the noises of the model
+   * @param nb_joints The number of joints of the filtered states
+   * @param dt The sampling period in seconds
+   * @param process_noise The spectral density of the jerk of the joints
+   * @param measurement_noise The variance of the measured positions
+   * @throws InvalidParameterException if the sampling period or one of the noises is not positive
+   */
+  explicit JointKalmanFilter(unsigned int nb_joints, double dt, double process_noise, double measurement_noise);
+
+  /**
+   * @brief Getter of the number of joints
+   */
+  unsigned int get_size() const;
+
+  /**
+   * @brief Getter of the covariance of the estimated position, velocity and acceleration, shared by all the joints
+   */
+  const Eigen::Matrix3d& get_covariance() const;
+
+  /**
+   * @brief Getter of the gain of the last update
+   */
+  const Eigen::Vector3d& get_gain() const;
+
+  /**
+   * @brief Correct the estimates with the measured positions of a joint state and set its positions, velocities and
+   * accelerations to the new estimates, keeping the timestamp of the state
+   * @param state The joint state
+   * @throws EmptyStateException if the state is empty
+   * @throws IncompatibleSizeException if the number of joints of the state differs from the one of the filter
+   */
+  void update(JointState& state);
+
+  /**
+   * @brief Reset the filter, such that the next update initializes it again
+   */
+  void reset();
+
+private:
+  unsigned int nb_joints_;           ///< number of joints
+  Eigen::Matrix3d transition_;       ///< transition of the constant acceleration model over a sampling period
+  Eigen::Matrix3d process_noise_;    ///< covariance of the process noise over a sampling period
+  double measurement_noise_;         ///< variance of the measured positions
+  Eigen::Matrix3d initial_covariance_;///< covariance of the estimates after the first measurement
+  Eigen::Matrix3d covariance_;       ///< covariance of the estimates
+  Eigen::Vector3d gain_;             ///< gain of the last update
+  Eigen::MatrixXd estimates_;        ///< estimated positions, velocities and accelerations, one column each
+  bool initialized_;                 ///< whether the estimates were initialized from a first measurement
+};
+
+inline unsigned int JointKalmanFilter::get_size() const {
+  return this->nb_joints_;
+}
+
+inline const Eigen::Matrix3d& JointKalmanFilter::get_covariance() const {
+  return this->covariance_;
+}
+
+inline const Eigen::Vector3d& JointKalmanFilter::get_gain() const {
+  return this->gain_;
+}
+
+inline void JointKalmanFilter::reset() {
+  this->initialized_ = false;
+}
+}// namespace state_representation
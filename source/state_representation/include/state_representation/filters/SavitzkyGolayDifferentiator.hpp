@@ -0,0 +1,93 @@
+#pragma once
+
+#include "state_representation/space/joint/JointState.hpp"
+
+namespace state_representation {
+
+/**
+ * @class SavitzkyGolayDifferentiator
+ * @brief Differentiator of joint positions from a least-squares polynomial fit over a window of past samples
+ * @details The positions of the last samples are fitted with a polynomial of the given order, which is evaluated at
+ * the newest sample to obtain the velocities and, from the second order, the accelerations. As the fit is linear in
+ * the samples, it reduces to fixed weights computed at construction and applied to all the joints in a loop that is
+ * vectorized over the joints. The window of samples is allocated at construction such that updating a joint state
+ * does not allocate. The window is filled with the first sample on the first update.
+ */
+class SavitzkyGolayDifferentiator {
+public:
+  /**
+   * @brief Constructor with the size of the window and the order of the fitted polynomial
+   * @param nb_joints The number of joints of the differentiated states
+   * @param window The number of samples in the window
+   * @param order The order of the polynomial fitted on the samples
+   * @param dt The sampling period in seconds
+   * @throws IncompatibleSizeException if the order is zero or the window is not larger than the order
+   * @throws InvalidParameterException if the sampling period is not positive
+   */
+  explicit SavitzkyGolayDifferentiator(unsigned int nb_joints, unsigned int window, unsigned int order, double dt);
+
+  /**
+   * @brief Getter of the number of joints
+   */
+  unsigned int get_size() const;
+
+  /**
+   * @brief Getter of the number of samples in the window
+   */
+  unsigned int get_window() const;
+
+  /**
+   * @brief Getter of the order of the fitted polynomial
+   */
+  unsigned int get_order() const;
+
+  /**
+   * @brief Getter of the weights of the samples from the oldest to the newest, with the weights of the velocities
+   * in the first row and the ones of the accelerations in the second row if the order is at least 2
+   */
+  const Eigen::MatrixXd& get_weights() const;
+
+  /**
+   * @brief Add the positions of a joint state to the window and set its velocities, and its accelerations if the
+   * order is at least 2, from the derivatives of the fitted polynomial, keeping the timestamp of the state
+   * @param state The joint state
+   * @throws EmptyStateException if the state is empty
+   * @throws IncompatibleSizeException if the number of joints of the state differs from the one of the differentiator
+   */
+  void update(JointState& state);
+
+  /**
+   * @brief Reset the differentiator, such that the next update fills the window again
+   */
+  void reset();
+
+private:
+  unsigned int nb_joints_;  ///< number of joints
+  unsigned int window_;     ///< number of samples in the window
+  unsigned int order_;      ///< order of the fitted polynomial
+  Eigen::MatrixXd weights_; ///< weights of the samples for each derivative, from the oldest to the newest sample
+  Eigen::MatrixXd samples_; ///< ring of the positions of the samples, one column per sample
+  unsigned int newest_;     ///< column of the newest sample in the ring
+  bool initialized_;        ///< whether the window was filled from a first sample
+};
+
+inline unsigned int SavitzkyGolayDifferentiator::get_size() const {
+  return this->nb_joints_;
+}
+
+inline unsigned int SavitzkyGolayDifferentiator::get_window() const {
+  return this->window_;
+}
+
+inline unsigned int SavitzkyGolayDifferentiator::get_order() const {
+  return this->order_;
+}
+
+inline const Eigen::MatrixXd& SavitzkyGolayDifferentiator::get_weights() const {
+  return this->weights_;
+}
+
+inline void SavitzkyGolayDifferentiator::reset() {
+  this->initialized_ = false;
+}
+}// namespace state_representation
@@ -29,6 +29,12 @@ public:
    */
   Ellipsoid(const Ellipsoid& ellipsoid);
 
+  /**
+   * @brief Move constructor, leaving the moved-from Ellipsoid empty
+   * @param ellipsoid The Ellipsoid to move from
+   */
+  Ellipsoid(Ellipsoid&& ellipsoid) noexcept;
+
   /**
    * @brief Constructor for a Ellipsoid with identity state, unit axis lengths and zero rotation angle
    * @param name Name of the Ellipsoid and its state
@@ -50,6 +56,13 @@ public:
    */
   Ellipsoid& operator=(const Ellipsoid& state);
 
+  /**
+   * @brief Move assignment operator, leaving the moved-from Ellipsoid empty
+   * @param ellipsoid The Ellipsoid to move from
+   * @return Reference to the current Ellipsoid with new values
+   */
+  Ellipsoid& operator=(Ellipsoid&& ellipsoid) noexcept;
+
   /**
    * @brief Getter of the axis lengths
    * @return The axis lengths
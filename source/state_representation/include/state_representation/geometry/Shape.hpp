@@ -29,6 +29,12 @@ public:
    */
   Shape(const Shape& shape);
 
+  /**
+   * @brief Move constructor, leaving the moved-from Shape empty
+   * @param shape The Shape to move from
+   */
+  Shape(Shape&& shape) noexcept;
+
   /**
    * @brief Constructor for a Shape with identity state
    * @param name Name of the Shape and its state
@@ -50,6 +56,13 @@ public:
    */
   Shape& operator=(const Shape& state);
 
+  /**
+   * @brief Move assignment operator, leaving the moved-from Shape empty
+   * @param shape The Shape to move from
+   * @return Reference to the current Shape with new values
+   */
+  Shape& operator=(Shape&& shape) noexcept;
+
   /**
    * @brief Getter of the state
    * @return The state of the Shape
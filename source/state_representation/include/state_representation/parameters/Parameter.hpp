@@ -42,6 +42,32 @@ public:
    */
   virtual ~Parameter() = default;
 
+  /**
+   * @brief Copy constructor
+   * @param parameter The parameter to copy
+   */
+  Parameter(const Parameter<T>& parameter) = default;
+
+  /**
+   * @brief Move constructor, leaving the moved-from parameter empty
+   * @param parameter The parameter to move from
+   */
+  Parameter(Parameter<T>&& parameter) = default;
+
+  /**
+   * @brief Copy assignment operator
+   * @param parameter The parameter with value to assign
+   * @return Reference to the current parameter with new values
+   */
+  Parameter<T>& operator=(const Parameter<T>& parameter) = default;
+
+  /**
+   * @brief Move assignment operator, leaving the moved-from parameter empty
+   * @param parameter The parameter to move from
+   * @return Reference to the current parameter with new values
+   */
+  Parameter<T>& operator=(Parameter<T>&& parameter) = default;
+
   /**
    * @brief Conversion equality
    */
@@ -68,6 +94,18 @@ public:
    */
   T& get_value();
 
+  /**
+   * @brief Getter of the value attribute without checking that the parameter is not empty
+   * @details Meant for parameters that always hold a value, such as gains set at construction
+   * @return The value attribute
+   */
+  const T& get_value_unchecked() const noexcept;
+
+  /**
+   * @copydoc Parameter::get_value_unchecked() const
+   */
+  T& get_value_unchecked() noexcept;
+
   /**
    * @brief Setter of the value attribute
    * @param value The new value attribute
@@ -127,6 +165,16 @@ inline T& Parameter<T>::get_value() {
   return this->value_;
 }
 
+template<typename T>
+inline const T& Parameter<T>::get_value_unchecked() const noexcept {
+  return this->value_;
+}
+
+template<typename T>
+inline T& Parameter<T>::get_value_unchecked() noexcept {
+  return this->value_;
+}
+
 template<typename T>
 inline void Parameter<T>::set_value(const T& value) {
   this->value_ = value;
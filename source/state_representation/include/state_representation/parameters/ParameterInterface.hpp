@@ -31,6 +31,12 @@ public:
    */
   ParameterInterface(const ParameterInterface& parameter);
 
+  /**
+   * @brief Move constructor, leaving the moved-from parameter empty
+   * @param parameter The parameter to move from
+   */
+  ParameterInterface(ParameterInterface&& parameter) noexcept;
+
   /**
    * @brief Default virtual destructor
    */
@@ -44,6 +50,13 @@ public:
    */
   ParameterInterface& operator=(const ParameterInterface& state);
 
+  /**
+   * @brief Move assignment operator, leaving the moved-from parameter empty
+   * @param parameter The parameter to move from
+   * @return Reference to the current parameter with new values
+   */
+  ParameterInterface& operator=(ParameterInterface&& parameter) noexcept;
+
   /**
    * @brief Get a pointer to a derived Parameter instance from a ParameterInterface pointer.
    * @details If a ParameterInterface pointer is used to address a derived Parameter instance,
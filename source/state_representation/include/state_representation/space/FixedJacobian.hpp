@@ -0,0 +1,308 @@
+#pragma once
+
+#include <eigen3/Eigen/SVD>
+
+#include "state_representation/exceptions/EmptyStateException.hpp"
+#include "state_representation/exceptions/IncompatibleSizeException.hpp"
+#include "state_representation/exceptions/IncompatibleStatesException.hpp"
+#include "state_representation/space/Jacobian.hpp"
+
+namespace state_representation {
+
+/**
+ * @class FixedJacobian
+ * @brief Jacobian matrix of a robot with a number of joints known at compile time
+ * @details The matrix is stored with a fixed size of 6xN and the products with joint and Cartesian states are written
+ * into existing output states, such that they do not allocate once the outputs have the names and frames of the
+ * result. The singular value decomposition used for the pseudoinverse is computed on the first use after the data is
+ * set and reused for all the following solves with the same data, for example to map several twists per control cycle.
+ * As the matrices of the decomposition are fixed-size too, neither computing it nor solving with it allocates. As the
+ * cached decomposition is updated from const methods, a FixedJacobian must not be used from several threads at once.
+ * @tparam N The number of joints
+ */
+template<int N>
+class FixedJacobian {
+public:
+  using MatrixType = Eigen::Matrix<double, 6, N>;
+
+  static_assert(N > 0, "The number of joints of a FixedJacobian must be positive");
+
+  /**
+   * @brief Constructor with name, frame and reference frame provided, with default joint names and zero data
+   * @param robot_name The name of the associated robot
+   * @param frame The name of the frame at which the Jacobian is computed
+   * @param reference_frame The name of the reference frame in which the Jacobian is expressed (default is "world")
+   */
+  FixedJacobian(const std::string& robot_name, const std::string& frame, const std::string& reference_frame = "world");
+
+  /**
+   * @brief Constructor with name, joint names, frame and reference frame provided, with zero data
+   * @param robot_name The name of the associated robot
+   * @param joint_names The vector of N joint names
+   * @param frame The name of the frame at which the Jacobian is computed
+   * @param reference_frame The name of the reference frame in which the Jacobian is expressed (default is "world")
+   */
+  FixedJacobian(
+      const std::string& robot_name, const std::vector<std::string>& joint_names, const std::string& frame,
+      const std::string& reference_frame = "world"
+  );
+
+  /**
+   * @brief Conversion constructor from a Jacobian with N columns
+   * @param jacobian The Jacobian to copy
+   */
+  explicit FixedJacobian(const Jacobian& jacobian);
+
+  /**
+   * @brief Getter of the name of the associated robot
+   */
+  const std::string& get_name() const;
+
+  /**
+   * @brief Getter of the joint names
+   */
+  const std::vector<std::string>& get_joint_names() const;
+
+  /**
+   * @brief Getter of the frame at which the Jacobian is computed
+   */
+  const std::string& get_frame() const;
+
+  /**
+   * @brief Getter of the reference frame in which the Jacobian is expressed
+   */
+  const std::string& get_reference_frame() const;
+
+  /**
+   * @brief Getter of the data matrix
+   */
+  const MatrixType& data() const;
+
+  /**
+   * @brief Setter of the data matrix, which invalidates the cached decomposition
+   * @param data The 6xN matrix
+   */
+  void set_data(const MatrixType& data);
+
+  /**
+   * @brief Setter of the data matrix from a Jacobian with the same joint names and reference frame, without
+   * allocation
+   * @param jacobian The Jacobian
+   * @throws IncompatibleStatesException if the Jacobian has other joint names or another reference frame
+   */
+  void set_data(const Jacobian& jacobian);
+
+  /**
+   * @brief Convert to a Jacobian
+   */
+  Jacobian to_jacobian() const;
+
+  /**
+   * @brief Getter of the cached singular value decomposition of the data, computed if needed
+   */
+  const Eigen::JacobiSVD<MatrixType>& get_decomposition() const;
+
+  /**
+   * @brief Compute the pseudoinverse of the data from the cached decomposition
+   * @return The Nx6 pseudoinverse matrix
+   */
+  Eigen::Matrix<double, N, 6> pseudoinverse() const;
+
+  /**
+   * @brief Compute the joint velocities of a twist with the pseudoinverse, as the minimum norm least squares
+   * solution from the cached decomposition
+   * @param twist The Cartesian twist
+   * @param velocities The joint velocities in which to write the result
+   * @throws IncompatibleStatesException if the twist is not expressed in the reference frame of the Jacobian
+   */
+  void pseudoinverse(const CartesianTwist& twist, JointVelocities& velocities) const;
+
+  /**
+   * @brief Compute the joint torques of a wrench with the transpose
+   * @param wrench The Cartesian wrench
+   * @param torques The joint torques in which to write the result
+   * @throws IncompatibleStatesException if the wrench is not expressed in the reference frame of the Jacobian
+   */
+  void transpose(const CartesianWrench& wrench, JointTorques& torques) const;
+
+  /**
+   * @brief Compute the twist of joint velocities
+   * @param velocities The joint velocities
+   * @param twist The Cartesian twist in which to write the result
+   * @throws EmptyStateException if the joint velocities are empty
+   * @throws IncompatibleStatesException if the joint velocities have other joint names
+   */
+  void multiply(const JointVelocities& velocities, CartesianTwist& twist) const;
+
+private:
+  /**
+   * @brief Give the output joint state the name and joint names of the Jacobian if it does not have them yet
+   */
+  template<class S>
+  void prepare_output(S& output) const;
+
+  /**
+   * @brief Give the output Cartesian state the frame and reference frame of the Jacobian if it does not have them yet
+   */
+  void prepare_output(CartesianTwist& output) const;
+
+  void assert_compatible_reference_frame(const CartesianState& state) const;
+
+  std::string name_;                    ///< name of the associated robot
+  std::vector<std::string> joint_names_;///< names of the joints
+  std::string frame_;                   ///< name of the frame at which the Jacobian is computed
+  std::string reference_frame_;         ///< name of the reference frame in which the Jacobian is expressed
+  MatrixType data_;                     ///< internal storage of the Jacobian matrix
+  mutable Eigen::JacobiSVD<MatrixType> decomposition_;///< cached decomposition of the data
+  mutable bool decomposition_valid_;    ///< whether the cached decomposition is computed from the current data
+};
+
+template<int N>
+FixedJacobian<N>::FixedJacobian(
+    const std::string& robot_name, const std::string& frame, const std::string& reference_frame
+) :
+    name_(robot_name),
+    joint_names_(N),
+    frame_(frame),
+    reference_frame_(reference_frame),
+    data_(MatrixType::Zero()),
+    decomposition_valid_(false) {
+  for (int i = 0; i < N; ++i) {
+    this->joint_names_[i] = "joint" + std::to_string(i);
+  }
+}
+
+template<int N>
+FixedJacobian<N>::FixedJacobian(
+    const std::string& robot_name, const std::vector<std::string>& joint_names, const std::string& frame,
+    const std::string& reference_frame
+) : FixedJacobian(robot_name, frame, reference_frame) {
+  if (joint_names.size() != N) {
+    throw exceptions::IncompatibleSizeException(
+        "Input vector of joint names is of incorrect size, expected " + std::to_string(N) + " got "
+            + std::to_string(joint_names.size()));
+  }
+  this->joint_names_ = joint_names;
+}
+
+template<int N>
+FixedJacobian<N>::FixedJacobian(const Jacobian& jacobian) :
+    FixedJacobian(jacobian.get_name(), jacobian.get_joint_names(), jacobian.get_frame(),
+                  jacobian.get_reference_frame()) {
+  this->data_ = jacobian.data();
+}
+
+template<int N>
+inline const std::string& FixedJacobian<N>::get_name() const {
+  return this->name_;
+}
+
+template<int N>
+inline const std::vector<std::string>& FixedJacobian<N>::get_joint_names() const {
+  return this->joint_names_;
+}
+
+template<int N>
+inline const std::string& FixedJacobian<N>::get_frame() const {
+  return this->frame_;
+}
+
+template<int N>
+inline const std::string& FixedJacobian<N>::get_reference_frame() const {
+  return this->reference_frame_;
+}
+
+template<int N>
+inline const typename FixedJacobian<N>::MatrixType& FixedJacobian<N>::data() const {
+  return this->data_;
+}
+
+template<int N>
+inline void FixedJacobian<N>::set_data(const MatrixType& data) {
+  this->data_ = data;
+  this->decomposition_valid_ = false;
+}
+
+template<int N>
+void FixedJacobian<N>::set_data(const Jacobian& jacobian) {
+  if (jacobian.get_joint_names() != this->joint_names_ || jacobian.get_reference_frame() != this->reference_frame_) {
+    throw exceptions::IncompatibleStatesException(
+        "The Jacobian " + jacobian.get_name() + " has other joint names or another reference frame");
+  }
+  this->set_data(jacobian.data());
+}
+
+template<int N>
+Jacobian FixedJacobian<N>::to_jacobian() const {
+  return Jacobian(this->name_, this->joint_names_, this->frame_, this->data_, this->reference_frame_);
+}
+
+template<int N>
+const Eigen::JacobiSVD<typename FixedJacobian<N>::MatrixType>& FixedJacobian<N>::get_decomposition() const {
+  if (!this->decomposition_valid_) {
+    this->decomposition_.compute(this->data_, Eigen::ComputeFullU | Eigen::ComputeFullV);
+    this->decomposition_valid_ = true;
+  }
+  return this->decomposition_;
+}
+
+template<int N>
+Eigen::Matrix<double, N, 6> FixedJacobian<N>::pseudoinverse() const {
+  return this->get_decomposition().solve(Eigen::Matrix<double, 6, 6>::Identity());
+}
+
+template<int N>
+void FixedJacobian<N>::pseudoinverse(const CartesianTwist& twist, JointVelocities& velocities) const {
+  this->assert_compatible_reference_frame(twist);
+  this->prepare_output(velocities);
+  velocities.get_variable_map(JointStateVariable::VELOCITIES) = this->get_decomposition().solve(twist.get_twist());
+  velocities.set_empty(false);
+}
+
+template<int N>
+void FixedJacobian<N>::transpose(const CartesianWrench& wrench, JointTorques& torques) const {
+  this->assert_compatible_reference_frame(wrench);
+  this->prepare_output(torques);
+  torques.get_variable_map(JointStateVariable::TORQUES).noalias() = this->data_.transpose() * wrench.get_wrench();
+  torques.set_empty(false);
+}
+
+template<int N>
+void FixedJacobian<N>::multiply(const JointVelocities& velocities, CartesianTwist& twist) const {
+  if (velocities.is_empty()) {
+    throw exceptions::EmptyStateException(velocities.get_name() + " state is empty");
+  }
+  if (velocities.get_names() != this->joint_names_) {
+    throw exceptions::IncompatibleStatesException("The Jacobian and the input JointVelocities are incompatible");
+  }
+  this->prepare_output(twist);
+  Eigen::Matrix<double, 6, 1> result;
+  result.noalias() = this->data_ * velocities.get_variable_map(JointStateVariable::VELOCITIES);
+  twist.get_variable_map(CartesianStateVariable::LINEAR_VELOCITY) = result.head<3>();
+  twist.get_variable_map(CartesianStateVariable::ANGULAR_VELOCITY) = result.tail<3>();
+  twist.set_empty(false);
+}
+
+template<int N>
+template<class S>
+void FixedJacobian<N>::prepare_output(S& output) const {
+  if (output.get_name() != this->name_ || output.get_names() != this->joint_names_) {
+    output = S(this->name_, this->joint_names_);
+  }
+}
+
+template<int N>
+void FixedJacobian<N>::prepare_output(CartesianTwist& output) const {
+  if (output.get_name() != this->frame_ || output.get_reference_frame() != this->reference_frame_) {
+    output = CartesianTwist(this->frame_, this->reference_frame_);
+  }
+}
+
+template<int N>
+void FixedJacobian<N>::assert_compatible_reference_frame(const CartesianState& state) const {
+  if (state.get_reference_frame() != this->reference_frame_) {
+    throw exceptions::IncompatibleStatesException(
+        "The Jacobian and the given Cartesian state " + state.get_name() + " are incompatible");
+  }
+}
+}// namespace state_representation
@@ -79,6 +79,12 @@ public:
    */
   Jacobian(const Jacobian& jacobian);
 
+  /**
+   * @brief Move constructor, leaving the moved-from Jacobian empty
+   * @param jacobian The Jacobian to move from
+   */
+  Jacobian(Jacobian&& jacobian) noexcept;
+
   /**
    * @brief Constructor for a random Jacobian
    * @param robot_name The name of the associated robot
@@ -119,6 +125,13 @@ public:
    */
   Jacobian& operator=(const Jacobian& jacobian);
 
+  /**
+   * @brief Move assignment operator, leaving the moved-from Jacobian empty
+   * @param jacobian The Jacobian to move from
+   * @return Reference to the current Jacobian with new values
+   */
+  Jacobian& operator=(Jacobian&& jacobian) noexcept;
+
   /**
    * @brief Getter of the number of rows attribute
    */
@@ -0,0 +1,189 @@
+#pragma once
+
+#include <eigen3/Eigen/Cholesky>
+#include <eigen3/Eigen/SVD>
+
+#include "state_representation/space/Jacobian.hpp"
+
+namespace state_representation {
+
+/**
+ * @class JacobianPseudoinverse
+ * @brief Damped pseudoinverse of a Jacobian, decomposed once and reused for several right-hand sides
+ * @details When the Jacobian has at least as many columns as rows and is well-conditioned, the pseudoinverse is
+ * computed from the LDLT decomposition of the 6x6 matrix JJ^T, with a condition number estimated from it. Otherwise,
+ * or if the estimated condition number exceeds the threshold, the singular value decomposition of the Jacobian is
+ * used instead. Near singularities, when the smallest singular value gets below the largest one divided by the
+ * condition threshold, the inverse of the singular values is damped with a factor growing from zero to the maximum
+ * damping as the smallest singular value goes to zero.
+ */
+class JacobianPseudoinverse {
+public:
+  /**
+   * @brief Constructor with the condition threshold and maximum damping
+   * @param condition_threshold The condition number above which the singular value decomposition is used and the
+   * singular values get damped (default is 100)
+   * @param max_damping The damping factor applied at a singularity (default is 0.1)
+   */
+  explicit JacobianPseudoinverse(double condition_threshold = 100., double max_damping = 0.1);
+
+  /**
+   * @brief Constructor decomposing a Jacobian
+   * @param jacobian The Jacobian to decompose
+   * @param condition_threshold The condition number above which the singular value decomposition is used and the
+   * singular values get damped (default is 100)
+   * @param max_damping The damping factor applied at a singularity (default is 0.1)
+   */
+  explicit JacobianPseudoinverse(
+      const Jacobian& jacobian, double condition_threshold = 100., double max_damping = 0.1
+  );
+
+  /**
+   * @brief Getter of the condition threshold
+   */
+  double get_condition_threshold() const;
+
+  /**
+   * @brief Setter of the condition threshold, which applies from the next decomposition
+   * @param condition_threshold The condition threshold, greater than 1
+   */
+  void set_condition_threshold(double condition_threshold);
+
+  /**
+   * @brief Getter of the maximum damping
+   */
+  double get_max_damping() const;
+
+  /**
+   * @brief Setter of the maximum damping, which applies from the next decomposition
+   * @param max_damping The positive maximum damping
+   */
+  void set_max_damping(double max_damping);
+
+  /**
+   * @brief Decompose a Jacobian, reusing the storage of the previous decomposition
+   * @param jacobian The Jacobian to decompose
+   * @throws EmptyStateException if the Jacobian is empty
+   */
+  void compute(const Jacobian& jacobian);
+
+  /**
+   * @brief Check if a Jacobian has been decomposed
+   */
+  bool is_computed() const;
+
+  /**
+   * @brief Check if the last decomposition used the singular value decomposition instead of the LDLT fast path
+   */
+  bool uses_svd() const;
+
+  /**
+   * @brief Getter of the condition number of the Jacobian, which is an estimate if the LDLT fast path is used
+   */
+  double get_condition_number() const;
+
+  /**
+   * @brief Getter of the manipulability measure of the Jacobian, as the product of its singular values
+   */
+  double get_manipulability() const;
+
+  /**
+   * @brief Getter of the damping factor applied to the singular values, zero away from singularities
+   */
+  double get_damping() const;
+
+  /**
+   * @brief Getter of the decomposed Jacobian
+   */
+  const Jacobian& get_jacobian() const;
+
+  /**
+   * @brief Compute the pseudoinverse matrix
+   * @return The pseudoinverse of the Jacobian, of size number of joints x 6
+   */
+  Eigen::MatrixXd get_pseudoinverse() const;
+
+  /**
+   * @brief Multiply a matrix by the pseudoinverse
+   * @param matrix The matrix with 6 rows
+   * @return The product of the pseudoinverse with the matrix
+   */
+  Eigen::MatrixXd solve(const Eigen::MatrixXd& matrix) const;
+
+  /**
+   * @brief Compute the joint velocities of a twist
+   * @param twist The Cartesian twist
+   * @return The joint velocities
+   */
+  JointVelocities solve(const CartesianTwist& twist) const;
+
+  /**
+   * @brief Compute the joint velocities of a twist into existing joint velocities, without allocation once they
+   * have the name and joint names of the Jacobian
+   * @param twist The Cartesian twist
+   * @param velocities The joint velocities in which to write the result
+   */
+  void solve(const CartesianTwist& twist, JointVelocities& velocities) const;
+
+private:
+  /**
+   * @brief Throw if no Jacobian has been decomposed yet
+   */
+  void assert_computed() const;
+
+  /**
+   * @brief Decompose the Jacobian with the singular value decomposition and compute the damped inverse of the
+   * singular values
+   */
+  void compute_svd();
+
+  /**
+   * @brief Multiply a 6-vector by the pseudoinverse into an existing vector
+   */
+  void solve_vector(const Eigen::Matrix<double, 6, 1>& vector, Eigen::Ref<Eigen::VectorXd> result) const;
+
+  double condition_threshold_;                   ///< condition number above which the SVD and damping are used
+  double max_damping_;                           ///< damping factor at a singularity
+  Jacobian jacobian_;                            ///< the decomposed Jacobian
+  Eigen::LDLT<Eigen::Matrix<double, 6, 6>> ldlt_;///< decomposition of JJ^T for the fast path
+  Eigen::JacobiSVD<Eigen::MatrixXd> svd_;        ///< singular value decomposition of the Jacobian
+  Eigen::VectorXd inverse_singular_values_;      ///< damped inverse of the singular values
+  bool computed_;                                ///< whether a Jacobian has been decomposed
+  bool use_svd_;                                 ///< whether the last decomposition used the SVD
+  double condition_number_;                      ///< condition number of the Jacobian
+  double manipulability_;                        ///< manipulability measure of the Jacobian
+  double damping_;                               ///< damping factor applied to the singular values
+};
+
+inline double JacobianPseudoinverse::get_condition_threshold() const {
+  return this->condition_threshold_;
+}
+
+inline double JacobianPseudoinverse::get_max_damping() const {
+  return this->max_damping_;
+}
+
+inline bool JacobianPseudoinverse::is_computed() const {
+  return this->computed_;
+}
+
+inline bool JacobianPseudoinverse::uses_svd() const {
+  return this->use_svd_;
+}
+
+inline double JacobianPseudoinverse::get_condition_number() const {
+  return this->condition_number_;
+}
+
+inline double JacobianPseudoinverse::get_manipulability() const {
+  return this->manipulability_;
+}
+
+inline double JacobianPseudoinverse::get_damping() const {
+  return this->damping_;
+}
+
+inline const Jacobian& JacobianPseudoinverse::get_jacobian() const {
+  return this->jacobian_;
+}
+}// namespace state_representation
@@ -23,6 +23,12 @@ public:
    */
   SpatialState(const SpatialState& state);
 
+  /**
+   * @brief Move constructor, leaving the moved-from state empty
+   * @param state The state to move from
+   */
+  SpatialState(SpatialState&& state) noexcept;
+
   /**
    * @brief Swap the values of the two SpatialState
    * @param state1 Spatial state to be swapped with 2
@@ -37,16 +43,35 @@ public:
    */
   SpatialState& operator=(const SpatialState& state);
 
+  /**
+   * @brief Move assignment operator, leaving the moved-from state empty
+   * @param state The state to move from
+   * @return Reference to the current state with new values
+   */
+  SpatialState& operator=(SpatialState&& state) noexcept;
+
   /**
    * @brief Getter of the reference frame as const reference
    */
   const std::string& get_reference_frame() const;
 
+  /**
+   * @brief Getter of the identifier of the reference frame in the frame registry, to compare frames without comparing
+   * strings
+   */
+  FrameId get_reference_frame_id() const;
+
   /**
    * @brief Setter of the reference frame
    */
   virtual void set_reference_frame(const std::string& reference_frame);
 
+  /**
+   * @brief Setter of the reference frame from its identifier in the frame registry, without copying the string
+   * @param reference_frame_id The identifier of the name of another state or frame
+   */
+  void set_reference_frame_id(FrameId reference_frame_id);
+
   /**
    * @brief Check if the spatial state is incompatible for operations with the state given as argument
    * @param state The state to check compatibility with
@@ -68,12 +93,12 @@ protected:
   std::string to_string() const override;
 
 private:
-  std::string reference_frame_; ///< name of the reference frame
+  FrameReference reference_frame_;///< name of the reference frame in the frame registry
 };
 
 inline void swap(SpatialState& state1, SpatialState& state2) {
   swap(static_cast<State&>(state1), static_cast<State&>(state2));
-  std::swap(state1.reference_frame_, state2.reference_frame_);
+  swap(state1.reference_frame_, state2.reference_frame_);
 }
 
 }// namespace state_representation
@@ -89,6 +89,12 @@ public:
    */
   CartesianAcceleration(const CartesianAcceleration& acceleration);
 
+  /**
+   * @brief Move constructor, leaving the moved-from acceleration empty
+   * @param acceleration The acceleration to move from
+   */
+  CartesianAcceleration(CartesianAcceleration&& acceleration) noexcept;
+
   /**
    * @brief Copy constructor from a Cartesian state
    */
@@ -145,6 +151,13 @@ public:
    */
   CartesianAcceleration& operator=(const CartesianAcceleration& acceleration) = default;
 
+  /**
+   * @brief Move assignment operator, leaving the moved-from acceleration empty
+   * @param acceleration The acceleration to move from
+   * @return Reference to the current acceleration with new values
+   */
+  CartesianAcceleration& operator=(CartesianAcceleration&& acceleration) = default;
+
   /**
  * @brief Returns the acceleration data as an Eigen vector
  */
@@ -84,6 +84,12 @@ public:
    */
   CartesianPose(const CartesianPose& pose);
 
+  /**
+   * @brief Move constructor, leaving the moved-from pose empty
+   * @param pose The pose to move from
+   */
+  CartesianPose(CartesianPose&& pose) noexcept;
+
   /**
    * @brief Copy constructor from a Cartesian state
    */
@@ -166,6 +172,13 @@ public:
    */
   CartesianPose& operator=(const CartesianPose& pose) = default;
 
+  /**
+   * @brief Move assignment operator, leaving the moved-from pose empty
+   * @param pose The pose to move from
+   * @return Reference to the current pose with new values
+   */
+  CartesianPose& operator=(CartesianPose&& pose) = default;
+
   /**
    * @brief Returns the pose data as an Eigen vector
    */
@@ -8,6 +8,12 @@ namespace state_representation {
 
 class CartesianState;
 
+template<class Derived>
+class CartesianStateExpression;
+
+template<int N>
+class FixedJacobian;
+
 /**
  * @enum CartesianStateAttribute
  * @brief Enum representing the attributes (position, orientation, angular_velocity, ...)
@@ -63,6 +69,12 @@ public:
    */
   CartesianState(const CartesianState& state);
 
+  /**
+   * @brief Move constructor, leaving the moved-from state empty
+   * @param state The state to move from
+   */
+  CartesianState(CartesianState&& state) noexcept;
+
   /**
    * @brief Constructor for the identity Cartesian state (identity pose and 0 for the rest)
    */
@@ -87,6 +99,13 @@ public:
    */
   CartesianState& operator=(const CartesianState& state);
 
+  /**
+   * @brief Move assignment operator, leaving the moved-from state empty
+   * @param state The state to move from
+   * @return Reference to the current state with new values
+   */
+  CartesianState& operator=(CartesianState&& state) noexcept;
+
   /**
    * @brief Getter of the position attribute
    */
@@ -161,6 +180,48 @@ public:
    */
   Eigen::Matrix<double, 6, 1> get_wrench() const;
 
+  /**
+   * @brief Getter of the position attribute without checking that the state is not empty
+   * @details The unchecked getters are meant for loops on states that have already been validated, for instance at
+   * the entry of a controller. The state variables of an empty state hold unspecified values.
+   */
+  const Eigen::Vector3d& get_position_unchecked() const noexcept;
+
+  /**
+   * @brief Getter of the orientation attribute without checking that the state is not empty
+   */
+  const Eigen::Quaterniond& get_orientation_unchecked() const noexcept;
+
+  /**
+   * @brief Getter of the linear velocity attribute without checking that the state is not empty
+   */
+  const Eigen::Vector3d& get_linear_velocity_unchecked() const noexcept;
+
+  /**
+   * @brief Getter of the angular velocity attribute without checking that the state is not empty
+   */
+  const Eigen::Vector3d& get_angular_velocity_unchecked() const noexcept;
+
+  /**
+   * @brief Getter of the linear acceleration attribute without checking that the state is not empty
+   */
+  const Eigen::Vector3d& get_linear_acceleration_unchecked() const noexcept;
+
+  /**
+   * @brief Getter of the angular acceleration attribute without checking that the state is not empty
+   */
+  const Eigen::Vector3d& get_angular_acceleration_unchecked() const noexcept;
+
+  /**
+   * @brief Getter of the force attribute without checking that the state is not empty
+   */
+  const Eigen::Vector3d& get_force_unchecked() const noexcept;
+
+  /**
+   * @brief Getter of the torque attribute without checking that the state is not empty
+   */
+  const Eigen::Vector3d& get_torque_unchecked() const noexcept;
+
   /**
    * @brief Return the data as the concatenation of all the state variables in a single vector
    */
@@ -577,12 +638,45 @@ public:
    */
   void set_state_variable(const std::vector<double>& new_value, const CartesianStateVariable& state_variable_type);
 
+  /**
+   * @brief Getter of a mutable view of a vector state variable, to write it in place without allocation
+   * @details Writing through the view neither fills the state nor resets its timestamp, which is done with
+   * State::set_empty. The orientation is written with set_orientation, which does not allocate either.
+   * @param state_variable_type The type of variable to view, one of POSITION, LINEAR_VELOCITY, ANGULAR_VELOCITY,
+   * LINEAR_ACCELERATION, ANGULAR_ACCELERATION, FORCE or TORQUE
+   * @throws exceptions::InvalidStateVariableException if the state variable is not a vector
+   * @return The view of the variable
+   */
+  Eigen::Map<Eigen::Vector3d> get_variable_map(const CartesianStateVariable& state_variable_type) &;
+  Eigen::Map<Eigen::Vector3d> get_variable_map(const CartesianStateVariable& state_variable_type) && = delete;
+
 protected:
   /**
    * @copydoc SpatialState::to_string
    */
   std::string to_string() const override;
 
+  /**
+   * @brief Transform only some state variables of a Cartesian state by the pose of the current state
+   * @details This is the transform operator for the derived classes of which all the other state variables are
+   * zero, such that the terms involving the twist and acceleration of the current state vanish and only the
+   * transformed variables need to be computed.
+   * @param state A Cartesian state expressed in the current state frame
+   * @param state_variable_type The state variables to transform, one of POSE, TWIST, ACCELERATION or WRENCH
+   * @param result The state in which to write the transformed variables, named after the state and expressed in the
+   * current reference frame, which can be the current state itself as its other state variables are left untouched
+   */
+  void transform_by_pose(
+      const CartesianState& state, const CartesianStateVariable& state_variable_type, CartesianState& result
+  ) const;
+
+  /**
+   * @brief Invert only some state variables of the current state, all the other ones being zero
+   * @param state_variable_type The state variables to invert, one of POSE, TWIST or ACCELERATION
+   * @param result The state in which to write the inverted variables, with inverted name and reference frame
+   */
+  void invert(const CartesianStateVariable& state_variable_type, CartesianState& result) const;
+
 private:
   Eigen::Vector3d position_;            ///< position of the point
   Eigen::Quaterniond orientation_;      ///< orientation of the point
@@ -594,6 +688,60 @@ private:
   Eigen::Vector3d torque_;              ///< torque applied at the point
 };
 
+inline const Eigen::Vector3d& CartesianState::get_position_unchecked() const noexcept {
+  return this->position_;
+}
+
+inline const Eigen::Quaterniond& CartesianState::get_orientation_unchecked() const noexcept {
+  return this->orientation_;
+}
+
+inline const Eigen::Vector3d& CartesianState::get_linear_velocity_unchecked() const noexcept {
+  return this->linear_velocity_;
+}
+
+inline const Eigen::Vector3d& CartesianState::get_angular_velocity_unchecked() const noexcept {
+  return this->angular_velocity_;
+}
+
+inline const Eigen::Vector3d& CartesianState::get_linear_acceleration_unchecked() const noexcept {
+  return this->linear_acceleration_;
+}
+
+inline const Eigen::Vector3d& CartesianState::get_angular_acceleration_unchecked() const noexcept {
+  return this->angular_acceleration_;
+}
+
+inline const Eigen::Vector3d& CartesianState::get_force_unchecked() const noexcept {
+  return this->force_;
+}
+
+inline const Eigen::Vector3d& CartesianState::get_torque_unchecked() const noexcept {
+  return this->torque_;
+}
+
+inline Eigen::Map<Eigen::Vector3d>
+CartesianState::get_variable_map(const CartesianStateVariable& state_variable_type) & {
+  switch (state_variable_type) {
+    case CartesianStateVariable::POSITION:
+      return Eigen::Map<Eigen::Vector3d>(this->position_.data());
+    case CartesianStateVariable::LINEAR_VELOCITY:
+      return Eigen::Map<Eigen::Vector3d>(this->linear_velocity_.data());
+    case CartesianStateVariable::ANGULAR_VELOCITY:
+      return Eigen::Map<Eigen::Vector3d>(this->angular_velocity_.data());
+    case CartesianStateVariable::LINEAR_ACCELERATION:
+      return Eigen::Map<Eigen::Vector3d>(this->linear_acceleration_.data());
+    case CartesianStateVariable::ANGULAR_ACCELERATION:
+      return Eigen::Map<Eigen::Vector3d>(this->angular_acceleration_.data());
+    case CartesianStateVariable::FORCE:
+      return Eigen::Map<Eigen::Vector3d>(this->force_.data());
+    case CartesianStateVariable::TORQUE:
+      return Eigen::Map<Eigen::Vector3d>(this->torque_.data());
+    default:
+      throw exceptions::InvalidStateVariableException("The Cartesian state variable is not a vector");
+  }
+}
+
 inline void swap(CartesianState& state1, CartesianState& state2) {
   swap(static_cast<SpatialState&>(state1), static_cast<SpatialState&>(state2));
   std::swap(state1.position_, state2.position_);
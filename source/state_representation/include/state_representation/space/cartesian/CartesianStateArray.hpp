@@ -0,0 +1,261 @@
+#pragma once
+
+#include "state_representation/space/cartesian/CartesianState.hpp"
+
+namespace state_representation {
+
+/**
+ * @class CartesianStateArray
+ * @brief Class to represent many samples of a Cartesian state of the same frame, stored as a structure of arrays
+ * @details Each state variable is stored as a column-major array with one row per sample, such that each coordinate
+ * of all the samples is contiguous in memory. The array always holds the positions and orientations of the samples,
+ * the orientations using the (w, x, y, z) convention of the quaternion coefficients. The twist and the wrench are
+ * only held once added, and accelerations are not supported.
+ */
+class CartesianStateArray {
+public:
+  using Vector3Array = Eigen::Matrix<double, Eigen::Dynamic, 3>;
+  using QuaternionArray = Eigen::Matrix<double, Eigen::Dynamic, 4>;
+
+  /**
+   * @brief Constructor with name, reference frame and number of samples, initialized to the identity pose
+   * @param name The name of the frame of the samples
+   * @param reference The reference frame of the samples (default is "world")
+   * @param size The number of samples (default is 0)
+   */
+  explicit CartesianStateArray(const std::string& name, const std::string& reference = "world", Eigen::Index size = 0);
+
+  /**
+   * @brief Getter of the name
+   */
+  const std::string& get_name() const;
+
+  /**
+   * @brief Setter of the name
+   */
+  void set_name(const std::string& name);
+
+  /**
+   * @brief Getter of the reference frame
+   */
+  const std::string& get_reference_frame() const;
+
+  /**
+   * @brief Setter of the reference frame
+   */
+  void set_reference_frame(const std::string& reference);
+
+  /**
+   * @brief Getter of the number of samples
+   */
+  Eigen::Index size() const;
+
+  /**
+   * @brief Change the number of samples, keeping the existing ones and initializing the new ones to the identity
+   * pose and zero twist and wrench
+   * @param size The number of samples
+   */
+  void resize(Eigen::Index size);
+
+  /**
+   * @brief Add a state variable to the ones held by the array, initialized to zero for all samples
+   * @details The linear and angular velocities are added together as the twist, and the force and torque as the
+   * wrench. Adding the position, orientation or pose has no effect as they are always held.
+   * @param variable The state variable to add
+   * @throws InvalidStateVariableException if the variable is an acceleration or all the variables
+   */
+  void add_variable(const CartesianStateVariable& variable);
+
+  /**
+   * @brief Check if the array holds the twists of the samples
+   */
+  bool has_twists() const;
+
+  /**
+   * @brief Check if the array holds the wrenches of the samples
+   */
+  bool has_wrenches() const;
+
+  /**
+   * @brief Getter of the positions, one sample per row
+   */
+  const Vector3Array& get_positions() const;
+
+  /**
+   * @brief Getter of the orientations as (w, x, y, z) quaternion coefficients, one sample per row
+   */
+  const QuaternionArray& get_orientations() const;
+
+  /**
+   * @brief Getter of the linear velocities, one sample per row, or an empty array if the twists are not held
+   */
+  const Vector3Array& get_linear_velocities() const;
+
+  /**
+   * @brief Getter of the angular velocities, one sample per row, or an empty array if the twists are not held
+   */
+  const Vector3Array& get_angular_velocities() const;
+
+  /**
+   * @brief Getter of the forces, one sample per row, or an empty array if the wrenches are not held
+   */
+  const Vector3Array& get_forces() const;
+
+  /**
+   * @brief Getter of the torques, one sample per row, or an empty array if the wrenches are not held
+   */
+  const Vector3Array& get_torques() const;
+
+  /**
+   * @brief Setter of the positions
+   * @param positions The positions with one row per sample
+   * @throws IncompatibleSizeException if the number of rows differs from the number of samples
+   */
+  void set_positions(const Eigen::Ref<const Vector3Array>& positions);
+
+  /**
+   * @brief Setter of the orientations, which get normalized
+   * @param orientations The (w, x, y, z) quaternion coefficients with one row per sample
+   * @throws IncompatibleSizeException if the number of rows differs from the number of samples
+   */
+  void set_orientations(const Eigen::Ref<const QuaternionArray>& orientations);
+
+  /**
+   * @brief Setter of the linear velocities, adding the twists to the held variables
+   * @param linear_velocities The linear velocities with one row per sample
+   * @throws IncompatibleSizeException if the number of rows differs from the number of samples
+   */
+  void set_linear_velocities(const Eigen::Ref<const Vector3Array>& linear_velocities);
+
+  /**
+   * @brief Setter of the angular velocities, adding the twists to the held variables
+   * @param angular_velocities The angular velocities with one row per sample
+   * @throws IncompatibleSizeException if the number of rows differs from the number of samples
+   */
+  void set_angular_velocities(const Eigen::Ref<const Vector3Array>& angular_velocities);
+
+  /**
+   * @brief Setter of the forces, adding the wrenches to the held variables
+   * @param forces The forces with one row per sample
+   * @throws IncompatibleSizeException if the number of rows differs from the number of samples
+   */
+  void set_forces(const Eigen::Ref<const Vector3Array>& forces);
+
+  /**
+   * @brief Setter of the torques, adding the wrenches to the held variables
+   * @param torques The torques with one row per sample
+   * @throws IncompatibleSizeException if the number of rows differs from the number of samples
+   */
+  void set_torques(const Eigen::Ref<const Vector3Array>& torques);
+
+  /**
+   * @brief Get one sample as a Cartesian state with the name and reference frame of the array
+   * @param index The index of the sample
+   * @return The Cartesian state with the held variables of the sample
+   * @throws std::out_of_range if the index is out of the range of the samples
+   */
+  CartesianState get_state(Eigen::Index index) const;
+
+  /**
+   * @brief Set one sample from the held variables of a Cartesian state
+   * @param index The index of the sample
+   * @param state The Cartesian state expressed in the reference frame of the array
+   * @throws std::out_of_range if the index is out of the range of the samples
+   * @throws EmptyStateException if the state is empty
+   * @throws IncompatibleReferenceFramesException if the state is not expressed in the reference frame of the array
+   */
+  void set_state(Eigen::Index index, const CartesianState& state);
+
+  /**
+   * @brief Transform all the samples by a Cartesian state in place, without allocation
+   * @details With the samples expressed in frame B and the state being B expressed in W, the result are the samples
+   * expressed in W, computed as the product state * sample for each sample. Only the variables held by the array are
+   * transformed, the twist of the state being used only if the array holds the twists.
+   * @param state The Cartesian state named after the reference frame of the array
+   * @throws EmptyStateException if the state is empty
+   * @throws IncompatibleReferenceFramesException if the state is not named after the reference frame of the array
+   */
+  void transform(const CartesianState& state);
+
+  /**
+   * @brief Transform all the samples by a Cartesian state
+   * @copydetails CartesianStateArray::transform
+   * @return The transformed samples expressed in the reference frame of the state
+   */
+  friend CartesianStateArray operator*(const CartesianState& state, const CartesianStateArray& array);
+
+private:
+  /**
+   * @brief Throw if the number of rows of an array differs from the number of samples
+   */
+  void assert_size(Eigen::Index rows) const;
+
+  /**
+   * @brief Throw if an index is out of the range of the samples
+   */
+  void assert_index_in_range(Eigen::Index index) const;
+
+  FrameReference name_;                 ///< name of the frame of the samples
+  FrameReference reference_frame_;      ///< reference frame of the samples
+  Vector3Array positions_;              ///< positions of the samples
+  QuaternionArray orientations_;        ///< orientations of the samples as (w, x, y, z) coefficients
+  bool has_twists_;                     ///< whether the twists of the samples are held
+  Vector3Array linear_velocities_;      ///< linear velocities of the samples
+  Vector3Array angular_velocities_;     ///< angular velocities of the samples
+  bool has_wrenches_;                   ///< whether the wrenches of the samples are held
+  Vector3Array forces_;                 ///< forces of the samples
+  Vector3Array torques_;                ///< torques of the samples
+};
+
+inline const std::string& CartesianStateArray::get_name() const {
+  return this->name_.get_name();
+}
+
+inline void CartesianStateArray::set_name(const std::string& name) {
+  this->name_ = FrameReference(name);
+}
+
+inline const std::string& CartesianStateArray::get_reference_frame() const {
+  return this->reference_frame_.get_name();
+}
+
+inline void CartesianStateArray::set_reference_frame(const std::string& reference) {
+  this->reference_frame_ = FrameReference(reference);
+}
+
+inline Eigen::Index CartesianStateArray::size() const {
+  return this->positions_.rows();
+}
+
+inline bool CartesianStateArray::has_twists() const {
+  return this->has_twists_;
+}
+
+inline bool CartesianStateArray::has_wrenches() const {
+  return this->has_wrenches_;
+}
+
+inline const CartesianStateArray::Vector3Array& CartesianStateArray::get_positions() const {
+  return this->positions_;
+}
+
+inline const CartesianStateArray::QuaternionArray& CartesianStateArray::get_orientations() const {
+  return this->orientations_;
+}
+
+inline const CartesianStateArray::Vector3Array& CartesianStateArray::get_linear_velocities() const {
+  return this->linear_velocities_;
+}
+
+inline const CartesianStateArray::Vector3Array& CartesianStateArray::get_angular_velocities() const {
+  return this->angular_velocities_;
+}
+
+inline const CartesianStateArray::Vector3Array& CartesianStateArray::get_forces() const {
+  return this->forces_;
+}
+
+inline const CartesianStateArray::Vector3Array& CartesianStateArray::get_torques() const {
+  return this->torques_;
+}
+}// namespace state_representation
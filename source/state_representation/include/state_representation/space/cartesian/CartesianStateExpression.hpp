@@ -0,0 +1,410 @@
+#pragma once
+
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
+#include "state_representation/MathTools.hpp"
+#include "state_representation/space/cartesian/CartesianState.hpp"
+#include "state_representation/space/cartesian/CartesianPose.hpp"
+#include "state_representation/space/cartesian/CartesianTwist.hpp"
+#include "state_representation/space/cartesian/CartesianAcceleration.hpp"
+#include "state_representation/space/cartesian/CartesianWrench.hpp"
+#include "state_representation/exceptions/EmptyStateException.hpp"
+#include "state_representation/exceptions/IncompatibleReferenceFramesException.hpp"
+
+namespace state_representation {
+
+/**
+ * @brief Type of the result of the sum or difference of Cartesian states of type L and R, which is the common type
+ * if both are the same and CartesianState if one of them is a CartesianState
+ */
+template<class L, class R>
+struct CartesianStateSumType {
+  static_assert(
+      std::is_same_v<L, R> || std::is_same_v<L, CartesianState> || std::is_same_v<R, CartesianState>,
+      "Cartesian states of different types can not be added or subtracted"
+  );
+  using type = std::conditional_t<std::is_same_v<L, R>, L, CartesianState>;
+};
+
+/**
+ * @class CartesianStateExpression
+ * @brief Base class of the lazy arithmetic expressions of Cartesian states
+ * @details An expression is built by wrapping a state with lazy() and combining it with other states or expressions
+ * using the operators +, - and the multiplication and division by a scalar, with the same meaning as the operators
+ * of CartesianState. Nothing is computed until the expression is evaluated, either by converting it to a state or by
+ * evaluating it into an existing state, without temporary states. The reference frames of the operands are checked
+ * once at evaluation. An expression holds references to its operands and should be evaluated while they are alive,
+ * typically in the statement that builds it.
+ * @tparam Derived The type of the expression node
+ */
+template<class Derived>
+class CartesianStateExpression {
+public:
+  /**
+   * @brief Getter of the expression node
+   */
+  const Derived& derived() const {
+    return static_cast<const Derived&>(*this);
+  }
+
+  /**
+   * @brief Evaluate the expression into a new state with the name and reference frame of the first operand
+   * @return The result of the expression
+   */
+  auto evaluate() const {
+    using ResultT = typename Derived::StateType;
+    const CartesianState& first = this->derived().first_state();
+    ResultT result;
+    result.set_name_id(first.get_name_id());
+    this->evaluate(result);
+    return result;
+  }
+
+  /**
+   * @brief Evaluate the expression into an existing state, expressed in the reference frame of the first operand
+   * @param result The state in which to write the result, which can also be an operand of the expression
+   */
+  template<class S>
+  void evaluate(S& result) const {
+    static_assert(std::is_same_v<S, typename Derived::StateType>, "The result is not of the type of the expression");
+    const CartesianState& first = this->derived().first_state();
+    this->derived().for_each_state(
+        [&first](const CartesianState& state) {
+          if (state.is_empty()) {
+            throw exceptions::EmptyStateException(state.get_name() + " state is empty");
+          }
+          if (state.get_reference_frame_id() != first.get_reference_frame_id()) {
+            throw exceptions::IncompatibleReferenceFramesException(
+                "The two states do not have the same reference frame"
+            );
+          }
+        }
+    );
+    CartesianState& output = result;
+    if (output.get_reference_frame_id() != first.get_reference_frame_id()) {
+      output.set_reference_frame_id(first.get_reference_frame_id());
+    }
+    constexpr bool all = std::is_same_v<S, CartesianState>;
+    if constexpr (all || std::is_same_v<S, CartesianPose>) {
+      output.get_variable_map(CartesianStateVariable::POSITION) =
+          this->derived().vector(CartesianStateVariable::POSITION);
+      output.set_orientation(this->derived().orientation());
+    }
+    if constexpr (all || std::is_same_v<S, CartesianTwist>) {
+      output.get_variable_map(CartesianStateVariable::LINEAR_VELOCITY) =
+          this->derived().vector(CartesianStateVariable::LINEAR_VELOCITY);
+      output.get_variable_map(CartesianStateVariable::ANGULAR_VELOCITY) =
+          this->derived().vector(CartesianStateVariable::ANGULAR_VELOCITY);
+    }
+    if constexpr (all || std::is_same_v<S, CartesianAcceleration>) {
+      output.get_variable_map(CartesianStateVariable::LINEAR_ACCELERATION) =
+          this->derived().vector(CartesianStateVariable::LINEAR_ACCELERATION);
+      output.get_variable_map(CartesianStateVariable::ANGULAR_ACCELERATION) =
+          this->derived().vector(CartesianStateVariable::ANGULAR_ACCELERATION);
+    }
+    if constexpr (all || std::is_same_v<S, CartesianWrench>) {
+      output.get_variable_map(CartesianStateVariable::FORCE) = this->derived().vector(CartesianStateVariable::FORCE);
+      output.get_variable_map(CartesianStateVariable::TORQUE) = this->derived().vector(CartesianStateVariable::TORQUE);
+    }
+    output.set_empty(false);
+  }
+
+  /**
+   * @brief Conversion to the state type of the expression, or to a CartesianState, by evaluation
+   */
+  template<class S, class D = Derived, std::enable_if_t<
+      std::is_base_of_v<CartesianState, S> && std::is_base_of_v<S, typename D::StateType>, int> = 0>
+  operator S() const {
+    return S(this->evaluate());
+  }
+
+protected:
+  /**
+   * @brief Getter of a vector state variable without copy or emptiness check
+   */
+  static const Eigen::Vector3d&
+  get_vector(const CartesianState& state, const CartesianStateVariable& state_variable_type) {
+    switch (state_variable_type) {
+      case CartesianStateVariable::LINEAR_VELOCITY:
+        return state.get_linear_velocity_unchecked();
+      case CartesianStateVariable::ANGULAR_VELOCITY:
+        return state.get_angular_velocity_unchecked();
+      case CartesianStateVariable::LINEAR_ACCELERATION:
+        return state.get_linear_acceleration_unchecked();
+      case CartesianStateVariable::ANGULAR_ACCELERATION:
+        return state.get_angular_acceleration_unchecked();
+      case CartesianStateVariable::FORCE:
+        return state.get_force_unchecked();
+      case CartesianStateVariable::TORQUE:
+        return state.get_torque_unchecked();
+      default:
+        return state.get_position_unchecked();
+    }
+  }
+
+  /**
+   * @brief Getter of the orientation without copy or emptiness check
+   */
+  static const Eigen::Quaterniond& get_orientation(const CartesianState& state) {
+    return state.get_orientation_unchecked();
+  }
+};
+
+/**
+ * @class CartesianStateReference
+ * @brief Leaf of a Cartesian state expression, referring to a state
+ * @tparam S The type of the state
+ */
+template<class S>
+class CartesianStateReference : public CartesianStateExpression<CartesianStateReference<S>> {
+public:
+  using StateType = S;
+
+  explicit CartesianStateReference(const S& state) : state_(state) {}
+
+  const CartesianState& first_state() const {
+    return this->state_;
+  }
+
+  template<typename F>
+  void for_each_state(const F& function) const {
+    function(static_cast<const CartesianState&>(this->state_));
+  }
+
+  const Eigen::Vector3d& vector(const CartesianStateVariable& state_variable_type) const {
+    return CartesianStateExpression<CartesianStateReference<S>>::get_vector(this->state_, state_variable_type);
+  }
+
+  const Eigen::Quaterniond& orientation() const {
+    return CartesianStateExpression<CartesianStateReference<S>>::get_orientation(this->state_);
+  }
+
+private:
+  const S& state_;
+};
+
+/**
+ * @class CartesianStateSum
+ * @brief Sum of two Cartesian state expressions, composing the orientations with the Hamilton product
+ */
+template<class L, class R>
+class CartesianStateSum : public CartesianStateExpression<CartesianStateSum<L, R>> {
+public:
+  using StateType = typename CartesianStateSumType<typename L::StateType, typename R::StateType>::type;
+
+  CartesianStateSum(const L& lhs, const R& rhs) : lhs_(lhs), rhs_(rhs) {}
+
+  const CartesianState& first_state() const {
+    return this->lhs_.first_state();
+  }
+
+  template<typename F>
+  void for_each_state(const F& function) const {
+    this->lhs_.for_each_state(function);
+    this->rhs_.for_each_state(function);
+  }
+
+  auto vector(const CartesianStateVariable& state_variable_type) const {
+    return this->lhs_.vector(state_variable_type) + this->rhs_.vector(state_variable_type);
+  }
+
+  Eigen::Quaterniond orientation() const {
+    Eigen::Quaterniond lhs = this->lhs_.orientation();
+    Eigen::Quaterniond orientation = lhs * this->rhs_.orientation();
+    if (orientation.dot(lhs) < 0) {
+      orientation = Eigen::Quaterniond(-orientation.coeffs());
+    }
+    return orientation;
+  }
+
+private:
+  const L lhs_;
+  const R rhs_;
+};
+
+/**
+ * @class CartesianStateDifference
+ * @brief Difference of two Cartesian state expressions, composing the orientations with the Hamilton product
+ * by the conjugate
+ */
+template<class L, class R>
+class CartesianStateDifference : public CartesianStateExpression<CartesianStateDifference<L, R>> {
+public:
+  using StateType = typename CartesianStateSumType<typename L::StateType, typename R::StateType>::type;
+
+  CartesianStateDifference(const L& lhs, const R& rhs) : lhs_(lhs), rhs_(rhs) {}
+
+  const CartesianState& first_state() const {
+    return this->lhs_.first_state();
+  }
+
+  template<typename F>
+  void for_each_state(const F& function) const {
+    this->lhs_.for_each_state(function);
+    this->rhs_.for_each_state(function);
+  }
+
+  auto vector(const CartesianStateVariable& state_variable_type) const {
+    return this->lhs_.vector(state_variable_type) - this->rhs_.vector(state_variable_type);
+  }
+
+  Eigen::Quaterniond orientation() const {
+    Eigen::Quaterniond lhs = this->lhs_.orientation();
+    Eigen::Quaterniond orientation = lhs * Eigen::Quaterniond(this->rhs_.orientation()).conjugate();
+    if (orientation.dot(lhs) < 0) {
+      orientation = Eigen::Quaterniond(-orientation.coeffs());
+    }
+    return orientation;
+  }
+
+private:
+  const L lhs_;
+  const R rhs_;
+};
+
+/**
+ * @class CartesianStateNegation
+ * @brief Negation of a Cartesian state expression, conjugating the orientation
+ */
+template<class E>
+class CartesianStateNegation : public CartesianStateExpression<CartesianStateNegation<E>> {
+public:
+  using StateType = typename E::StateType;
+
+  explicit CartesianStateNegation(const E& expression) : expression_(expression) {}
+
+  const CartesianState& first_state() const {
+    return this->expression_.first_state();
+  }
+
+  template<typename F>
+  void for_each_state(const F& function) const {
+    this->expression_.for_each_state(function);
+  }
+
+  auto vector(const CartesianStateVariable& state_variable_type) const {
+    return -this->expression_.vector(state_variable_type);
+  }
+
+  Eigen::Quaterniond orientation() const {
+    return Eigen::Quaterniond(this->expression_.orientation()).conjugate();
+  }
+
+private:
+  const E expression_;
+};
+
+/**
+ * @class CartesianStateScaling
+ * @brief Product of a Cartesian state expression with a scalar, scaling the orientation as a displacement
+ * from identity
+ */
+template<class E>
+class CartesianStateScaling : public CartesianStateExpression<CartesianStateScaling<E>> {
+public:
+  using StateType = typename E::StateType;
+
+  CartesianStateScaling(const E& expression, double lambda) : expression_(expression), lambda_(lambda) {}
+
+  const CartesianState& first_state() const {
+    return this->expression_.first_state();
+  }
+
+  template<typename F>
+  void for_each_state(const F& function) const {
+    this->expression_.for_each_state(function);
+  }
+
+  auto vector(const CartesianStateVariable& state_variable_type) const {
+    return this->lambda_ * this->expression_.vector(state_variable_type);
+  }
+
+  Eigen::Quaterniond orientation() const {
+    Eigen::Quaterniond orientation = this->expression_.orientation();
+    auto q = math_tools::exp(math_tools::log(orientation), this->lambda_);
+    if (orientation.w() * q.w() < 0) {
+      q = Eigen::Quaterniond(-q.coeffs());
+    }
+    return q;
+  }
+
+private:
+  const E expression_;
+  double lambda_;
+};
+
+template<class S>
+using enable_if_cartesian_state_t = std::enable_if_t<std::is_base_of_v<CartesianState, S>, int>;
+
+/**
+ * @brief Start a lazy expression of Cartesian states from a state
+ * @param state The state, which must outlive the expression
+ * @return The leaf of the expression referring to the state
+ */
+template<class S, enable_if_cartesian_state_t<S> = 0>
+CartesianStateReference<S> lazy(const S& state) {
+  return CartesianStateReference<S>(state);
+}
+
+template<class S, enable_if_cartesian_state_t<S> = 0>
+CartesianStateReference<S> lazy(const S&& state) = delete;
+
+template<class L, class R>
+CartesianStateSum<L, R> operator+(const CartesianStateExpression<L>& lhs, const CartesianStateExpression<R>& rhs) {
+  return CartesianStateSum<L, R>(lhs.derived(), rhs.derived());
+}
+
+template<class L, class S, enable_if_cartesian_state_t<S> = 0>
+CartesianStateSum<L, CartesianStateReference<S>> operator+(const CartesianStateExpression<L>& lhs, const S& rhs) {
+  return CartesianStateSum<L, CartesianStateReference<S>>(lhs.derived(), CartesianStateReference<S>(rhs));
+}
+
+template<class S, class R, enable_if_cartesian_state_t<S> = 0>
+CartesianStateSum<CartesianStateReference<S>, R> operator+(const S& lhs, const CartesianStateExpression<R>& rhs) {
+  return CartesianStateSum<CartesianStateReference<S>, R>(CartesianStateReference<S>(lhs), rhs.derived());
+}
+
+template<class L, class R>
+CartesianStateDifference<L, R>
+operator-(const CartesianStateExpression<L>& lhs, const CartesianStateExpression<R>& rhs) {
+  return CartesianStateDifference<L, R>(lhs.derived(), rhs.derived());
+}
+
+template<class L, class S, enable_if_cartesian_state_t<S> = 0>
+CartesianStateDifference<L, CartesianStateReference<S>>
+operator-(const CartesianStateExpression<L>& lhs, const S& rhs) {
+  return CartesianStateDifference<L, CartesianStateReference<S>>(lhs.derived(), CartesianStateReference<S>(rhs));
+}
+
+template<class S, class R, enable_if_cartesian_state_t<S> = 0>
+CartesianStateDifference<CartesianStateReference<S>, R>
+operator-(const S& lhs, const CartesianStateExpression<R>& rhs) {
+  return CartesianStateDifference<CartesianStateReference<S>, R>(CartesianStateReference<S>(lhs), rhs.derived());
+}
+
+template<class E>
+CartesianStateNegation<E> operator-(const CartesianStateExpression<E>& expression) {
+  return CartesianStateNegation<E>(expression.derived());
+}
+
+template<class E>
+CartesianStateScaling<E> operator*(double lambda, const CartesianStateExpression<E>& expression) {
+  return CartesianStateScaling<E>(expression.derived(), lambda);
+}
+
+template<class E>
+CartesianStateScaling<E> operator*(const CartesianStateExpression<E>& expression, double lambda) {
+  return CartesianStateScaling<E>(expression.derived(), lambda);
+}
+
+template<class E>
+CartesianStateScaling<E> operator/(const CartesianStateExpression<E>& expression, double lambda) {
+  if (std::abs(lambda) < std::numeric_limits<double>::min()) {
+    throw std::runtime_error("Division by zero is not allowed");
+  }
+  return CartesianStateScaling<E>(expression.derived(), 1.0 / lambda);
+}
+}// namespace state_representation
@@ -89,6 +89,12 @@ public:
    */
   CartesianTwist(const CartesianTwist& twist);
 
+  /**
+   * @brief Move constructor, leaving the moved-from twist empty
+   * @param twist The twist to move from
+   */
+  CartesianTwist(CartesianTwist&& twist) noexcept;
+
   /**
    * @brief Copy constructor from a Cartesian state
    */
@@ -151,6 +157,13 @@ public:
    */
   CartesianTwist& operator=(const CartesianTwist& twist) = default;
 
+  /**
+   * @brief Move assignment operator, leaving the moved-from twist empty
+   * @param twist The twist to move from
+   * @return Reference to the current twist with new values
+   */
+  CartesianTwist& operator=(CartesianTwist&& twist) = default;
+
   /**
  * @brief Returns the twist data as an Eigen vector
  */
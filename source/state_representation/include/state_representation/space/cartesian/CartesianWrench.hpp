@@ -90,6 +90,12 @@ public:
    */
   CartesianWrench(const CartesianWrench& wrench);
 
+  /**
+   * @brief Move constructor, leaving the moved-from wrench empty
+   * @param wrench The wrench to move from
+   */
+  CartesianWrench(CartesianWrench&& wrench) noexcept;
+
   /**
    * @brief Copy constructor from a Cartesian state
    */
@@ -140,6 +146,13 @@ public:
    */
   CartesianWrench& operator=(const CartesianWrench& wrench) = default;
 
+  /**
+   * @brief Move assignment operator, leaving the moved-from wrench empty
+   * @param wrench The wrench to move from
+   * @return Reference to the current wrench with new values
+   */
+  CartesianWrench& operator=(CartesianWrench&& wrench) = default;
+
   /**
    * @brief Returns the wrench data as an Eigen vector
    */
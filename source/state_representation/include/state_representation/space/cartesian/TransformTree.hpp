@@ -0,0 +1,169 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+
+#include "state_representation/space/cartesian/CartesianPose.hpp"
+
+namespace state_representation {
+
+/**
+ * @class TransformTree
+ * @brief Tree of reference frames holding a buffer of timestamped poses for each frame with respect to its parent
+ * @details Each frame has at most one parent, set by the reference frame of the first pose given for the frame, and
+ * a ring buffer of its last poses. The pose of a frame with respect to any other frame connected to it is composed
+ * along the path through their common ancestor, interpolating the pose of each edge of the path at the requested
+ * time: linearly for the position and spherically for the orientation. Times after the last pose of an edge use the
+ * last pose, such that a frame with a single pose is static. The paths between queried pairs of frames are cached.
+ * Setting poses takes a lock and allocates the first time a frame is seen, while getting a pose by frame identifiers
+ * is lock-free and does not allocate, such that reader threads never wait on the writers.
+ */
+class TransformTree {
+public:
+  static constexpr std::size_t MAX_DEPTH = 32;///< maximum number of edges between a frame and its root
+
+  /**
+   * @brief Constructor with the capacity of the tree
+   * @param max_frames The maximum number of frames in the tree (default is 64)
+   * @param buffer_size The number of poses buffered for each frame (default is 100)
+   * @param cache_size The number of paths between pairs of frames that are cached (default is 32)
+   */
+  explicit TransformTree(std::size_t max_frames = 64, std::size_t buffer_size = 100, std::size_t cache_size = 32);
+
+  /**
+   * @brief Destructor
+   */
+  ~TransformTree();
+
+  TransformTree(const TransformTree& tree) = delete;
+
+  TransformTree& operator=(const TransformTree& tree) = delete;
+
+  /**
+   * @brief Getter of the maximum number of frames in the tree
+   */
+  std::size_t get_max_frames() const;
+
+  /**
+   * @brief Getter of the number of poses buffered for each frame
+   */
+  std::size_t get_buffer_size() const;
+
+  /**
+   * @brief Getter of the number of frames in the tree
+   */
+  std::size_t size() const;
+
+  /**
+   * @brief Check if a frame is in the tree, without registering its name in the frame registry
+   * @param frame The name of the frame
+   */
+  bool has_frame(const std::string& frame) const;
+
+  /**
+   * @brief Add the pose of a frame with respect to its parent at the timestamp of the pose
+   * @param pose The pose named after the frame and expressed in its parent frame
+   * @copydetails TransformTree::set_transform(const CartesianPose&, const std::chrono::steady_clock::time_point&)
+   */
+  void set_transform(const CartesianPose& pose);
+
+  /**
+   * @brief Add the pose of a frame with respect to its parent at a given time
+   * @param pose The pose named after the frame and expressed in its parent frame
+   * @param time The time of the pose, which cannot be before the time of the last pose of the frame
+   * @throws EmptyStateException if the pose is empty
+   * @throws IncompatibleReferenceFramesException if the pose is expressed in its own frame, if the frame already has
+   * another parent or if the parent is a descendant of the frame
+   * @throws IncompatibleStatesException if the time is before the time of the last pose of the frame
+   * @throws std::length_error if the tree is full or the frame is too deep in the tree
+   */
+  void set_transform(const CartesianPose& pose, const std::chrono::steady_clock::time_point& time);
+
+  /**
+   * @brief Get the latest pose of a frame with respect to another frame
+   * @param frame The name of the frame
+   * @param reference_frame The name of the frame to express the pose in
+   * @return The pose of the frame expressed in the reference frame
+   * @throws IncompatibleReferenceFramesException if one of the frames is not in the tree or they are not connected
+   */
+  CartesianPose get_transform(const std::string& frame, const std::string& reference_frame) const;
+
+  /**
+   * @brief Get the pose of a frame with respect to another frame at a given time
+   * @param frame The name of the frame
+   * @param reference_frame The name of the frame to express the pose in
+   * @param time The time of the pose
+   * @return The pose of the frame expressed in the reference frame
+   * @throws IncompatibleReferenceFramesException if one of the frames is not in the tree or they are not connected
+   * @throws ExtrapolationException if the time is before the oldest pose buffered for an edge of the path
+   */
+  CartesianPose get_transform(
+      const std::string& frame, const std::string& reference_frame, const std::chrono::steady_clock::time_point& time
+  ) const;
+
+  /**
+   * @brief Get the pose of a frame with respect to another frame at a given time, without lock nor allocation
+   * @param frame The identifier of the frame in the frame registry
+   * @param reference_frame The identifier of the frame to express the pose in
+   * @param time The time of the pose
+   * @param result The pose to write the pose of the frame expressed in the reference frame into
+   * @throws IncompatibleReferenceFramesException if one of the frames is not in the tree or they are not connected
+   * @throws ExtrapolationException if the time is before the oldest pose buffered for an edge of the path
+   */
+  void get_transform(
+      FrameId frame, FrameId reference_frame, const std::chrono::steady_clock::time_point& time, CartesianPose& result
+  ) const;
+
+private:
+  struct Node;
+  struct CachedPath;
+  struct Path;
+
+  /**
+   * @brief Find the index of the node of a frame, or the maximum number of frames if the frame is not in the tree
+   */
+  std::size_t find_node(FrameId frame) const;
+
+  /**
+   * @brief Add a root node for a frame, assuming that the lock is held and that the frame is not in the tree
+   */
+  std::size_t add_node(FrameId frame);
+
+  /**
+   * @brief Find the path between the nodes of two frames in the cache or by walking up the tree, caching it if found
+   * @return True if the frames are connected
+   */
+  bool find_path(FrameId frame, FrameId reference_frame, Path& path) const;
+
+  /**
+   * @brief Interpolate the pose of the node with respect to its parent at a given time
+   */
+  void interpolate(
+      const Node& node, std::int64_t time, Eigen::Vector3d& position, Eigen::Quaterniond& orientation
+  ) const;
+
+  std::size_t max_frames_;                              ///< maximum number of frames
+  std::size_t buffer_size_;                             ///< number of poses buffered for each frame
+  std::size_t cache_size_;                              ///< number of cached paths
+  std::size_t table_mask_;                              ///< mask of the table from frame identifiers to node indices
+  std::unique_ptr<Node[]> nodes_;                       ///< nodes of the frames in the order they were added
+  std::unique_ptr<std::atomic<std::uint64_t>[]> table_; ///< open addressing table of frame identifiers and node indices
+  std::unique_ptr<CachedPath[]> cache_;                 ///< direct mapped cache of paths between pairs of frames
+  std::atomic<std::size_t> size_;                       ///< number of nodes
+  std::mutex mutex_;                                    ///< lock of the writers
+};
+
+inline std::size_t TransformTree::get_max_frames() const {
+  return this->max_frames_;
+}
+
+inline std::size_t TransformTree::get_buffer_size() const {
+  return this->buffer_size_;
+}
+
+inline std::size_t TransformTree::size() const {
+  return this->size_.load(std::memory_order_acquire);
+}
+}// namespace state_representation
@@ -17,21 +17,24 @@ class JointTorques;
  */
 class JointAccelerations : public JointState {
 public:
-  const Eigen::VectorXd& get_positions() const = delete;
+  Eigen::VectorXd get_positions() const = delete;
+  Eigen::Map<const Eigen::VectorXd> get_positions_view() const = delete;
   double get_position(unsigned int joint_index) const = delete;
   double get_position(const std::string& joint_name) const = delete;
   void set_positions(const Eigen::VectorXd& positions) = delete;
   void set_positions(const std::vector<double>& positions) = delete;
   void set_position(double position, unsigned int joint_index) const = delete;
   void set_position(double position, const std::string& joint_name) const = delete;
-  const Eigen::VectorXd& get_velocities() const = delete;
+  Eigen::VectorXd get_velocities() const = delete;
+  Eigen::Map<const Eigen::VectorXd> get_velocities_view() const = delete;
   double get_velocity(unsigned int joint_index) const = delete;
   double get_velocity(const std::string& joint_name) const = delete;
   void set_velocities(const Eigen::VectorXd& accelerations) = delete;
   void set_velocities(const std::vector<double>& accelerations) = delete;
   void set_velocity(double velocity, unsigned int joint_index) const = delete;
   void set_velocity(double velocity, const std::string& joint_name) const = delete;
-  const Eigen::VectorXd& get_torques() const = delete;
+  Eigen::VectorXd get_torques() const = delete;
+  Eigen::Map<const Eigen::VectorXd> get_torques_view() const = delete;
   double get_torque(unsigned int joint_index) const = delete;
   double get_torque(const std::string& joint_name) const = delete;
   void set_torques(const Eigen::VectorXd& torques) = delete;
@@ -92,6 +95,12 @@ public:
    */
   JointAccelerations(const JointAccelerations& accelerations);
 
+  /**
+   * @brief Move constructor, leaving the moved-from state empty
+   * @param accelerations The state to move from
+   */
+  JointAccelerations(JointAccelerations&& accelerations) noexcept;
+
   /**
    * @brief Copy constructor from a joint state
    */
@@ -142,6 +151,13 @@ public:
    */
   JointAccelerations& operator=(const JointAccelerations& accelerations) = default;
 
+  /**
+   * @brief Move assignment operator, leaving the moved-from state empty
+   * @param accelerations The state to move from
+   * @return Reference to the current state with new values
+   */
+  JointAccelerations& operator=(JointAccelerations&& accelerations) = default;
+
   /**
    * @brief Returns the accelerations data as an Eigen vector
    * @return The accelerations data vector
@@ -17,21 +17,24 @@ class JointTorques;
  */
 class JointPositions : public JointState {
 public:
-  const Eigen::VectorXd& get_velocities() const = delete;
+  Eigen::VectorXd get_velocities() const = delete;
+  Eigen::Map<const Eigen::VectorXd> get_velocities_view() const = delete;
   double get_velocity(unsigned int joint_index) const = delete;
   double get_velocity(const std::string& joint_name) const = delete;
   void set_velocities(const Eigen::VectorXd& velocities) = delete;
   void set_velocities(const std::vector<double>& velocities) = delete;
   void set_velocity(double velocity, unsigned int joint_index) const = delete;
   void set_velocity(double velocity, const std::string& joint_name) const = delete;
-  const Eigen::VectorXd& get_accelerations() const = delete;
+  Eigen::VectorXd get_accelerations() const = delete;
+  Eigen::Map<const Eigen::VectorXd> get_accelerations_view() const = delete;
   double get_acceleration(unsigned int joint_index) const = delete;
   double get_acceleration(const std::string& joint_name) const = delete;
   void set_accelerations(const Eigen::VectorXd& accelerations) = delete;
   void set_accelerations(const std::vector<double>& accelerations) = delete;
   void set_acceleration(double acceleration, unsigned int joint_index) const = delete;
   void set_acceleration(double acceleration, const std::string& joint_name) const = delete;
-  const Eigen::VectorXd& get_torques() const = delete;
+  Eigen::VectorXd get_torques() const = delete;
+  Eigen::Map<const Eigen::VectorXd> get_torques_view() const = delete;
   double get_torque(unsigned int joint_index) const = delete;
   double get_torque(const std::string& joint_name) const = delete;
   void set_torques(const Eigen::VectorXd& torques) = delete;
@@ -92,6 +95,12 @@ public:
    */
   JointPositions(const JointPositions& positions);
 
+  /**
+   * @brief Move constructor, leaving the moved-from state empty
+   * @param positions The state to move from
+   */
+  JointPositions(JointPositions&& positions) noexcept;
+
   /**
    * @brief Copy constructor from a JointState
    */
@@ -142,6 +151,13 @@ public:
    */
   JointPositions& operator=(const JointPositions& positions) = default;
 
+  /**
+   * @brief Move assignment operator, leaving the moved-from state empty
+   * @param positions The state to move from
+   * @return Reference to the current state with new values
+   */
+  JointPositions& operator=(JointPositions&& positions) = default;
+
   /**
    * @brief Returns the positions data as an Eigen vector
    * @return The positions data vector
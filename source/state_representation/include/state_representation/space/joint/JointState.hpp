@@ -8,6 +8,20 @@ namespace state_representation {
 
 class JointState;
 
+template<class Derived>
+class JointStateExpression;
+
+template<int N>
+class FixedJacobian;
+
+class JacobianPseudoinverse;
+
+class BiquadFilter;
+
+class SavitzkyGolayDifferentiator;
+
+class JointKalmanFilter;
+
 /**
  * @enum JointStateVariable
  * @brief Enum representing all the fields (positions, velocities, accelerations and torques)
@@ -60,6 +74,12 @@ public:
    */
   JointState(const JointState& state);
 
+  /**
+   * @brief Move constructor, leaving the moved-from state empty
+   * @param state The state to move from
+   */
+  JointState(JointState&& state) noexcept;
+
   /**
    * @brief Constructor for a zero joint state
    * @param robot_name The name of the associated robot
@@ -106,6 +126,13 @@ public:
    */
   JointState& operator=(const JointState& state);
 
+  /**
+   * @brief Move assignment operator, leaving the moved-from state empty
+   * @param state The state to move from
+   * @return Reference to the current state with new values
+   */
+  JointState& operator=(JointState&& state) noexcept;
+
   /**
    * @brief Getter of the size from the attributes
    */
@@ -127,9 +154,18 @@ public:
 
   /**
    * @brief Getter of the positions attribute
-   * @return The joint positions
+   * @return A copy of the joint positions
+   */
+  Eigen::VectorXd get_positions() const;
+
+  /**
+   * @brief Getter of the positions attribute as a view of the state buffer, without copy
+   * @details The view follows the updates of the state and is invalidated when the state is destroyed or when its
+   * number of joints changes, for instance by assigning a state of another size to it.
+   * @return A view of the joint positions in the state buffer
    */
-  const Eigen::VectorXd& get_positions() const;
+  Eigen::Map<const Eigen::VectorXd> get_positions_view() const&;
+  Eigen::Map<const Eigen::VectorXd> get_positions_view() && = delete;
 
   /**
    * @brief Get the position of a joint by its name, if it exists
@@ -149,9 +185,18 @@ public:
 
   /**
    * @brief Getter of the velocities attribute
-   * @return The joint velocities
+   * @return A copy of the joint velocities
    */
-  const Eigen::VectorXd& get_velocities() const;
+  Eigen::VectorXd get_velocities() const;
+
+  /**
+   * @brief Getter of the velocities attribute as a view of the state buffer, without copy
+   * @details The view follows the updates of the state and is invalidated when the state is destroyed or when its
+   * number of joints changes, for instance by assigning a state of another size to it.
+   * @return A view of the joint velocities in the state buffer
+   */
+  Eigen::Map<const Eigen::VectorXd> get_velocities_view() const&;
+  Eigen::Map<const Eigen::VectorXd> get_velocities_view() && = delete;
 
   /**
    * @brief Get the velocity of a joint by its name, if it exists
@@ -171,9 +216,18 @@ public:
 
   /**
    * @brief Getter of the accelerations attribute
-   * @return The joint accelerations
+   * @return A copy of the joint accelerations
+   */
+  Eigen::VectorXd get_accelerations() const;
+
+  /**
+   * @brief Getter of the accelerations attribute as a view of the state buffer, without copy
+   * @details The view follows the updates of the state and is invalidated when the state is destroyed or when its
+   * number of joints changes, for instance by assigning a state of another size to it.
+   * @return A view of the joint accelerations in the state buffer
    */
-  const Eigen::VectorXd& get_accelerations() const;
+  Eigen::Map<const Eigen::VectorXd> get_accelerations_view() const&;
+  Eigen::Map<const Eigen::VectorXd> get_accelerations_view() && = delete;
 
   /**
    * @brief Get the acceleration of a joint by its name, if it exists
@@ -193,9 +247,18 @@ public:
 
   /**
    * @brief Getter of the torques attribute
-   * @return The joint torques
+   * @return A copy of the joint torques
    */
-  const Eigen::VectorXd& get_torques() const;
+  Eigen::VectorXd get_torques() const;
+
+  /**
+   * @brief Getter of the torques attribute as a view of the state buffer, without copy
+   * @details The view follows the updates of the state and is invalidated when the state is destroyed or when its
+   * number of joints changes, for instance by assigning a state of another size to it.
+   * @return A view of the joint torques in the state buffer
+   */
+  Eigen::Map<const Eigen::VectorXd> get_torques_view() const&;
+  Eigen::Map<const Eigen::VectorXd> get_torques_view() && = delete;
 
   /**
    * @brief Get the torque of a joint by its name, if it exists
@@ -213,6 +276,41 @@ public:
    */
   double get_torque(unsigned int joint_index) const;
 
+  /**
+   * @brief Get the position of a joint by its index without checking that the state is not empty and that the index
+   * is in range
+   * @details The unchecked getters are meant for loops on states that have already been validated, for instance at
+   * the entry of a controller. The state variables of an empty state hold unspecified values. The unchecked
+   * counterpart of the views of the whole variables is the const get_variable_map.
+   * @param joint_index The index of the joint
+   * @return The position of the joint
+   */
+  double get_position_unchecked(unsigned int joint_index) const noexcept;
+
+  /**
+   * @brief Get the velocity of a joint by its index without checking that the state is not empty and that the index
+   * is in range
+   * @param joint_index The index of the joint
+   * @return The velocity of the joint
+   */
+  double get_velocity_unchecked(unsigned int joint_index) const noexcept;
+
+  /**
+   * @brief Get the acceleration of a joint by its index without checking that the state is not empty and that the
+   * index is in range
+   * @param joint_index The index of the joint
+   * @return The acceleration of the joint
+   */
+  double get_acceleration_unchecked(unsigned int joint_index) const noexcept;
+
+  /**
+   * @brief Get the torque of a joint by its index without checking that the state is not empty and that the index
+   * is in range
+   * @param joint_index The index of the joint
+   * @return The torque of the joint
+   */
+  double get_torque_unchecked(unsigned int joint_index) const noexcept;
+
   /**
    * @brief Returns the data as the concatenation of all the state variables in a single vector
    * @return The concatenated data vector
@@ -559,6 +657,26 @@ public:
    */
   void set_state_variable(double new_value, unsigned int joint_index, const JointStateVariable& state_variable_type);
 
+  /**
+   * @brief Getter of a mutable view of a state variable in the state buffer, to write it in place without allocation
+   * @details Writing through the view neither fills the state nor resets its timestamp, which is done with
+   * State::set_empty. The view is invalidated like the views of the getters.
+   * @param state_variable_type The type of variable to view, ALL viewing the whole buffer
+   * @return The segment of the buffer holding the variable
+   */
+  Eigen::Map<Eigen::VectorXd> get_variable_map(const JointStateVariable& state_variable_type) &;
+  Eigen::Map<Eigen::VectorXd> get_variable_map(const JointStateVariable& state_variable_type) && = delete;
+
+  /**
+   * @brief Getter of a view of a state variable in the state buffer, without copy nor emptiness check
+   * @details This is the unchecked variant of the get_*_view getters, for loops on states that have already been
+   * validated. The variables of an empty state hold unspecified values.
+   * @param state_variable_type The type of variable to view, ALL viewing the whole buffer
+   * @return The segment of the buffer holding the variable
+   */
+  Eigen::Map<const Eigen::VectorXd> get_variable_map(const JointStateVariable& state_variable_type) const& noexcept;
+  Eigen::Map<const Eigen::VectorXd> get_variable_map(const JointStateVariable& state_variable_type) const&& = delete;
+
 protected:
   /**
    * @copydoc State::to_string
@@ -567,19 +685,47 @@ protected:
 
 private:
   std::vector<std::string> names_;///< names of the joints
-  Eigen::VectorXd positions_;     ///< joints positions
-  Eigen::VectorXd velocities_;    ///< joints velocities
-  Eigen::VectorXd accelerations_; ///< joints accelerations
-  Eigen::VectorXd torques_;       ///< joints torques
+  Eigen::VectorXd data_;          ///< joints positions, velocities, accelerations and torques in a single buffer
 };
 
+inline Eigen::Map<Eigen::VectorXd> JointState::get_variable_map(const JointStateVariable& state_variable_type) & {
+  auto size = static_cast<Eigen::Index>(this->names_.size());
+  if (state_variable_type == JointStateVariable::ALL) {
+    return {this->data_.data(), 4 * size};
+  }
+  // the variables are stored one after the other in the order of the enumeration
+  return {this->data_.data() + static_cast<Eigen::Index>(state_variable_type) * size, size};
+}
+
+inline Eigen::Map<const Eigen::VectorXd>
+JointState::get_variable_map(const JointStateVariable& state_variable_type) const& noexcept {
+  auto size = static_cast<Eigen::Index>(this->names_.size());
+  if (state_variable_type == JointStateVariable::ALL) {
+    return {this->data_.data(), 4 * size};
+  }
+  return {this->data_.data() + static_cast<Eigen::Index>(state_variable_type) * size, size};
+}
+
+inline double JointState::get_position_unchecked(unsigned int joint_index) const noexcept {
+  return this->get_variable_map(JointStateVariable::POSITIONS).coeff(joint_index);
+}
+
+inline double JointState::get_velocity_unchecked(unsigned int joint_index) const noexcept {
+  return this->get_variable_map(JointStateVariable::VELOCITIES).coeff(joint_index);
+}
+
+inline double JointState::get_acceleration_unchecked(unsigned int joint_index) const noexcept {
+  return this->get_variable_map(JointStateVariable::ACCELERATIONS).coeff(joint_index);
+}
+
+inline double JointState::get_torque_unchecked(unsigned int joint_index) const noexcept {
+  return this->get_variable_map(JointStateVariable::TORQUES).coeff(joint_index);
+}
+
 inline void swap(JointState& state1, JointState& state2) {
   swap(static_cast<State&>(state1), static_cast<State&>(state2));
   std::swap(state1.names_, state2.names_);
-  std::swap(state1.positions_, state2.positions_);
-  std::swap(state1.velocities_, state2.velocities_);
-  std::swap(state1.accelerations_, state2.accelerations_);
-  std::swap(state1.torques_, state2.torques_);
+  std::swap(state1.data_, state2.data_);
 }
 
 /**
@@ -0,0 +1,335 @@
+#pragma once
+
+#include <type_traits>
+
+#include "state_representation/space/joint/JointState.hpp"
+#include "state_representation/space/joint/JointPositions.hpp"
+#include "state_representation/space/joint/JointVelocities.hpp"
+#include "state_representation/space/joint/JointAccelerations.hpp"
+#include "state_representation/space/joint/JointTorques.hpp"
+#include "state_representation/exceptions/EmptyStateException.hpp"
+#include "state_representation/exceptions/IncompatibleStatesException.hpp"
+
+namespace state_representation {
+
+template<class S>
+class JointStateReference;
+
+/**
+ * @brief Type of the result of the sum or difference of joint states of type L and R, which is the common type
+ * if both are the same and JointState if one of them is a JointState
+ */
+template<class L, class R>
+struct JointStateSumType {
+  static_assert(
+      std::is_same_v<L, R> || std::is_same_v<L, JointState> || std::is_same_v<R, JointState>,
+      "Joint states of different types can not be added or subtracted"
+  );
+  using type = std::conditional_t<std::is_same_v<L, R>, L, JointState>;
+};
+
+/**
+ * @class JointStateExpression
+ * @brief Base class of the lazy arithmetic expressions of joint states
+ * @details An expression is built by wrapping a state with lazy() and combining it with other states or expressions
+ * using the operators +, - and the multiplication and division by a scalar. Nothing is computed until the expression
+ * is evaluated, either by converting it to a state or by evaluating it into an existing state, which then computes
+ * each state variable in a single pass over all operands without temporary states. The compatibility of the operands
+ * is checked once at evaluation. An expression holds references to its operands and should be evaluated while they
+ * are alive, typically in the statement that builds it.
+ * @tparam Derived The type of the expression node
+ */
+template<class Derived>
+class JointStateExpression {
+public:
+  /**
+   * @brief Getter of the expression node
+   */
+  const Derived& derived() const {
+    return static_cast<const Derived&>(*this);
+  }
+
+  /**
+   * @brief Evaluate the expression into a new state with the name and joint names of the first operand
+   * @return The result of the expression
+   */
+  auto evaluate() const {
+    using ResultT = typename Derived::StateType;
+    const JointState& first = this->derived().first_state();
+    ResultT result(first.get_name(), first.get_names());
+    this->evaluate(result);
+    return result;
+  }
+
+  /**
+   * @brief Evaluate the expression into an existing state, without allocation if the state is compatible
+   * with the operands
+   * @param result The state in which to write the result, which can also be an operand of the expression
+   */
+  template<class S>
+  void evaluate(S& result) const {
+    static_assert(std::is_same_v<S, typename Derived::StateType>, "The result is not of the type of the expression");
+    const JointState& first = this->derived().first_state();
+    this->derived().for_each_state(
+        [&first](const JointState& state) {
+          if (state.is_empty()) {
+            throw exceptions::EmptyStateException(state.get_name() + " state is empty");
+          }
+          if (&state != &first && first.is_incompatible(state)) {
+            throw exceptions::IncompatibleStatesException(
+                "The two joint states are incompatible, check name, joint names and order or size"
+            );
+          }
+        }
+    );
+    if (result.is_incompatible(first)) {
+      result = S(result.get_name(), first.get_names());
+    }
+    JointState& output = result;
+    constexpr bool all = std::is_same_v<S, JointState>;
+    if constexpr (all || std::is_same_v<S, JointPositions>) {
+      output.get_variable_map(JointStateVariable::POSITIONS) = this->derived().variable(JointStateVariable::POSITIONS);
+    }
+    if constexpr (all || std::is_same_v<S, JointVelocities>) {
+      output.get_variable_map(JointStateVariable::VELOCITIES) = this->derived().variable(JointStateVariable::VELOCITIES);
+    }
+    if constexpr (all || std::is_same_v<S, JointAccelerations>) {
+      output.get_variable_map(JointStateVariable::ACCELERATIONS) = this->derived().variable(JointStateVariable::ACCELERATIONS);
+    }
+    if constexpr (all || std::is_same_v<S, JointTorques>) {
+      output.get_variable_map(JointStateVariable::TORQUES) = this->derived().variable(JointStateVariable::TORQUES);
+    }
+    output.set_empty(false);
+  }
+
+  /**
+   * @brief Conversion to the state type of the expression, or to a JointState, by evaluation
+   */
+  template<class S, class D = Derived, std::enable_if_t<
+      std::is_base_of_v<JointState, S> && std::is_base_of_v<S, typename D::StateType>, int> = 0>
+  operator S() const {
+    return S(this->evaluate());
+  }
+
+protected:
+  /**
+   * @brief Getter of a state variable without copy or emptiness check
+   */
+  static Eigen::Map<const Eigen::VectorXd>
+  get_variable(const JointState& state, const JointStateVariable& state_variable_type) {
+    return state.get_variable_map(state_variable_type);
+  }
+};
+
+/**
+ * @class JointStateReference
+ * @brief Leaf of a joint state expression, referring to a state
+ * @tparam S The type of the state
+ */
+template<class S>
+class JointStateReference : public JointStateExpression<JointStateReference<S>> {
+public:
+  using StateType = S;
+
+  explicit JointStateReference(const S& state) : state_(state) {}
+
+  const JointState& first_state() const {
+    return this->state_;
+  }
+
+  template<typename F>
+  void for_each_state(const F& function) const {
+    function(static_cast<const JointState&>(this->state_));
+  }
+
+  Eigen::Map<const Eigen::VectorXd> variable(const JointStateVariable& state_variable_type) const {
+    return JointStateExpression<JointStateReference<S>>::get_variable(this->state_, state_variable_type);
+  }
+
+private:
+  const S& state_;
+};
+
+/**
+ * @class JointStateSum
+ * @brief Sum of two joint state expressions
+ */
+template<class L, class R>
+class JointStateSum : public JointStateExpression<JointStateSum<L, R>> {
+public:
+  using StateType = typename JointStateSumType<typename L::StateType, typename R::StateType>::type;
+
+  JointStateSum(const L& lhs, const R& rhs) : lhs_(lhs), rhs_(rhs) {}
+
+  const JointState& first_state() const {
+    return this->lhs_.first_state();
+  }
+
+  template<typename F>
+  void for_each_state(const F& function) const {
+    this->lhs_.for_each_state(function);
+    this->rhs_.for_each_state(function);
+  }
+
+  auto variable(const JointStateVariable& state_variable_type) const {
+    return this->lhs_.variable(state_variable_type) + this->rhs_.variable(state_variable_type);
+  }
+
+private:
+  const L lhs_;
+  const R rhs_;
+};
+
+/**
+ * @class JointStateDifference
+ * @brief Difference of two joint state expressions
+ */
+template<class L, class R>
+class JointStateDifference : public JointStateExpression<JointStateDifference<L, R>> {
+public:
+  using StateType = typename JointStateSumType<typename L::StateType, typename R::StateType>::type;
+
+  JointStateDifference(const L& lhs, const R& rhs) : lhs_(lhs), rhs_(rhs) {}
+
+  const JointState& first_state() const {
+    return this->lhs_.first_state();
+  }
+
+  template<typename F>
+  void for_each_state(const F& function) const {
+    this->lhs_.for_each_state(function);
+    this->rhs_.for_each_state(function);
+  }
+
+  auto variable(const JointStateVariable& state_variable_type) const {
+    return this->lhs_.variable(state_variable_type) - this->rhs_.variable(state_variable_type);
+  }
+
+private:
+  const L lhs_;
+  const R rhs_;
+};
+
+/**
+ * @class JointStateNegation
+ * @brief Negation of a joint state expression
+ */
+template<class E>
+class JointStateNegation : public JointStateExpression<JointStateNegation<E>> {
+public:
+  using StateType = typename E::StateType;
+
+  explicit JointStateNegation(const E& expression) : expression_(expression) {}
+
+  const JointState& first_state() const {
+    return this->expression_.first_state();
+  }
+
+  template<typename F>
+  void for_each_state(const F& function) const {
+    this->expression_.for_each_state(function);
+  }
+
+  auto variable(const JointStateVariable& state_variable_type) const {
+    return -this->expression_.variable(state_variable_type);
+  }
+
+private:
+  const E expression_;
+};
+
+/**
+ * @class JointStateScaling
+ * @brief Product of a joint state expression with a scalar
+ */
+template<class E>
+class JointStateScaling : public JointStateExpression<JointStateScaling<E>> {
+public:
+  using StateType = typename E::StateType;
+
+  JointStateScaling(const E& expression, double lambda) : expression_(expression), lambda_(lambda) {}
+
+  const JointState& first_state() const {
+    return this->expression_.first_state();
+  }
+
+  template<typename F>
+  void for_each_state(const F& function) const {
+    this->expression_.for_each_state(function);
+  }
+
+  auto variable(const JointStateVariable& state_variable_type) const {
+    return this->lambda_ * this->expression_.variable(state_variable_type);
+  }
+
+private:
+  const E expression_;
+  double lambda_;
+};
+
+template<class S>
+using enable_if_joint_state_t = std::enable_if_t<std::is_base_of_v<JointState, S>, int>;
+
+/**
+ * @brief Start a lazy expression of joint states from a state
+ * @param state The state, which must outlive the expression
+ * @return The leaf of the expression referring to the state
+ */
+template<class S, enable_if_joint_state_t<S> = 0>
+JointStateReference<S> lazy(const S& state) {
+  return JointStateReference<S>(state);
+}
+
+template<class S, enable_if_joint_state_t<S> = 0>
+JointStateReference<S> lazy(const S&& state) = delete;
+
+template<class L, class R>
+JointStateSum<L, R> operator+(const JointStateExpression<L>& lhs, const JointStateExpression<R>& rhs) {
+  return JointStateSum<L, R>(lhs.derived(), rhs.derived());
+}
+
+template<class L, class S, enable_if_joint_state_t<S> = 0>
+JointStateSum<L, JointStateReference<S>> operator+(const JointStateExpression<L>& lhs, const S& rhs) {
+  return JointStateSum<L, JointStateReference<S>>(lhs.derived(), JointStateReference<S>(rhs));
+}
+
+template<class S, class R, enable_if_joint_state_t<S> = 0>
+JointStateSum<JointStateReference<S>, R> operator+(const S& lhs, const JointStateExpression<R>& rhs) {
+  return JointStateSum<JointStateReference<S>, R>(JointStateReference<S>(lhs), rhs.derived());
+}
+
+template<class L, class R>
+JointStateDifference<L, R> operator-(const JointStateExpression<L>& lhs, const JointStateExpression<R>& rhs) {
+  return JointStateDifference<L, R>(lhs.derived(), rhs.derived());
+}
+
+template<class L, class S, enable_if_joint_state_t<S> = 0>
+JointStateDifference<L, JointStateReference<S>> operator-(const JointStateExpression<L>& lhs, const S& rhs) {
+  return JointStateDifference<L, JointStateReference<S>>(lhs.derived(), JointStateReference<S>(rhs));
+}
+
+template<class S, class R, enable_if_joint_state_t<S> = 0>
+JointStateDifference<JointStateReference<S>, R> operator-(const S& lhs, const JointStateExpression<R>& rhs) {
+  return JointStateDifference<JointStateReference<S>, R>(JointStateReference<S>(lhs), rhs.derived());
+}
+
+template<class E>
+JointStateNegation<E> operator-(const JointStateExpression<E>& expression) {
+  return JointStateNegation<E>(expression.derived());
+}
+
+template<class E>
+JointStateScaling<E> operator*(double lambda, const JointStateExpression<E>& expression) {
+  return JointStateScaling<E>(expression.derived(), lambda);
+}
+
+template<class E>
+JointStateScaling<E> operator*(const JointStateExpression<E>& expression, double lambda) {
+  return JointStateScaling<E>(expression.derived(), lambda);
+}
+
+template<class E>
+JointStateScaling<E> operator/(const JointStateExpression<E>& expression, double lambda) {
+  return JointStateScaling<E>(expression.derived(), 1 / lambda);
+}
+}// namespace state_representation
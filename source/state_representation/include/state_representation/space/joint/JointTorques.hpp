@@ -17,21 +17,24 @@ class JointAccelerations;
  */
 class JointTorques : public JointState {
 public:
-  const Eigen::VectorXd& get_positions() const = delete;
+  Eigen::VectorXd get_positions() const = delete;
+  Eigen::Map<const Eigen::VectorXd> get_positions_view() const = delete;
   double get_position(unsigned int joint_index) const = delete;
   double get_position(const std::string& joint_name) const = delete;
   void set_positions(const Eigen::VectorXd& positions) = delete;
   void set_positions(const std::vector<double>& positions) = delete;
   void set_position(double position, unsigned int joint_index) const = delete;
   void set_position(double position, const std::string& joint_name) const = delete;
-  const Eigen::VectorXd& get_velocities() const = delete;
+  Eigen::VectorXd get_velocities() const = delete;
+  Eigen::Map<const Eigen::VectorXd> get_velocities_view() const = delete;
   double get_velocity(unsigned int joint_index) const = delete;
   double get_velocity(const std::string& joint_name) const = delete;
   void set_velocities(const Eigen::VectorXd& velocities) = delete;
   void set_velocities(const std::vector<double>& velocities) = delete;
   void set_velocity(double velocity, unsigned int joint_index) const = delete;
   void set_velocity(double velocity, const std::string& joint_name) const = delete;
-  const Eigen::VectorXd& get_accelerations() const = delete;
+  Eigen::VectorXd get_accelerations() const = delete;
+  Eigen::Map<const Eigen::VectorXd> get_accelerations_view() const = delete;
   double get_acceleration(unsigned int joint_index) const = delete;
   double get_acceleration(const std::string& joint_name) const = delete;
   void set_accelerations(const Eigen::VectorXd& accelerations) = delete;
@@ -91,6 +94,12 @@ public:
    */
   JointTorques(const JointTorques& torques);
 
+  /**
+   * @brief Move constructor, leaving the moved-from state empty
+   * @param torques The state to move from
+   */
+  JointTorques(JointTorques&& torques) noexcept;
+
   /**
    * @brief Copy constructor from a joint state
    */
@@ -135,6 +144,13 @@ public:
    */
   JointTorques& operator=(const JointTorques& torques) = default;
 
+  /**
+   * @brief Move assignment operator, leaving the moved-from state empty
+   * @param torques The state to move from
+   * @return Reference to the current state with new values
+   */
+  JointTorques& operator=(JointTorques&& torques) = default;
+
   /**
    * @brief Returns the torques data as an Eigen vector
    * @return The torque data vector
@@ -17,21 +17,24 @@ class JointTorques;
  */
 class JointVelocities : public JointState {
 public:
-  const Eigen::VectorXd& get_positions() const = delete;
+  Eigen::VectorXd get_positions() const = delete;
+  Eigen::Map<const Eigen::VectorXd> get_positions_view() const = delete;
   double get_position(unsigned int joint_index) const = delete;
   double get_position(const std::string& joint_name) const = delete;
   void set_positions(const Eigen::VectorXd& positions) = delete;
   void set_positions(const std::vector<double>& positions) = delete;
   void set_position(double position, unsigned int joint_index) const = delete;
   void set_position(double position, const std::string& joint_name) const = delete;
-  const Eigen::VectorXd& get_accelerations() const = delete;
+  Eigen::VectorXd get_accelerations() const = delete;
+  Eigen::Map<const Eigen::VectorXd> get_accelerations_view() const = delete;
   double get_acceleration(unsigned int joint_index) const = delete;
   double get_acceleration(const std::string& joint_name) const = delete;
   void set_accelerations(const Eigen::VectorXd& accelerations) = delete;
   void set_accelerations(const std::vector<double>& accelerations) = delete;
   void set_acceleration(double acceleration, unsigned int joint_index) const = delete;
   void set_acceleration(double acceleration, const std::string& joint_name) const = delete;
-  const Eigen::VectorXd& get_torques() const = delete;
+  Eigen::VectorXd get_torques() const = delete;
+  Eigen::Map<const Eigen::VectorXd> get_torques_view() const = delete;
   double get_torque(unsigned int joint_index) const = delete;
   double get_torque(const std::string& joint_name) const = delete;
   void set_torques(const Eigen::VectorXd& torques) = delete;
@@ -92,6 +95,12 @@ public:
    */
   JointVelocities(const JointVelocities& velocities);
 
+  /**
+   * @brief Move constructor, leaving the moved-from state empty
+   * @param velocities The state to move from
+   */
+  JointVelocities(JointVelocities&& velocities) noexcept;
+
   /**
    * @brief Copy constructor from a joint state
    */
@@ -148,6 +157,13 @@ public:
    */
   JointVelocities& operator=(const JointVelocities& velocities) = default;
 
+  /**
+   * @brief Move assignment operator, leaving the moved-from state empty
+   * @param velocities The state to move from
+   * @return Reference to the current state with new values
+   */
+  JointVelocities& operator=(JointVelocities&& velocities) = default;
+
   /**
    * @brief Returns the velocities data as an Eigen vector
    * @return The velocities data vector
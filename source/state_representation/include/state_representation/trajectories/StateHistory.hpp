@@ -0,0 +1,528 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include <eigen3/Eigen/Core>
+
+#include "state_representation/exceptions/EmptyStateException.hpp"
+#include "state_representation/exceptions/ExtrapolationException.hpp"
+#include "state_representation/exceptions/IncompatibleReferenceFramesException.hpp"
+#include "state_representation/exceptions/IncompatibleSizeException.hpp"
+#include "state_representation/exceptions/IncompatibleStatesException.hpp"
+#include "state_representation/space/cartesian/CartesianState.hpp"
+#include "state_representation/space/joint/JointState.hpp"
+
+namespace state_representation {
+/**
+ * @class StateHistory
+ * @brief Fixed-capacity ring buffer of the last samples of a state, indexed by their timestamp
+ * @details The data vectors of the samples are stored as the columns of a single matrix allocated at construction,
+ * the oldest sample being overwritten when the buffer is full. The samples are looked up by time in logarithmic time
+ * and interpolated linearly, except for the orientation of Cartesian states that is interpolated spherically. The
+ * mean and the derivative of the data vectors over a window of the last samples are updated incrementally at each
+ * push, the derivative being the slope of the least squares line fitting the samples over time, in units per second.
+ * Both are computed coefficient-wise, such that the mean orientation coefficients of Cartesian states are not
+ * normalized.
+ *
+ * The name, reference frame and joint names of the samples are not stored per sample but taken from the prototype.
+ * For Cartesian and joint states, pushing, getting and interpolating samples into an existing state do not allocate.
+ * Other states go through their data() and set_data() functions.
+ * @tparam StateT The type of the samples
+ */
+template<class StateT>
+class StateHistory {
+public:
+  static_assert(std::is_base_of_v<State, StateT>, "The type of a StateHistory must be a State");
+
+  /**
+   * @brief Constructor from a prototype of the samples and the capacity of the buffer
+   * @param prototype The state giving the name, frames, joint names and size of the samples
+   * @param capacity The maximum number of samples
+   * @param window The number of last samples for the mean and derivative, 0 for the capacity (default is 0)
+   * @throws IncompatibleSizeException if the capacity is 0 or the window is larger than the capacity
+   */
+  explicit StateHistory(const StateT& prototype, std::size_t capacity, std::size_t window = 0);
+
+  /**
+   * @brief Getter of the maximum number of samples
+   */
+  std::size_t get_capacity() const;
+
+  /**
+   * @brief Getter of the number of last samples used for the mean and derivative
+   */
+  std::size_t get_window() const;
+
+  /**
+   * @brief Getter of the size of the data vector of a sample
+   */
+  Eigen::Index get_dimension() const;
+
+  /**
+   * @brief Getter of the number of samples
+   */
+  std::size_t size() const;
+
+  /**
+   * @brief Check if the buffer has no samples
+   */
+  bool empty() const;
+
+  /**
+   * @brief Remove all the samples
+   */
+  void clear();
+
+  /**
+   * @brief Add a sample at its timestamp
+   * @param state The new sample
+   * @copydetails StateHistory::push(const StateT&, const std::chrono::steady_clock::time_point&)
+   */
+  void push(const StateT& state);
+
+  /**
+   * @brief Add a sample at a given time, overwriting the oldest sample if the buffer is full
+   * @param state The new sample
+   * @param time The time of the sample, which cannot be before the time of the newest sample
+   * @throws EmptyStateException if the state is empty
+   * @throws IncompatibleSizeException if the size of the data vector differs from the size of the prototype
+   * @throws IncompatibleStatesException if the joint names of a joint state differ from those of the prototype
+   * @throws IncompatibleReferenceFramesException if a Cartesian state is not expressed in the reference frame of the
+   * prototype
+   * @throws IncompatibleStatesException if the time is before the time of the newest sample
+   */
+  void push(const StateT& state, const std::chrono::steady_clock::time_point& time);
+
+  /**
+   * @brief Get the time of a sample
+   * @param index The index of the sample, from 0 for the oldest one
+   */
+  std::chrono::steady_clock::time_point get_time(std::size_t index) const;
+
+  /**
+   * @brief Get a view on the data vector of a sample
+   * @param index The index of the sample, from 0 for the oldest one
+   */
+  Eigen::Map<const Eigen::VectorXd> get_data(std::size_t index) const;
+
+  /**
+   * @brief Get a sample as a state with its time as timestamp
+   * @param index The index of the sample, from 0 for the oldest one
+   */
+  StateT get_state(std::size_t index) const;
+
+  /**
+   * @brief Write a sample into a state with its time as timestamp
+   * @param index The index of the sample, from 0 for the oldest one
+   * @param state The state to write the sample into, with the size and joint names of the prototype
+   */
+  void get_state(std::size_t index, StateT& state) const;
+
+  /**
+   * @brief Get the index of the last sample with a time before or at a given time, in logarithmic time
+   * @param time The time
+   * @throws EmptyStateException if the buffer has no samples
+   * @throws ExtrapolationException if the time is before the oldest sample
+   */
+  std::size_t get_index(const std::chrono::steady_clock::time_point& time) const;
+
+  /**
+   * @brief Get the state at a given time, interpolated between the samples around it
+   * @param time The time
+   * @return The interpolated state, with the time as timestamp
+   * @copydetails StateHistory::interpolate(const std::chrono::steady_clock::time_point&, StateT&) const
+   */
+  StateT interpolate(const std::chrono::steady_clock::time_point& time) const;
+
+  /**
+   * @brief Write the state at a given time, interpolated between the samples around it, into a state
+   * @details Times after the newest sample give the newest sample
+   * @param time The time
+   * @param state The state to write the interpolated state into, with the size and joint names of the prototype
+   * @throws EmptyStateException if the buffer has no samples
+   * @throws ExtrapolationException if the time is before the oldest sample
+   */
+  void interpolate(const std::chrono::steady_clock::time_point& time, StateT& state) const;
+
+  /**
+   * @brief Getter of the mean of the data vectors over the window of last samples
+   */
+  const Eigen::VectorXd& get_mean() const;
+
+  /**
+   * @brief Getter of the derivative of the data vectors over the window of last samples, in units per second
+   */
+  const Eigen::VectorXd& get_derivative() const;
+
+private:
+  /**
+   * @brief Get the column of a sample in the data matrix
+   */
+  std::size_t get_column(std::size_t index) const;
+
+  /**
+   * @brief Throw if the index is out of range
+   */
+  void assert_index_in_range(std::size_t index) const;
+
+  /**
+   * @brief Write the data vector of a state into a column of the data matrix
+   */
+  void write_data(const StateT& state, std::size_t column);
+
+  /**
+   * @brief Write a blend of the data vectors of two columns into a state, with the name and frames of the prototype
+   */
+  void read_data(std::size_t first, std::size_t second, double t, std::int64_t time, StateT& state) const;
+
+  /**
+   * @brief Throw if a joint state does not have the joint names of the prototype, comparing them without allocation
+   */
+  void assert_same_joint_names(const JointState& state) const;
+
+  /**
+   * @brief Add or remove the data vector of a column to the sums of the window
+   */
+  void accumulate(std::size_t column, double sign);
+
+  /**
+   * @brief Compute the sums of the window from its samples, relative to the time of its oldest sample
+   */
+  void refresh_sums();
+
+  StateT prototype_;                ///< state giving the name, frames and joint names of the samples
+  Eigen::Index dimension_;          ///< size of the data vector of a sample
+  std::size_t window_;              ///< number of last samples for the mean and derivative
+  Eigen::MatrixXd data_;            ///< data vectors of the samples, one column per sample
+  std::vector<std::int64_t> times_; ///< times of the samples in nanoseconds, by column
+  std::size_t head_;                ///< column of the oldest sample
+  std::size_t size_;                ///< number of samples
+  std::size_t pushes_;              ///< number of pushes since the sums were last computed from the samples
+  std::int64_t origin_;             ///< time in nanoseconds the times of the sums are relative to
+  double sum_t_;                    ///< sum of the times of the window, in seconds from the origin
+  double sum_tt_;                   ///< sum of the squared times of the window
+  Eigen::VectorXd sum_x_;           ///< sum of the data vectors of the window
+  Eigen::VectorXd sum_tx_;          ///< sum of the data vectors of the window weighted by their time
+  Eigen::VectorXd mean_;            ///< mean of the data vectors of the window
+  Eigen::VectorXd derivative_;      ///< slope of the data vectors of the window over time
+};
+
+template<class StateT>
+StateHistory<StateT>::StateHistory(const StateT& prototype, std::size_t capacity, std::size_t window) :
+    prototype_(prototype), window_(window == 0 ? capacity : window), head_(0), size_(0), pushes_(0), origin_(0),
+    sum_t_(0), sum_tt_(0) {
+  if (capacity == 0 || this->window_ > capacity) {
+    throw exceptions::IncompatibleSizeException(
+        "The capacity of a state history must be positive and at least the size of its window");
+  }
+  if constexpr (std::is_base_of_v<CartesianState, StateT>) {
+    this->dimension_ = 25;
+  } else if constexpr (std::is_base_of_v<JointState, StateT>) {
+    this->dimension_ = prototype.get_variable_map(JointStateVariable::ALL).size();
+  } else {
+    this->dimension_ = prototype.data().size();
+  }
+  this->data_.setZero(this->dimension_, static_cast<Eigen::Index>(capacity));
+  this->times_.resize(capacity, 0);
+  this->sum_x_.setZero(this->dimension_);
+  this->sum_tx_.setZero(this->dimension_);
+  this->mean_.setZero(this->dimension_);
+  this->derivative_.setZero(this->dimension_);
+}
+
+template<class StateT>
+inline std::size_t StateHistory<StateT>::get_column(std::size_t index) const {
+  return (this->head_ + index) % this->times_.size();
+}
+
+template<class StateT>
+inline void StateHistory<StateT>::assert_index_in_range(std::size_t index) const {
+  if (index >= this->size_) {
+    throw std::out_of_range("Index " + std::to_string(index) + " is out of the state history range");
+  }
+}
+
+template<class StateT>
+void StateHistory<StateT>::assert_same_joint_names(const JointState& state) const {
+  const JointState& prototype = this->prototype_;
+  if (state.get_names() != prototype.get_names()) {
+    throw exceptions::IncompatibleStatesException(
+        "The joint state " + state.get_name() + " does not have the joint names of the samples of the state history");
+  }
+}
+
+template<class StateT>
+void StateHistory<StateT>::clear() {
+  this->head_ = 0;
+  this->size_ = 0;
+  this->pushes_ = 0;
+  this->sum_t_ = 0;
+  this->sum_tt_ = 0;
+  this->sum_x_.setZero();
+  this->sum_tx_.setZero();
+  this->mean_.setZero();
+  this->derivative_.setZero();
+}
+
+template<class StateT>
+void StateHistory<StateT>::write_data(const StateT& state, std::size_t column) {
+  auto data = this->data_.col(static_cast<Eigen::Index>(column));
+  if constexpr (std::is_base_of_v<CartesianState, StateT>) {
+    const CartesianState& from = state;
+    const auto& orientation = from.get_orientation_unchecked();
+    data.template segment<3>(0) = from.get_position_unchecked();
+    data.template segment<4>(3) << orientation.w(), orientation.x(), orientation.y(), orientation.z();
+    data.template segment<3>(7) = from.get_linear_velocity_unchecked();
+    data.template segment<3>(10) = from.get_angular_velocity_unchecked();
+    data.template segment<3>(13) = from.get_linear_acceleration_unchecked();
+    data.template segment<3>(16) = from.get_angular_acceleration_unchecked();
+    data.template segment<3>(19) = from.get_force_unchecked();
+    data.template segment<3>(22) = from.get_torque_unchecked();
+  } else if constexpr (std::is_base_of_v<JointState, StateT>) {
+    const JointState& from = state;
+    data = from.get_variable_map(JointStateVariable::ALL);
+  } else {
+    data = state.data();
+  }
+}
+
+template<class StateT>
+void StateHistory<StateT>::read_data(
+    std::size_t first, std::size_t second, double t, std::int64_t time, StateT& state
+) const {
+  auto first_data = this->data_.col(static_cast<Eigen::Index>(first));
+  auto second_data = this->data_.col(static_cast<Eigen::Index>(second));
+  if constexpr (std::is_base_of_v<CartesianState, StateT>) {
+    CartesianState& to = state;
+    const CartesianState& prototype = this->prototype_;
+    auto blend = [&](Eigen::Index start) {
+      return ((1 - t) * first_data.template segment<3>(start) + t * second_data.template segment<3>(start)).eval();
+    };
+    to.get_variable_map(CartesianStateVariable::POSITION) = blend(0);
+    Eigen::Quaterniond first_orientation(first_data(3), first_data(4), first_data(5), first_data(6));
+    Eigen::Quaterniond second_orientation(second_data(3), second_data(4), second_data(5), second_data(6));
+    to.set_orientation(first_orientation.slerp(t, second_orientation));
+    to.get_variable_map(CartesianStateVariable::LINEAR_VELOCITY) = blend(7);
+    to.get_variable_map(CartesianStateVariable::ANGULAR_VELOCITY) = blend(10);
+    to.get_variable_map(CartesianStateVariable::LINEAR_ACCELERATION) = blend(13);
+    to.get_variable_map(CartesianStateVariable::ANGULAR_ACCELERATION) = blend(16);
+    to.get_variable_map(CartesianStateVariable::FORCE) = blend(19);
+    to.get_variable_map(CartesianStateVariable::TORQUE) = blend(22);
+    to.set_reference_frame_id(prototype.get_reference_frame_id());
+  } else if constexpr (std::is_base_of_v<JointState, StateT>) {
+    JointState& to = state;
+    auto data = to.get_variable_map(JointStateVariable::ALL);
+    if (data.size() != this->dimension_) {
+      throw exceptions::IncompatibleSizeException(
+          "The joint state " + to.get_name() + " does not have the size of the samples of the state history");
+    }
+    this->assert_same_joint_names(to);
+    data = (1 - t) * first_data + t * second_data;
+  } else {
+    state = this->prototype_;
+    state.set_data(Eigen::VectorXd((1 - t) * first_data + t * second_data));
+  }
+  state.set_name_id(this->prototype_.get_name_id());
+  state.set_empty(false);
+  state.set_timestamp(std::chrono::steady_clock::time_point(std::chrono::nanoseconds(time)));
+}
+
+template<class StateT>
+void StateHistory<StateT>::accumulate(std::size_t column, double sign) {
+  double t = static_cast<double>(this->times_[column] - this->origin_) * 1e-9;
+  auto data = this->data_.col(static_cast<Eigen::Index>(column));
+  this->sum_t_ += sign * t;
+  this->sum_tt_ += sign * t * t;
+  this->sum_x_ += sign * data;
+  this->sum_tx_ += (sign * t) * data;
+}
+
+template<class StateT>
+void StateHistory<StateT>::refresh_sums() {
+  // the sums are computed again from time to time, relative to a recent origin, to bound the rounding errors of
+  // adding and removing samples and the cancellation in the slope with times far from the origin
+  auto count = std::min(this->size_, this->window_);
+  this->origin_ = this->times_[this->get_column(this->size_ - count)];
+  this->sum_t_ = 0;
+  this->sum_tt_ = 0;
+  this->sum_x_.setZero();
+  this->sum_tx_.setZero();
+  for (auto i = this->size_ - count; i < this->size_; ++i) {
+    this->accumulate(this->get_column(i), 1);
+  }
+  this->pushes_ = 0;
+}
+
+template<class StateT>
+void StateHistory<StateT>::push(const StateT& state) {
+  this->push(state, state.get_timestamp());
+}
+
+template<class StateT>
+void StateHistory<StateT>::push(const StateT& state, const std::chrono::steady_clock::time_point& time) {
+  if (state.is_empty()) {
+    throw exceptions::EmptyStateException(state.get_name() + " state is empty");
+  }
+  if constexpr (std::is_base_of_v<CartesianState, StateT>) {
+    if (state.get_reference_frame_id() != this->prototype_.get_reference_frame_id()) {
+      throw exceptions::IncompatibleReferenceFramesException(
+          "The state " + state.get_name() + " is not expressed in the reference frame of the state history");
+    }
+  } else if constexpr (std::is_base_of_v<JointState, StateT>) {
+    if (state.get_variable_map(JointStateVariable::ALL).size() != this->dimension_) {
+      throw exceptions::IncompatibleSizeException(
+          "The joint state " + state.get_name() + " does not have the size of the samples of the state history");
+    }
+    this->assert_same_joint_names(state);
+  } else {
+    if (state.data().size() != this->dimension_) {
+      throw exceptions::IncompatibleSizeException(
+          "The state " + state.get_name() + " does not have the size of the samples of the state history");
+    }
+  }
+  auto nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(time.time_since_epoch()).count();
+  if (this->size_ > 0 && nanoseconds < this->times_[this->get_column(this->size_ - 1)]) {
+    throw exceptions::IncompatibleStatesException(
+        "The state " + state.get_name() + " is older than the newest sample of the state history");
+  }
+
+  // the sample leaving the window is removed from the sums before it may be overwritten
+  if (this->size_ >= this->window_) {
+    this->accumulate(this->get_column(this->size_ - this->window_), -1);
+  }
+  std::size_t column;
+  if (this->size_ == this->times_.size()) {
+    column = this->head_;
+    this->head_ = (this->head_ + 1) % this->times_.size();
+  } else {
+    column = this->get_column(this->size_);
+    ++this->size_;
+  }
+  this->write_data(state, column);
+  this->times_[column] = nanoseconds;
+  if (this->size_ == 1 || ++this->pushes_ >= this->window_) {
+    this->refresh_sums();
+  } else {
+    this->accumulate(column, 1);
+  }
+
+  auto count = static_cast<double>(std::min(this->size_, this->window_));
+  this->mean_ = this->sum_x_ / count;
+  double denominator = count * this->sum_tt_ - this->sum_t_ * this->sum_t_;
+  if (count > 1 && denominator > 0) {
+    this->derivative_ = (count * this->sum_tx_ - this->sum_t_ * this->sum_x_) / denominator;
+  } else {
+    this->derivative_.setZero();
+  }
+}
+
+template<class StateT>
+std::chrono::steady_clock::time_point StateHistory<StateT>::get_time(std::size_t index) const {
+  this->assert_index_in_range(index);
+  return std::chrono::steady_clock::time_point(std::chrono::nanoseconds(this->times_[this->get_column(index)]));
+}
+
+template<class StateT>
+Eigen::Map<const Eigen::VectorXd> StateHistory<StateT>::get_data(std::size_t index) const {
+  this->assert_index_in_range(index);
+  return Eigen::Map<const Eigen::VectorXd>(
+      this->data_.col(static_cast<Eigen::Index>(this->get_column(index))).data(), this->dimension_);
+}
+
+template<class StateT>
+StateT StateHistory<StateT>::get_state(std::size_t index) const {
+  StateT state(this->prototype_);
+  this->get_state(index, state);
+  return state;
+}
+
+template<class StateT>
+void StateHistory<StateT>::get_state(std::size_t index, StateT& state) const {
+  this->assert_index_in_range(index);
+  auto column = this->get_column(index);
+  this->read_data(column, column, 0, this->times_[column], state);
+}
+
+template<class StateT>
+std::size_t StateHistory<StateT>::get_index(const std::chrono::steady_clock::time_point& time) const {
+  if (this->size_ == 0) {
+    throw exceptions::EmptyStateException("The state history has no samples");
+  }
+  auto nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(time.time_since_epoch()).count();
+  if (nanoseconds < this->times_[this->head_]) {
+    throw exceptions::ExtrapolationException("The requested time is before the oldest sample of the state history");
+  }
+  // bisection over the samples in time order, the first one being at or before the time
+  std::size_t lower = 0, upper = this->size_;
+  while (upper - lower > 1) {
+    auto middle = lower + (upper - lower) / 2;
+    if (this->times_[this->get_column(middle)] <= nanoseconds) {
+      lower = middle;
+    } else {
+      upper = middle;
+    }
+  }
+  return lower;
+}
+
+template<class StateT>
+StateT StateHistory<StateT>::interpolate(const std::chrono::steady_clock::time_point& time) const {
+  StateT state(this->prototype_);
+  this->interpolate(time, state);
+  return state;
+}
+
+template<class StateT>
+void StateHistory<StateT>::interpolate(const std::chrono::steady_clock::time_point& time, StateT& state) const {
+  auto index = this->get_index(time);
+  auto nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(time.time_since_epoch()).count();
+  auto first = this->get_column(index);
+  if (index + 1 == this->size_) {
+    this->read_data(first, first, 0, this->times_[first], state);
+    return;
+  }
+  auto second = this->get_column(index + 1);
+  double t = static_cast<double>(nanoseconds - this->times_[first])
+      / static_cast<double>(this->times_[second] - this->times_[first]);
+  this->read_data(first, second, t, nanoseconds, state);
+}
+
+template<class StateT>
+inline std::size_t StateHistory<StateT>::get_capacity() const {
+  return this->times_.size();
+}
+
+template<class StateT>
+inline std::size_t StateHistory<StateT>::get_window() const {
+  return this->window_;
+}
+
+template<class StateT>
+inline Eigen::Index StateHistory<StateT>::get_dimension() const {
+  return this->dimension_;
+}
+
+template<class StateT>
+inline std::size_t StateHistory<StateT>::size() const {
+  return this->size_;
+}
+
+template<class StateT>
+inline bool StateHistory<StateT>::empty() const {
+  return this->size_ == 0;
+}
+
+template<class StateT>
+inline const Eigen::VectorXd& StateHistory<StateT>::get_mean() const {
+  return this->mean_;
+}
+
+template<class StateT>
+inline const Eigen::VectorXd& StateHistory<StateT>::get_derivative() const {
+  return this->derivative_;
+}
+}// namespace state_representation
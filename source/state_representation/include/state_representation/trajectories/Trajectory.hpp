@@ -1,18 +1,57 @@
 #pragma once
 
+#include <algorithm>
 #include <chrono>
-#include <deque>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include <eigen3/Eigen/Core>
+
+#include "state_representation/FrameRegistry.hpp"
 #include "state_representation/State.hpp"
+#include "state_representation/space/SpatialState.hpp"
+#include "state_representation/space/joint/JointState.hpp"
+#include "state_representation/exceptions/EmptyStateException.hpp"
+#include "state_representation/exceptions/IncompatibleSizeException.hpp"
+#include "state_representation/exceptions/IncompatibleStatesException.hpp"
 
 namespace state_representation {
+/**
+ * @class Trajectory
+ * @brief Sequence of states with increasing times, stored by columns.
+ * @details The data vectors of the points are stored one after the other in a single contiguous buffer,
+ * forming a matrix with one column per point, and the absolute times of the points in a sorted array.
+ * The name of each point is stored as a reference to the frame registry, while the reference frame or joint names
+ * are shared by all the points and taken from the first point added to the trajectory.
+ * @tparam StateT The type of the trajectory points, providing data() and set_data()
+ */
 template<class StateT>
 class Trajectory : public State {
 private:
-  std::deque<StateT> points_;
-  std::deque<std::chrono::nanoseconds> times_;
+  std::vector<std::chrono::nanoseconds> times_; ///< absolute times of the points, in increasing order
+  std::vector<double> data_; ///< data vectors of the points, stored point after point
+  Eigen::Index dimension_; ///< size of the data vector of a point
+  std::vector<FrameReference> point_names_; ///< names of the points
+  StateT point_template_; ///< state holding the shared frames of the points
   std::string reference_frame_; ///< name of the reference frame
   std::vector<std::string> joint_names_; ///< names of the joints
 
+  /**
+   * @brief Check that a new point has the same reference frame or joint names and data size as the points of the
+   * trajectory and store its frames if it is the first point
+   * @param new_point The new point
+   * @return The data vector of the new point
+   */
+  Eigen::VectorXd validate_point(const StateT& new_point);
+
+  /**
+   * @brief Check that the time of a new point relative to the previous point keeps the times sorted
+   * @param new_time The time of the new point relative to the previous point
+   */
+  template<typename DurationT>
+  void validate_time(const std::chrono::duration<int64_t, DurationT>& new_time) const;
+
 public:
   /**
    * @brief Empty constructor
@@ -25,6 +64,32 @@ public:
    */
   explicit Trajectory(const std::string& name);
 
+  /**
+   * @brief Copy constructor
+   * @param trajectory The trajectory to copy
+   */
+  Trajectory(const Trajectory& trajectory);
+
+  /**
+   * @brief Move constructor, leaving the moved-from trajectory empty and without points
+   * @param trajectory The trajectory to move from
+   */
+  Trajectory(Trajectory&& trajectory) noexcept;
+
+  /**
+   * @brief Copy assignment operator
+   * @param trajectory The trajectory with value to assign
+   * @return Reference to the current trajectory with new values
+   */
+  Trajectory& operator=(const Trajectory& trajectory) = default;
+
+  /**
+   * @brief Move assignment operator, leaving the moved-from trajectory empty and without points
+   * @param trajectory The trajectory to move from
+   * @return Reference to the current trajectory with new values
+   */
+  Trajectory& operator=(Trajectory&& trajectory) = default;
+
   /**
    * @brief Getter of the reference frame as const reference
    */
@@ -57,12 +122,27 @@ public:
 
   /**
    * @brief Add new point and corresponding time to trajectory
+   * @details The time is relative to the time of the previous point
+   * @throws std::invalid_argument if the relative time is negative
    */
   template<typename DurationT>
   void add_point(const StateT& new_point, const std::chrono::duration<int64_t, DurationT>& new_time);
 
+  /**
+   * @brief Add new point from its data vector and corresponding time to trajectory
+   * @details The new point shares the name of the last point and the frames of the existing points, and the time is
+   * relative to the time of the previous point
+   * @param data The data vector of the new point
+   * @param new_time The time of the new point relative to the previous point
+   * @throws std::invalid_argument if the relative time is negative
+   */
+  template<typename DurationT>
+  void add_point_data(const Eigen::VectorXd& data, const std::chrono::duration<int64_t, DurationT>& new_time);
+
   /**
    * @brief Insert new point and corresponding time to trajectory between two already existing points
+   * @details The time is relative to the time of the previous point, and all the following points are delayed by it
+   * @throws std::invalid_argument if the relative time is negative
    */
   template<typename DurationT>
   void insert_point(const StateT& new_point, const std::chrono::duration<int64_t, DurationT>& new_time, int pos);
@@ -78,47 +158,67 @@ public:
   void clear();
 
   /**
-   * @brief Get attribute list of trajectory points
+   * @brief Get a copy of all the trajectory points
    */
-  const std::deque<StateT>& get_points() const;
+  std::vector<StateT> get_points() const;
 
   /**
-   * @brief Get the trajectory point at given index
+   * @brief Get a copy of the trajectory point at given index
    * @param index the index
    */
-  const StateT& get_point(unsigned int index) const;
+  StateT get_point(unsigned int index) const;
 
   /**
-   * @brief Get the trajectory point at given index
+   * @brief Set the name and data of the trajectory point at given index
    * @param index the index
+   * @param point the new point, compatible with the points of the trajectory
    */
-  StateT& get_point(unsigned int index);
+  void set_point(unsigned int index, const StateT& point);
 
   /**
-   * @brief Get attribute list of trajectory times
+   * @brief Get a view on the data vector of the trajectory point at given index
+   * @param index the index
    */
-  const std::deque<std::chrono::nanoseconds>& get_times() const;
+  Eigen::Map<const Eigen::VectorXd> get_point_data(unsigned int index) const;
 
   /**
-   * @brief Get attribute number of point in trajectory
+   * @brief Get a mutable view on the data vector of the trajectory point at given index
+   * @param index the index
    */
-  int get_size() const;
+  Eigen::Map<Eigen::VectorXd> get_point_data(unsigned int index);
 
   /**
-   * @brief Operator overload for returning a single trajectory point and corresponding time
+   * @brief Get a view on the data of all trajectory points, as a matrix with one column per point
    */
-  const std::pair<StateT, std::chrono::nanoseconds> operator[](unsigned int idx) const;
+  Eigen::Map<const Eigen::MatrixXd> get_data() const;
+
+  /**
+   * @brief Get attribute list of trajectory times
+   */
+  const std::vector<std::chrono::nanoseconds>& get_times() const;
+
+  /**
+   * @brief Get the index of the last point with a time lower or equal to the given time, in logarithmic time
+   * @details Times before the first point give the index 0
+   * @param time The absolute time
+   */
+  template<typename DurationT>
+  unsigned int get_index(const std::chrono::duration<int64_t, DurationT>& time) const;
 
   /**
-   * @brief Operator overload for returning a single trajectory point and corresponding time
+   * @brief Get attribute number of point in trajectory
    */
-  std::pair<StateT, std::chrono::nanoseconds> operator[](unsigned int idx);
+  int get_size() const;
 
+  /**
+   * @brief Operator overload for returning a copy of a single trajectory point and corresponding time
+   */
+  const std::pair<StateT, std::chrono::nanoseconds> operator[](unsigned int idx) const;
 };
 
 template<class StateT>
 Trajectory<StateT>::Trajectory():
-    State() {
+    State(), dimension_(0) {
   this->set_type(StateType::TRAJECTORY);
   this->reset();
 }
@@ -126,11 +226,38 @@ Trajectory<StateT>::Trajectory():
 template<class StateT>
 Trajectory<StateT>::Trajectory(const std::string& name):
     State(name),
+    dimension_(0),
     reference_frame_("") {
   this->set_type(StateType::TRAJECTORY);
   this->reset();
 }
 
+template<class StateT>
+Trajectory<StateT>::Trajectory(const Trajectory& trajectory):
+    State(trajectory),
+    times_(trajectory.times_),
+    data_(trajectory.data_),
+    dimension_(trajectory.dimension_),
+    point_names_(trajectory.point_names_),
+    point_template_(trajectory.point_template_),
+    reference_frame_(trajectory.reference_frame_),
+    joint_names_(trajectory.joint_names_) {
+  this->set_type(StateType::TRAJECTORY);
+}
+
+template<class StateT>
+Trajectory<StateT>::Trajectory(Trajectory&& trajectory) noexcept:
+    State(std::move(trajectory)),
+    times_(std::move(trajectory.times_)),
+    data_(std::move(trajectory.data_)),
+    dimension_(trajectory.dimension_),
+    point_names_(std::move(trajectory.point_names_)),
+    point_template_(std::move(trajectory.point_template_)),
+    reference_frame_(std::move(trajectory.reference_frame_)),
+    joint_names_(std::move(trajectory.joint_names_)) {
+  this->set_type(StateType::TRAJECTORY);
+}
+
 template<class StateT>
 inline const std::string Trajectory<StateT>::get_reference_frame() const {
   return this->reference_frame_;
@@ -162,15 +289,54 @@ inline void Trajectory<StateT>::set_joint_names(const std::vector<std::string>&
 template<class StateT>
 void Trajectory<StateT>::reset() {
   this->State::reset();
-  this->points_.clear();
-  this->times_.clear();
+  this->clear();
+}
+
+template<class StateT>
+Eigen::VectorXd Trajectory<StateT>::validate_point(const StateT& new_point) {
+  Eigen::VectorXd data = new_point.data();
+  if (this->times_.empty()) {
+    this->point_template_ = new_point;
+    this->dimension_ = data.size();
+    return data;
+  }
+  // the points are returned with the frames of the first point, which they must therefore share
+  bool incompatible;
+  if constexpr (std::is_base_of_v<SpatialState, StateT>) {
+    incompatible = new_point.get_reference_frame_id() != this->point_template_.get_reference_frame_id();
+  } else if constexpr (std::is_base_of_v<JointState, StateT>) {
+    incompatible = new_point.get_names() != this->point_template_.get_names();
+  } else {
+    incompatible = this->point_template_.is_incompatible(new_point);
+  }
+  if (incompatible) {
+    throw exceptions::IncompatibleStatesException(
+        "The point " + new_point.get_name() + " is incompatible with the points of the trajectory");
+  }
+  if (data.size() != this->dimension_) {
+    throw exceptions::IncompatibleSizeException(
+        "Input point has an incorrect data size: expected " + std::to_string(this->dimension_) + ", given "
+            + std::to_string(data.size()));
+  }
+  return data;
+}
+
+template<class StateT>
+template<typename DurationT>
+inline void Trajectory<StateT>::validate_time(const std::chrono::duration<int64_t, DurationT>& new_time) const {
+  if (new_time.count() < 0) {
+    throw std::invalid_argument("The time of a new point relative to the previous point can not be negative");
+  }
 }
 
 template<class StateT>
 template<typename DurationT>
 void Trajectory<StateT>::add_point(const StateT& new_point, const std::chrono::duration<int64_t, DurationT>& new_time) {
+  this->validate_time(new_time);
+  auto data = this->validate_point(new_point);
   this->set_empty(false);
-  this->points_.push_back(new_point);
+  this->data_.insert(this->data_.end(), data.data(), data.data() + data.size());
+  this->point_names_.emplace_back(new_point.get_name());
 
   if (!this->times_.empty()) {
     auto const previous_time = this->times_.back();
@@ -180,78 +346,132 @@ void Trajectory<StateT>::add_point(const StateT& new_point, const std::chrono::d
   }
 }
 
+template<class StateT>
+template<typename DurationT>
+void Trajectory<StateT>::add_point_data(
+    const Eigen::VectorXd& data, const std::chrono::duration<int64_t, DurationT>& new_time
+) {
+  if (this->times_.empty()) {
+    throw exceptions::EmptyStateException(
+        "The trajectory " + this->get_name() + " has no points to take the name and frames of the new point from");
+  }
+  this->validate_time(new_time);
+  if (data.size() != this->dimension_) {
+    throw exceptions::IncompatibleSizeException(
+        "Input point has an incorrect data size: expected " + std::to_string(this->dimension_) + ", given "
+            + std::to_string(data.size()));
+  }
+  this->data_.insert(this->data_.end(), data.data(), data.data() + data.size());
+  this->point_names_.push_back(this->point_names_.back());
+  this->times_.push_back(this->times_.back() + new_time);
+}
+
 template<class StateT>
 template<typename DurationT>
 void Trajectory<StateT>::insert_point(const StateT& new_point,
                                       const std::chrono::duration<int64_t, DurationT>& new_time,
                                       int pos) {
+  if (pos < 0 || pos > this->get_size()) {
+    throw std::out_of_range("Position " + std::to_string(pos) + " is out of the trajectory range");
+  }
+  this->validate_time(new_time);
+  auto data = this->validate_point(new_point);
   this->set_empty(false);
 
-  auto it_points = this->points_.begin();
-  auto it_times = this->times_.begin();
-  std::advance(it_points, pos);
-  std::advance(it_times, pos);
-
-  this->points_.insert(it_points, new_point);
-
-  auto previous_time = this->times_[pos - 1];
-  this->times_.insert(it_times, previous_time + new_time);
+  this->data_.insert(this->data_.begin() + pos * this->dimension_, data.data(), data.data() + data.size());
+  this->point_names_.emplace(this->point_names_.begin() + pos, new_point.get_name());
 
-  for (unsigned int i = pos + 1; i <= this->points_.size(); i++) {
-    this->times_[i] += new_time;
-  }
+  auto previous_time = pos > 0 ? this->times_[pos - 1] : std::chrono::nanoseconds(0);
+  auto it_times = this->times_.insert(this->times_.begin() + pos, previous_time + new_time);
+  std::for_each(it_times + 1, this->times_.end(), [&new_time](auto& time) { time += new_time; });
 }
 
 template<class StateT>
 void Trajectory<StateT>::delete_point() {
   this->set_empty(false);
-  if (!this->points_.empty()) {
-    this->points_.pop_back();
-  }
   if (!this->times_.empty()) {
     this->times_.pop_back();
+    this->point_names_.pop_back();
+    this->data_.resize(this->data_.size() - this->dimension_);
   }
 }
 
 template<class StateT>
 void Trajectory<StateT>::clear() {
-  this->points_.clear();
+  this->data_.clear();
+  this->point_names_.clear();
   this->times_.clear();
 }
 
 template<class StateT>
-inline const std::deque<StateT>& Trajectory<StateT>::get_points() const {
-  return this->points_;
+std::vector<StateT> Trajectory<StateT>::get_points() const {
+  std::vector<StateT> points;
+  points.reserve(this->times_.size());
+  for (unsigned int i = 0; i < this->times_.size(); ++i) {
+    points.push_back(this->get_point(i));
+  }
+  return points;
+}
+
+template<class StateT>
+StateT Trajectory<StateT>::get_point(unsigned int index) const {
+  StateT point(this->point_template_);
+  point.set_data(this->get_point_data(index));
+  point.set_name(this->point_names_[index].get_name());
+  return point;
+}
+
+template<class StateT>
+void Trajectory<StateT>::set_point(unsigned int index, const StateT& point) {
+  auto view = this->get_point_data(index);
+  view = this->validate_point(point);
+  this->point_names_[index] = FrameReference(point.get_name());
 }
 
 template<class StateT>
-const StateT& Trajectory<StateT>::get_point(unsigned int index) const {
-  return this->points_[index];
+inline Eigen::Map<const Eigen::VectorXd> Trajectory<StateT>::get_point_data(unsigned int index) const {
+  if (index >= this->times_.size()) {
+    throw std::out_of_range("Index " + std::to_string(index) + " is out of the trajectory range");
+  }
+  return Eigen::Map<const Eigen::VectorXd>(this->data_.data() + index * this->dimension_, this->dimension_);
+}
+
+template<class StateT>
+inline Eigen::Map<Eigen::VectorXd> Trajectory<StateT>::get_point_data(unsigned int index) {
+  if (index >= this->times_.size()) {
+    throw std::out_of_range("Index " + std::to_string(index) + " is out of the trajectory range");
+  }
+  return Eigen::Map<Eigen::VectorXd>(this->data_.data() + index * this->dimension_, this->dimension_);
 }
 
 template<class StateT>
-StateT& Trajectory<StateT>::get_point(unsigned int index) {
-  return this->points_[index];
+inline Eigen::Map<const Eigen::MatrixXd> Trajectory<StateT>::get_data() const {
+  return Eigen::Map<const Eigen::MatrixXd>(
+      this->data_.data(), this->dimension_, static_cast<Eigen::Index>(this->times_.size()));
 }
 
 template<class StateT>
-inline const std::deque<std::chrono::nanoseconds>& Trajectory<StateT>::get_times() const {
+inline const std::vector<std::chrono::nanoseconds>& Trajectory<StateT>::get_times() const {
   return this->times_;
 }
 
 template<class StateT>
-int Trajectory<StateT>::get_size() const {
-  return this->points_.size();
+template<typename DurationT>
+unsigned int Trajectory<StateT>::get_index(const std::chrono::duration<int64_t, DurationT>& time) const {
+  if (this->times_.empty()) {
+    throw exceptions::EmptyStateException("The trajectory " + this->get_name() + " has no points");
+  }
+  auto it = std::upper_bound(this->times_.cbegin(), this->times_.cend(), time);
+  return it == this->times_.cbegin() ? 0 : static_cast<unsigned int>(std::distance(this->times_.cbegin(), it) - 1);
 }
 
 template<class StateT>
-const std::pair<StateT, std::chrono::nanoseconds> Trajectory<StateT>::operator[](unsigned int idx) const {
-  return std::make_pair(this->points_[idx], this->times_[idx]);
+int Trajectory<StateT>::get_size() const {
+  return this->times_.size();
 }
 
 template<class StateT>
-std::pair<StateT, std::chrono::nanoseconds> Trajectory<StateT>::operator[](unsigned int idx) {
-  this->set_empty(false);
-  return std::make_pair(this->points_[idx], this->times_[idx]);
+const std::pair<StateT, std::chrono::nanoseconds> Trajectory<StateT>::operator[](unsigned int idx) const {
+  return std::make_pair(this->get_point(idx), this->times_[idx]);
 }
 }
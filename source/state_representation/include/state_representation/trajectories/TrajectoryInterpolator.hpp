@@ -0,0 +1,396 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include <eigen3/Eigen/Core>
+#include <eigen3/Eigen/Geometry>
+
+#include "state_representation/MathTools.hpp"
+#include "state_representation/exceptions/EmptyStateException.hpp"
+#include "state_representation/exceptions/IncompatibleSizeException.hpp"
+#include "state_representation/space/cartesian/CartesianPose.hpp"
+#include "state_representation/space/cartesian/CartesianState.hpp"
+#include "state_representation/trajectories/Trajectory.hpp"
+
+namespace state_representation {
+
+/**
+ * @enum InterpolationMethod
+ * @brief Interpolation methods between the points of a trajectory. The orientation of Cartesian states and poses is
+ * interpolated with SLERP for the linear method and with SQUAD for the cubic spline method.
+ */
+enum class InterpolationMethod {
+  LINEAR, CUBIC_SPLINE
+};
+
+/**
+ * @class TrajectoryInterpolator
+ * @brief Evaluate the state of a trajectory at any time by interpolation between its points.
+ * @details The interpolator keeps a copy of the trajectory data and the spline coefficients computed on construction.
+ * The segment of the last query is remembered, such that monotonically increasing query times, as in a control loop,
+ * are looked up in constant amortized time, and other query times in logarithmic time with a binary search.
+ * Queries before the first point or after the last point give the first or last point respectively.
+ * @tparam StateT The type of the trajectory points
+ */
+template<class StateT>
+class TrajectoryInterpolator {
+public:
+  /**
+   * @brief Constructor from a trajectory and an interpolation method
+   * @param trajectory The trajectory to interpolate, with at least one point
+   * @param method The interpolation method
+   */
+  explicit TrajectoryInterpolator(
+      const Trajectory<StateT>& trajectory, const InterpolationMethod& method = InterpolationMethod::LINEAR
+  );
+
+  /**
+   * @brief Getter of the interpolation method
+   */
+  const InterpolationMethod& get_method() const;
+
+  /**
+   * @brief Get the interpolated state at a given time
+   * @param time The absolute time
+   * @return The interpolated state, with the name and frames of the trajectory points
+   */
+  template<typename DurationT>
+  StateT get_state(const std::chrono::duration<int64_t, DurationT>& time);
+
+  /**
+   * @brief Get the interpolated data vector of the state at a given time
+   * @param time The absolute time
+   * @param data The data vector to write the interpolated data to, with the size of the data of a point
+   */
+  template<typename DurationT>
+  void get_data(const std::chrono::duration<int64_t, DurationT>& time, Eigen::Ref<Eigen::VectorXd> data);
+
+  /**
+   * @brief Resample the trajectory with uniformly spaced points between its first and last times
+   * @param period The time between two consecutive points
+   * @return The resampled trajectory
+   */
+  template<typename DurationT>
+  Trajectory<StateT> resample(const std::chrono::duration<int64_t, DurationT>& period);
+
+private:
+  /**
+   * @brief Whether the data vector of the state contains an orientation quaternion as (w, x, y, z) at index 3
+   */
+  static constexpr bool has_orientation_ =
+      std::is_same_v<StateT, CartesianState> || std::is_same_v<StateT, CartesianPose>;
+
+  /**
+   * @brief Compute the second derivatives of the natural cubic spline through the data points with the
+   * tridiagonal matrix algorithm, for all the data rows at once
+   */
+  void compute_spline_coefficients();
+
+  /**
+   * @brief Make consecutive orientations lie on the same hemisphere and compute the SQUAD control points
+   */
+  void compute_orientation_coefficients();
+
+  /**
+   * @brief Get the index of the segment containing a time strictly inside the trajectory time range,
+   * starting the search from the segment of the previous query
+   * @param time The time in seconds
+   */
+  Eigen::Index find_segment(double time);
+
+  /**
+   * @brief Interpolate the data vector at a given time, except for the orientation inside the trajectory time range
+   * @param time The time in seconds
+   * @param data The data vector to write the interpolated data to
+   * @param b The interpolation parameter in the segment
+   * @return The index of the segment containing the time, or -1 if the time is outside of the trajectory time range
+   * and the data is the one of the first or last point
+   */
+  Eigen::Index interpolate_vector(double time, Eigen::Ref<Eigen::VectorXd> data, double& b);
+
+  /**
+   * @brief Interpolate the data vector at a given time
+   * @param time The time in seconds
+   * @param data The data vector to write the interpolated data to
+   */
+  void interpolate(double time, Eigen::Ref<Eigen::VectorXd> data);
+
+  /**
+   * @brief Interpolate the orientations of several segments at once
+   * @param segments The indices of the segments
+   * @param b The interpolation parameters in the segments
+   * @param orientations The matrix to write the interpolated quaternions to, one column per segment
+   */
+  void interpolate_orientations(
+      const std::vector<Eigen::Index>& segments, const Eigen::VectorXd& b, Eigen::Matrix4Xd& orientations
+  ) const;
+
+  InterpolationMethod method_; ///< interpolation method
+  std::string name_; ///< name of the trajectory
+  StateT point_template_; ///< state holding the name and frames of the trajectory points
+  std::chrono::nanoseconds start_time_; ///< time of the first point
+  Eigen::VectorXd times_; ///< times of the points in seconds relative to the first point
+  Eigen::MatrixXd data_; ///< data of the points, one column per point
+  Eigen::MatrixXd second_derivatives_; ///< second derivatives of the cubic spline at the points
+  Eigen::Matrix4Xd orientations_; ///< normalized orientations of the points as quaternion coefficients
+  Eigen::Matrix4Xd control_points_; ///< SQUAD control points of the orientation as quaternion coefficients
+  Eigen::Index segment_; ///< segment of the last query
+};
+
+template<class StateT>
+TrajectoryInterpolator<StateT>::TrajectoryInterpolator(
+    const Trajectory<StateT>& trajectory, const InterpolationMethod& method
+) : method_(method), name_(trajectory.get_name()), segment_(0) {
+  if (trajectory.get_size() == 0) {
+    throw exceptions::EmptyStateException("The trajectory " + trajectory.get_name() + " has no points to interpolate");
+  }
+  this->point_template_ = trajectory.get_point(0);
+  this->start_time_ = trajectory.get_times().front();
+  this->times_.resize(trajectory.get_size());
+  for (Eigen::Index i = 0; i < this->times_.size(); ++i) {
+    this->times_(i) = std::chrono::duration<double>(trajectory.get_times()[i] - this->start_time_).count();
+  }
+  this->data_ = trajectory.get_data();
+  if constexpr (has_orientation_) {
+    this->compute_orientation_coefficients();
+  }
+  if (this->method_ == InterpolationMethod::CUBIC_SPLINE) {
+    this->compute_spline_coefficients();
+  }
+}
+
+template<class StateT>
+inline const InterpolationMethod& TrajectoryInterpolator<StateT>::get_method() const {
+  return this->method_;
+}
+
+template<class StateT>
+void TrajectoryInterpolator<StateT>::compute_spline_coefficients() {
+  const Eigen::Index n = this->data_.cols();
+  this->second_derivatives_ = Eigen::MatrixXd::Zero(this->data_.rows(), n);
+  if (n < 3) {
+    return;
+  }
+  if (((this->times_.tail(n - 1) - this->times_.head(n - 1)).array() <= 0).any()) {
+    throw std::invalid_argument("The times of the trajectory points must be strictly increasing for a cubic spline");
+  }
+  // forward sweep of the tridiagonal system of the inner points, with zero second derivatives at both ends
+  Eigen::VectorXd diagonal(n);
+  Eigen::MatrixXd rhs = Eigen::MatrixXd::Zero(this->data_.rows(), n);
+  for (Eigen::Index i = 1; i < n - 1; ++i) {
+    double h_prev = this->times_(i) - this->times_(i - 1);
+    double h_next = this->times_(i + 1) - this->times_(i);
+    diagonal(i) = 2 * (h_prev + h_next);
+    rhs.col(i) = 6 * ((this->data_.col(i + 1) - this->data_.col(i)) / h_next
+        - (this->data_.col(i) - this->data_.col(i - 1)) / h_prev);
+    if (i > 1) {
+      double factor = h_prev / diagonal(i - 1);
+      diagonal(i) -= factor * h_prev;
+      rhs.col(i) -= factor * rhs.col(i - 1);
+    }
+  }
+  // back substitution
+  for (Eigen::Index i = n - 2; i > 0; --i) {
+    double h_next = this->times_(i + 1) - this->times_(i);
+    this->second_derivatives_.col(i) =
+        (rhs.col(i) - h_next * this->second_derivatives_.col(i + 1)) / diagonal(i);
+  }
+}
+
+template<class StateT>
+void TrajectoryInterpolator<StateT>::compute_orientation_coefficients() {
+  const Eigen::Index n = this->data_.cols();
+  for (Eigen::Index i = 1; i < n; ++i) {
+    if (this->data_.col(i).template segment<4>(3).dot(this->data_.col(i - 1).template segment<4>(3)) < 0) {
+      this->data_.col(i).template segment<4>(3) *= -1;
+    }
+  }
+  // the data stores the quaternions as (w, x, y, z) and the batch functions as the coefficients (x, y, z, w)
+  this->orientations_.resize(4, n);
+  this->orientations_.template topRows<3>() = this->data_.middleRows(4, 3);
+  this->orientations_.row(3) = this->data_.row(3);
+  this->orientations_.colwise().normalize();
+  if (this->method_ != InterpolationMethod::CUBIC_SPLINE) {
+    return;
+  }
+  this->control_points_ = this->orientations_;
+  if (n < 3) {
+    return;
+  }
+  // the control point of an inner point i is q_i exp(-(log(q_i^-1 q_i+1) + log(q_i^-1 q_i-1)) / 4)
+  const Eigen::Index inner = n - 2;
+  Eigen::Matrix4Xd inverses = this->orientations_.middleCols(1, inner);
+  inverses.template topRows<3>() *= -1;
+  Eigen::Matrix4Xd next(4, inner), previous(4, inner);
+  math_tools::multiply(inverses, this->orientations_.rightCols(inner), next);
+  math_tools::multiply(inverses, this->orientations_.leftCols(inner), previous);
+  math_tools::log(next, next);
+  math_tools::log(previous, previous);
+  Eigen::Matrix4Xd tangents = -0.25 * (next + previous);
+  math_tools::exp(tangents, tangents);
+  math_tools::multiply(this->orientations_.middleCols(1, inner), tangents, this->control_points_.middleCols(1, inner));
+  this->control_points_.middleCols(1, inner).colwise().normalize();
+}
+
+template<class StateT>
+Eigen::Index TrajectoryInterpolator<StateT>::find_segment(double time) {
+  const Eigen::Index last_segment = this->times_.size() - 2;
+  if (time < this->times_(this->segment_)) {
+    this->segment_ = 0;
+  }
+  // walk forward a few segments before falling back to a binary search
+  for (int step = 0; step < 8; ++step) {
+    if (this->segment_ == last_segment || time < this->times_(this->segment_ + 1)) {
+      return this->segment_;
+    }
+    ++this->segment_;
+  }
+  auto begin = this->times_.data() + this->segment_;
+  auto end = this->times_.data() + this->times_.size();
+  this->segment_ = std::min<Eigen::Index>(
+      std::distance(this->times_.data(), std::upper_bound(begin, end, time)) - 1, last_segment);
+  return this->segment_;
+}
+
+template<class StateT>
+Eigen::Index
+TrajectoryInterpolator<StateT>::interpolate_vector(double time, Eigen::Ref<Eigen::VectorXd> data, double& b) {
+  const Eigen::Index n = this->times_.size();
+  if (n == 1 || time <= this->times_(0)) {
+    data = this->data_.col(0);
+    return -1;
+  }
+  if (time >= this->times_(n - 1)) {
+    data = this->data_.col(n - 1);
+    return -1;
+  }
+  auto i = this->find_segment(time);
+  double h = this->times_(i + 1) - this->times_(i);
+  b = (time - this->times_(i)) / h;
+  double a = 1 - b;
+  data = a * this->data_.col(i) + b * this->data_.col(i + 1);
+  if (this->method_ == InterpolationMethod::CUBIC_SPLINE) {
+    data += ((a * a * a - a) * this->second_derivatives_.col(i) + (b * b * b - b) * this->second_derivatives_.col(i + 1))
+        * (h * h / 6);
+  }
+  return i;
+}
+
+template<class StateT>
+void TrajectoryInterpolator<StateT>::interpolate(double time, Eigen::Ref<Eigen::VectorXd> data) {
+  double b;
+  auto i = this->interpolate_vector(time, data, b);
+  if constexpr (has_orientation_) {
+    if (i < 0) {
+      return;
+    }
+    Eigen::Quaterniond q_start(this->orientations_.col(i));
+    Eigen::Quaterniond q_end(this->orientations_.col(i + 1));
+    Eigen::Quaterniond q;
+    if (this->method_ == InterpolationMethod::CUBIC_SPLINE) {
+      Eigen::Quaterniond s_start(this->control_points_.col(i));
+      Eigen::Quaterniond s_end(this->control_points_.col(i + 1));
+      q = q_start.slerp(b, q_end).slerp(2 * b * (1 - b), s_start.slerp(b, s_end));
+    } else {
+      q = q_start.slerp(b, q_end);
+    }
+    data.template segment<4>(3) << q.w(), q.x(), q.y(), q.z();
+  }
+}
+
+template<class StateT>
+void TrajectoryInterpolator<StateT>::interpolate_orientations(
+    const std::vector<Eigen::Index>& segments, const Eigen::VectorXd& b, Eigen::Matrix4Xd& orientations
+) const {
+  const auto size = static_cast<Eigen::Index>(segments.size());
+  Eigen::Matrix4Xd start(4, size), end(4, size);
+  for (Eigen::Index k = 0; k < size; ++k) {
+    start.col(k) = this->orientations_.col(segments[k]);
+    end.col(k) = this->orientations_.col(segments[k] + 1);
+  }
+  math_tools::slerp(start, end, b, orientations);
+  if (this->method_ != InterpolationMethod::CUBIC_SPLINE) {
+    return;
+  }
+  for (Eigen::Index k = 0; k < size; ++k) {
+    start.col(k) = this->control_points_.col(segments[k]);
+    end.col(k) = this->control_points_.col(segments[k] + 1);
+  }
+  math_tools::slerp(start, end, b, start);
+  math_tools::slerp(orientations, start, 2 * b.array() * (1 - b.array()), orientations);
+}
+
+template<class StateT>
+template<typename DurationT>
+void TrajectoryInterpolator<StateT>::get_data(
+    const std::chrono::duration<int64_t, DurationT>& time, Eigen::Ref<Eigen::VectorXd> data
+) {
+  if (data.size() != this->data_.rows()) {
+    throw exceptions::IncompatibleSizeException(
+        "Output data has an incorrect size: expected " + std::to_string(this->data_.rows()) + ", given "
+            + std::to_string(data.size()));
+  }
+  this->interpolate(std::chrono::duration<double>(time - this->start_time_).count(), data);
+}
+
+template<class StateT>
+template<typename DurationT>
+StateT TrajectoryInterpolator<StateT>::get_state(const std::chrono::duration<int64_t, DurationT>& time) {
+  Eigen::VectorXd data(this->data_.rows());
+  this->get_data(time, data);
+  StateT state(this->point_template_);
+  state.set_data(data);
+  return state;
+}
+
+template<class StateT>
+template<typename DurationT>
+Trajectory<StateT> TrajectoryInterpolator<StateT>::resample(const std::chrono::duration<int64_t, DurationT>& period) {
+  if (period.count() <= 0) {
+    throw std::invalid_argument("The resampling period must be strictly positive");
+  }
+  const double duration = this->times_(this->times_.size() - 1);
+  const double step = std::chrono::duration<double>(period).count();
+  const auto nb_points = static_cast<Eigen::Index>(std::floor(duration / step + 1e-9)) + 1;
+
+  Eigen::MatrixXd data(this->data_.rows(), nb_points);
+  this->segment_ = 0;
+  if constexpr (has_orientation_) {
+    // the orientations of the points inside the trajectory time range are interpolated all at once
+    std::vector<Eigen::Index> points, segments;
+    Eigen::VectorXd b(nb_points);
+    for (Eigen::Index i = 0; i < nb_points; ++i) {
+      auto segment = this->interpolate_vector(
+          std::chrono::duration<double>(i * period).count(), data.col(i), b(segments.size()));
+      if (segment >= 0) {
+        points.push_back(i);
+        segments.push_back(segment);
+      }
+    }
+    Eigen::Matrix4Xd orientations(4, segments.size());
+    this->interpolate_orientations(segments, b.head(segments.size()), orientations);
+    for (std::size_t k = 0; k < points.size(); ++k) {
+      data(3, points[k]) = orientations(3, k);
+      data.col(points[k]).template segment<3>(4) = orientations.col(k).template head<3>();
+    }
+  } else {
+    for (Eigen::Index i = 0; i < nb_points; ++i) {
+      this->interpolate(std::chrono::duration<double>(i * period).count(), data.col(i));
+    }
+  }
+
+  Trajectory<StateT> trajectory(this->name_);
+  StateT point(this->point_template_);
+  point.set_data(data.col(0));
+  trajectory.add_point(point, this->start_time_);
+  for (Eigen::Index i = 1; i < nb_points; ++i) {
+    trajectory.add_point_data(data.col(i), period);
+  }
+  return trajectory;
+}
+}// namespace state_representation
@@ -0,0 +1,68 @@
+// Replacement of the heap allocation functions of the C library that abort the program when they are called inside a
+// RealtimeSection. C++ allocations are covered as well, since operator new and Eigen allocate through malloc.
+// Deallocations are not checked.
+#include "state_representation/RealtimeSection.hpp"
+
+#include <cerrno>
+#include <cstdlib>
+#include <unistd.h>
+
+#ifndef __GLIBC__
+#error "The allocation check requires the GNU C library"
+#endif
+
+extern "C" {
+void* __libc_malloc(size_t size);
+void* __libc_calloc(size_t count, size_t size);
+void* __libc_realloc(void* pointer, size_t size);
+void* __libc_memalign(size_t alignment, size_t size);
+}
+
+static void assert_allocation_allowed() {
+  if (state_representation::RealtimeSection::is_active()) {
+    static const char message[] = "state_representation: heap allocation inside a real-time section\n";
+    // write directly to the file descriptor as the formatted output functions may allocate
+    [[maybe_unused]] auto written = write(STDERR_FILENO, message, sizeof(message) - 1);
+    std::abort();
+  }
+}
+
+extern "C" {
+void* malloc(size_t size) {
+  assert_allocation_allowed();
+  return __libc_malloc(size);
+}
+
+void* calloc(size_t count, size_t size) {
+  assert_allocation_allowed();
+  return __libc_calloc(count, size);
+}
+
+void* realloc(void* pointer, size_t size) {
+  assert_allocation_allowed();
+  return __libc_realloc(pointer, size);
+}
+
+void* memalign(size_t alignment, size_t size) {
+  assert_allocation_allowed();
+  return __libc_memalign(alignment, size);
+}
+
+void* aligned_alloc(size_t alignment, size_t size) {
+  assert_allocation_allowed();
+  return __libc_memalign(alignment, size);
+}
+
+int posix_memalign(void** pointer, size_t alignment, size_t size) {
+  assert_allocation_allowed();
+  if (alignment % sizeof(void*) != 0 || (alignment & (alignment - 1)) != 0) {
+    return EINVAL;
+  }
+  void* result = __libc_memalign(alignment, size);
+  if (result == nullptr) {
+    return ENOMEM;
+  }
+  *pointer = result;
+  return 0;
+}
+}
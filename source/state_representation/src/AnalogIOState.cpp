@@ -60,6 +60,20 @@ AnalogIOState& AnalogIOState::operator=(const AnalogIOState& state) {
   return *this;
 }
 
+AnalogIOState::AnalogIOState(AnalogIOState&& state) noexcept : IOState<double>(std::move(state)) {
+  this->set_type(StateType::ANALOG_IO_STATE);
+}
+
+AnalogIOState& AnalogIOState::operator=(AnalogIOState&& state) noexcept {
+  if (this == &state) {
+    return *this;
+  }
+  IOState<double>::operator=(std::move(state));
+  // the previous values of this state are swapped into the moved-from state, release them to match its empty names
+  state.data_.resize(0);
+  return *this;
+}
+
 AnalogIOState AnalogIOState::copy() const {
   AnalogIOState result(*this);
   return result;
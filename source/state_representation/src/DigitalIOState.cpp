@@ -60,6 +60,20 @@ DigitalIOState& DigitalIOState::operator=(const DigitalIOState& state) {
   return *this;
 }
 
+DigitalIOState::DigitalIOState(DigitalIOState&& state) noexcept : IOState<bool>(std::move(state)) {
+  this->set_type(StateType::DIGITAL_IO_STATE);
+}
+
+DigitalIOState& DigitalIOState::operator=(DigitalIOState&& state) noexcept {
+  if (this == &state) {
+    return *this;
+  }
+  IOState<bool>::operator=(std::move(state));
+  // the previous values of this state are swapped into the moved-from state, release them to match its empty names
+  state.data_.resize(0);
+  return *this;
+}
+
 bool DigitalIOState::is_true(const std::string& io_name) const {
   return this->is_true(this->get_io_index(io_name));
 }
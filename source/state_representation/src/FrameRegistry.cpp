@@ -0,0 +1,153 @@
+#include "state_representation/FrameRegistry.hpp"
+
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <shared_mutex>
+#include <stdexcept>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace state_representation {
+
+namespace {
+
+// the names are stored in chunks that are never moved, such that the reference to a name stays valid and its lookup
+// does not need the lock while other names are registered
+constexpr std::size_t CHUNK_SIZE = 1024;
+constexpr std::size_t MAX_CHUNKS = 4096;
+// the empty name and "world" are never removed, such that they are not reference counted
+constexpr FrameId PERMANENT_IDS = 2;
+
+struct Slot {
+  std::string name;
+  std::atomic<std::uint32_t> references{0};
+  bool registered = false;///< whether the name is in the map, only accessed with the lock
+};
+
+struct Registry {
+  Registry() : size(0) {
+    for (auto& chunk: this->chunks) {
+      chunk.store(nullptr, std::memory_order_relaxed);
+    }
+    this->add("");
+    this->add("world");
+  }
+
+  Slot& get_slot(FrameId id) const {
+    return this->chunks[id / CHUNK_SIZE].load(std::memory_order_acquire)[id % CHUNK_SIZE];
+  }
+
+  FrameId add(const std::string& name) {
+    FrameId id;
+    if (!this->free_ids.empty()) {
+      id = this->free_ids.back();
+      this->free_ids.pop_back();
+    } else {
+      id = this->slots;
+      std::size_t chunk_index = id / CHUNK_SIZE;
+      if (chunk_index >= MAX_CHUNKS) {
+        throw std::length_error("The frame registry cannot hold more than " + std::to_string(CHUNK_SIZE * MAX_CHUNKS)
+                                    + " names at once");
+      }
+      if (this->chunks[chunk_index].load(std::memory_order_relaxed) == nullptr) {
+        this->chunks[chunk_index].store(new Slot[CHUNK_SIZE], std::memory_order_release);
+      }
+      ++this->slots;
+    }
+    auto& slot = this->get_slot(id);
+    slot.name = name;
+    slot.references.store(1, std::memory_order_relaxed);
+    slot.registered = true;
+    this->ids.emplace(slot.name, id);
+    this->size.fetch_add(1, std::memory_order_release);
+    return id;
+  }
+
+  void remove(FrameId id) {
+    auto& slot = this->get_slot(id);
+    // the name may have been looked up again or already removed by another release since its count reached zero
+    if (!slot.registered || slot.references.load(std::memory_order_acquire) != 0) {
+      return;
+    }
+    this->ids.erase(slot.name);
+    slot.registered = false;
+    std::string().swap(slot.name);
+    this->free_ids.push_back(id);
+    this->size.fetch_sub(1, std::memory_order_release);
+  }
+
+  std::shared_mutex mutex;
+  std::unordered_map<std::string_view, FrameId> ids;///< identifiers of the names, viewing the names of the slots
+  std::vector<FrameId> free_ids;                     ///< identifiers of removed names to reuse
+  std::array<std::atomic<Slot*>, MAX_CHUNKS> chunks;
+  FrameId slots = 0;                                 ///< number of slots used so far
+  std::atomic<std::size_t> size;                     ///< number of registered names
+};
+
+Registry& get_registry() {
+  // never destroyed, as states with static storage duration may outlive it
+  static auto* instance = new Registry();
+  return *instance;
+}
+}// namespace
+
+FrameId FrameRegistry::find_id(const std::string& name) {
+  if (name.empty()) {
+    return EMPTY;
+  }
+  auto& registry = get_registry();
+  std::shared_lock<std::shared_mutex> lock(registry.mutex);
+  auto it = registry.ids.find(name);
+  return it != registry.ids.end() ? it->second : UNKNOWN;
+}
+
+const std::string& FrameRegistry::get_name(FrameId id) {
+  return get_registry().get_slot(id).name;
+}
+
+std::size_t FrameRegistry::size() {
+  return get_registry().size.load(std::memory_order_acquire);
+}
+
+FrameId FrameRegistry::acquire(const std::string& name) {
+  if (name.empty()) {
+    return EMPTY;
+  }
+  auto& registry = get_registry();
+  {
+    // the reference is added with the shared lock such that the name cannot be removed in the meantime
+    std::shared_lock<std::shared_mutex> lock(registry.mutex);
+    auto it = registry.ids.find(name);
+    if (it != registry.ids.end()) {
+      acquire(it->second);
+      return it->second;
+    }
+  }
+  std::unique_lock<std::shared_mutex> lock(registry.mutex);
+  auto it = registry.ids.find(name);
+  if (it != registry.ids.end()) {
+    acquire(it->second);
+    return it->second;
+  }
+  return registry.add(name);
+}
+
+void FrameRegistry::acquire(FrameId id) noexcept {
+  if (id >= PERMANENT_IDS) {
+    get_registry().get_slot(id).references.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+void FrameRegistry::release(FrameId id) noexcept {
+  if (id < PERMANENT_IDS) {
+    return;
+  }
+  auto& registry = get_registry();
+  if (registry.get_slot(id).references.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+    std::unique_lock<std::shared_mutex> lock(registry.mutex);
+    registry.remove(id);
+  }
+}
+}// namespace state_representation
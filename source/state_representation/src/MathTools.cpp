@@ -1,5 +1,165 @@
 #include "state_representation/MathTools.hpp"
 
+#include <cmath>
+#include <limits>
+
+#include "state_representation/exceptions/IncompatibleSizeException.hpp"
+
+// the batch kernels are cloned for AVX-512 and AVX2, the version matching the processor being selected when the
+// library is loaded, and use only plain arithmetic such that each clone is vectorized with its instruction set
+#if defined(__x86_64__) && defined(__linux__) && defined(__GNUC__)
+#define BATCH_KERNEL __attribute__((target_clones("avx512f", "avx2", "default")))
+#else
+#define BATCH_KERNEL
+#endif
+
+namespace {
+
+constexpr double PI = 3.14159265358979311600e+00;
+constexpr double PI_2 = 1.57079632679489655800e+00;
+constexpr double PI_4 = 7.85398163397448278999e-01;
+constexpr double PI_2_LOW = 6.12323399573676588613e-17;
+// beyond this argument, the range reduction of the sine and cosine loses precision
+constexpr double SINCOS_LIMIT = 1e5;
+
+/**
+ * @brief Round to the nearest integer without a library call, for arguments below 2^51
+ */
+inline double round_to_integer(double x) {
+  constexpr double shift = 6755399441055744.0;
+  return (x + shift) - shift;
+}
+
+/**
+ * @brief Compute the sine and cosine with a Cody-Waite reduction to [-pi/4, pi/4] and minimax polynomials
+ */
+inline void sincos(double x, double& sine, double& cosine) {
+  double j = round_to_integer(x * 6.36619772367581382433e-01);
+  double r = ((x - j * 1.57079632673412561417e+00) - j * 6.07710050630396597660e-11) - j * 2.02226624871116645580e-21;
+  double quadrant = j - 4 * round_to_integer(0.25 * j - 0.375);
+  double z = r * r;
+  double s = r + r * z * (-1.66666666666666324348e-01 + z * (8.33333333332248946124e-03 + z * (
+      -1.98412698298579493134e-04 + z * (2.75573137070700676789e-06 + z * (-2.50507602534068634195e-08
+      + z * 1.58969099521155010221e-10)))));
+  double c = 1 - 0.5 * z + z * z * (4.16666666666666019037e-02 + z * (-1.38888888888741095749e-03 + z * (
+      2.48015872894767294178e-05 + z * (-2.75573143513906633035e-07 + z * (2.08757232129817482790e-09
+      + z * -1.13596475577881948265e-11)))));
+  bool odd = quadrant == 1 || quadrant == 3;
+  double sine_abs = odd ? c : s;
+  double cosine_abs = odd ? s : c;
+  sine = quadrant >= 2 ? -sine_abs : sine_abs;
+  cosine = quadrant == 1 || quadrant == 2 ? -cosine_abs : cosine_abs;
+}
+
+/**
+ * @brief Compute the arc tangent of y / x in [0, pi] for a positive y, with the rational approximation of Cephes
+ */
+inline double atan2_positive(double y, double x) {
+  double ax = std::abs(x);
+  double large = std::max(ax, y);
+  double small = std::min(ax, y);
+  // divisions are done unconditionally with safe denominators, such that the selections can be vectorized
+  double a = small / (large > 0 ? large : 1);
+  bool reduce = a > 0.66;
+  double reduced = (a - 1) / (a + 1);
+  double t = reduce ? reduced : a;
+  double z = t * t;
+  double p = (((-8.750608600031904122785e-01 * z - 1.615753718733365076637e+01) * z - 7.500855792314704667340e+01) * z
+      - 1.228866684490136173410e+02) * z - 6.485021904942025371773e+01;
+  double q = ((((z + 2.485846490142306297962e+01) * z + 1.650270098316988542046e+02) * z + 4.328810604912902668951e+02)
+      * z + 4.853903996359136964868e+02) * z + 1.945506571482613964425e+02;
+  double r = t + t * z * p / q;
+  r = reduce ? PI_4 + (r + 0.5 * PI_2_LOW) : r;
+  r = y > ax ? PI_2 - r + PI_2_LOW : r;
+  return x < 0 ? PI - r : r;
+}
+
+BATCH_KERNEL void log_kernel(const double* input, double* output, Eigen::Index size) {
+  for (Eigen::Index i = 0; i < size; ++i) {
+    const double* q = input + 4 * i;
+    double sign = q[3] < 0 ? -1 : 1;
+    double x = sign * q[0], y = sign * q[1], z = sign * q[2], w = sign * q[3];
+    double norm = std::sqrt(x * x + y * y + z * z);
+    w = std::min(std::max(w, -1.0), 1.0);
+    double angle = atan2_positive(std::sqrt((1 - w) * (1 + w)), w);
+    double scale = norm > 1e-4 ? angle / std::max(norm, 1e-4) : 0;
+    double* result = output + 4 * i;
+    result[0] = scale * x;
+    result[1] = scale * y;
+    result[2] = scale * z;
+    result[3] = 0;
+  }
+}
+
+BATCH_KERNEL void exp_kernel(const double* input, double* output, Eigen::Index size, double lambda) {
+  for (Eigen::Index i = 0; i < size; ++i) {
+    const double* q = input + 4 * i;
+    double x = q[0], y = q[1], z = q[2];
+    double norm = std::sqrt(x * x + y * y + z * z);
+    double sine, cosine;
+    sincos(norm * lambda, sine, cosine);
+    bool rotation = norm > 1e-4;
+    double scale = rotation ? sine / std::max(norm, 1e-4) : 0;
+    double* result = output + 4 * i;
+    result[0] = scale * x;
+    result[1] = scale * y;
+    result[2] = scale * z;
+    result[3] = rotation ? cosine : 1;
+  }
+}
+
+BATCH_KERNEL void multiply_kernel(const double* lhs, const double* rhs, double* output, Eigen::Index size) {
+  for (Eigen::Index i = 0; i < size; ++i) {
+    const double* a = lhs + 4 * i;
+    const double* b = rhs + 4 * i;
+    double x = a[3] * b[0] + a[0] * b[3] + a[1] * b[2] - a[2] * b[1];
+    double y = a[3] * b[1] - a[0] * b[2] + a[1] * b[3] + a[2] * b[0];
+    double z = a[3] * b[2] + a[0] * b[1] - a[1] * b[0] + a[2] * b[3];
+    double w = a[3] * b[3] - a[0] * b[0] - a[1] * b[1] - a[2] * b[2];
+    double* result = output + 4 * i;
+    result[0] = x;
+    result[1] = y;
+    result[2] = z;
+    result[3] = w;
+  }
+}
+
+BATCH_KERNEL void slerp_kernel(
+    const double* start, const double* end, const double* t, double* output, Eigen::Index size
+) {
+  for (Eigen::Index i = 0; i < size; ++i) {
+    const double* a = start + 4 * i;
+    const double* b = end + 4 * i;
+    double d = a[0] * b[0] + a[1] * b[1] + a[2] * b[2] + a[3] * b[3];
+    double abs_d = std::min(std::abs(d), 1.0);
+    double theta = atan2_positive(std::sqrt((1 - abs_d) * (1 + abs_d)), abs_d);
+    double sin_theta, sin_start, sin_end, unused;
+    sincos(theta, sin_theta, unused);
+    sincos((1 - t[i]) * theta, sin_start, unused);
+    sincos(t[i] * theta, sin_end, unused);
+    bool linear = std::abs(d) >= 1 - std::numeric_limits<double>::epsilon();
+    double safe_sin_theta = linear ? 1 : sin_theta;
+    double scale_start = linear ? 1 - t[i] : sin_start / safe_sin_theta;
+    double scale_end = linear ? t[i] : sin_end / safe_sin_theta;
+    scale_end = d < 0 ? -scale_end : scale_end;
+    double* result = output + 4 * i;
+    result[0] = scale_start * a[0] + scale_end * b[0];
+    result[1] = scale_start * a[1] + scale_end * b[1];
+    result[2] = scale_start * a[2] + scale_end * b[2];
+    result[3] = scale_start * a[3] + scale_end * b[3];
+  }
+}
+
+template<typename T>
+void assert_same_size(const T& lhs, Eigen::Index size) {
+  if (lhs.cols() != size) {
+    throw state_representation::exceptions::IncompatibleSizeException(
+        "Input arrays of quaternions are of different sizes: " + std::to_string(lhs.cols()) + " and "
+            + std::to_string(size));
+  }
+}
+}// namespace
+
 namespace state_representation::math_tools {
 const Eigen::Quaterniond log(const Eigen::Quaterniond& q) {
   auto q_tmp = q;
@@ -24,6 +184,62 @@ const Eigen::Quaterniond exp(const Eigen::Quaterniond& q, double lambda) {
   return exp_q;
 }
 
+void log(
+    const Eigen::Ref<const Eigen::Matrix4Xd, 0, Eigen::OuterStride<4>>& quaternions,
+    Eigen::Ref<Eigen::Matrix4Xd, 0, Eigen::OuterStride<4>> result
+) {
+  assert_same_size(result, quaternions.cols());
+  log_kernel(quaternions.data(), result.data(), quaternions.cols());
+}
+
+void exp(
+    const Eigen::Ref<const Eigen::Matrix4Xd, 0, Eigen::OuterStride<4>>& quaternions,
+    Eigen::Ref<Eigen::Matrix4Xd, 0, Eigen::OuterStride<4>> result, double lambda
+) {
+  assert_same_size(result, quaternions.cols());
+  exp_kernel(quaternions.data(), result.data(), quaternions.cols(), lambda);
+  // the range reduction of the kernel is only accurate for moderate angles
+  if (quaternions.cols() == 0
+      || quaternions.topRows<3>().colwise().squaredNorm().maxCoeff() * lambda * lambda <= SINCOS_LIMIT * SINCOS_LIMIT) {
+    return;
+  }
+  for (Eigen::Index i = 0; i < quaternions.cols(); ++i) {
+    if (std::abs(quaternions.col(i).head<3>().norm() * lambda) > SINCOS_LIMIT) {
+      result.col(i) = exp(Eigen::Quaterniond(quaternions.col(i)), lambda).coeffs();
+    }
+  }
+}
+
+void multiply(
+    const Eigen::Ref<const Eigen::Matrix4Xd, 0, Eigen::OuterStride<4>>& lhs,
+    const Eigen::Ref<const Eigen::Matrix4Xd, 0, Eigen::OuterStride<4>>& rhs,
+    Eigen::Ref<Eigen::Matrix4Xd, 0, Eigen::OuterStride<4>> result
+) {
+  assert_same_size(rhs, lhs.cols());
+  assert_same_size(result, lhs.cols());
+  multiply_kernel(lhs.data(), rhs.data(), result.data(), lhs.cols());
+}
+
+void slerp(
+    const Eigen::Ref<const Eigen::Matrix4Xd, 0, Eigen::OuterStride<4>>& start,
+    const Eigen::Ref<const Eigen::Matrix4Xd, 0, Eigen::OuterStride<4>>& end, const Eigen::Ref<const Eigen::VectorXd>& t,
+    Eigen::Ref<Eigen::Matrix4Xd, 0, Eigen::OuterStride<4>> result
+) {
+  assert_same_size(end, start.cols());
+  assert_same_size(t.transpose(), start.cols());
+  assert_same_size(result, start.cols());
+  slerp_kernel(start.data(), end.data(), t.data(), result.data(), start.cols());
+  // the range reduction of the kernel is only accurate for moderate angles
+  if (start.cols() == 0 || t.cwiseAbs().maxCoeff() * PI_2 <= SINCOS_LIMIT) {
+    return;
+  }
+  for (Eigen::Index i = 0; i < start.cols(); ++i) {
+    if (std::abs(t(i)) * PI_2 > SINCOS_LIMIT) {
+      result.col(i) = Eigen::Quaterniond(start.col(i)).slerp(t(i), Eigen::Quaterniond(end.col(i))).coeffs();
+    }
+  }
+}
+
 const std::vector<double> linspace(double start, double end, unsigned int number_of_points) {
   // catch rarely, throw often
   if (number_of_points < 2) {
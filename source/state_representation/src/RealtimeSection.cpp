@@ -0,0 +1,25 @@
+#include "state_representation/RealtimeSection.hpp"
+
+// the initial-exec model keeps the access free of allocation as it is checked from within the allocator
+#if defined(__linux__) && defined(__GNUC__)
+#define INITIAL_EXEC_TLS __attribute__((tls_model("initial-exec")))
+#else
+#define INITIAL_EXEC_TLS
+#endif
+
+namespace state_representation {
+
+static thread_local unsigned int realtime_section_depth INITIAL_EXEC_TLS = 0;
+
+RealtimeSection::RealtimeSection() {
+  ++realtime_section_depth;
+}
+
+RealtimeSection::~RealtimeSection() {
+  --realtime_section_depth;
+}
+
+bool RealtimeSection::is_active() {
+  return realtime_section_depth > 0;
+}
+}// namespace state_representation
@@ -4,10 +4,17 @@
 
 namespace state_representation {
 
-State::State() : type_(StateType::STATE), empty_(true), timestamp_(std::chrono::steady_clock::now()) {}
+State::State() :
+    type_(StateType::STATE),
+    name_(),
+    empty_(true),
+    timestamp_(std::chrono::steady_clock::now()) {}
 
 State::State(const std::string& name) :
-    type_(StateType::STATE), name_(name), empty_(true), timestamp_(std::chrono::steady_clock::now()) {}
+    type_(StateType::STATE),
+    name_(name),
+    empty_(true),
+    timestamp_(std::chrono::steady_clock::now()) {}
 
 State::State(const State& state) :
     std::enable_shared_from_this<State>(state),
@@ -17,8 +24,29 @@ State::State(const State& state) :
     timestamp_(state.timestamp_) {}
 
 State& State::operator=(const State& state) {
-  State tmp(state);
-  swap(*this, tmp);
+  this->name_ = state.name_;
+  this->empty_ = state.empty_;
+  this->timestamp_ = state.timestamp_;
+  return *this;
+}
+
+State::State(State&& state) noexcept :
+    std::enable_shared_from_this<State>(state),
+    type_(StateType::STATE),
+    name_(state.name_),
+    empty_(state.empty_),
+    timestamp_(state.timestamp_) {
+  state.empty_ = true;
+}
+
+State& State::operator=(State&& state) noexcept {
+  if (this == &state) {
+    return *this;
+  }
+  this->name_ = state.name_;
+  this->empty_ = state.empty_;
+  this->timestamp_ = state.timestamp_;
+  state.empty_ = true;
   return *this;
 }
 
@@ -27,7 +55,11 @@ const StateType& State::get_type() const {
 }
 
 const std::string& State::get_name() const {
-  return this->name_;
+  return this->name_.get_name();
+}
+
+FrameId State::get_name_id() const {
+  return this->name_.get_id();
 }
 
 bool State::is_empty() const {
@@ -43,7 +75,12 @@ void State::set_type(const StateType& type) {
 }
 
 void State::set_name(const std::string& name) {
-  this->name_ = name;
+  this->name_ = FrameReference(name);
+  this->reset_timestamp();
+}
+
+void State::set_name_id(FrameId name_id) {
+  this->name_.set_id(name_id);
   this->reset_timestamp();
 }
 
@@ -54,10 +91,14 @@ void State::set_empty(bool empty) {
 
 void State::assert_not_empty() const {
   if (this->empty_) {
-    throw exceptions::EmptyStateException(this->name_ + " state is empty");
+    throw exceptions::EmptyStateException(this->get_name() + " state is empty");
   }
 }
 
+void State::set_timestamp(const std::chrono::time_point<std::chrono::steady_clock>& timestamp) {
+  this->timestamp_ = timestamp;
+}
+
 void State::reset_timestamp() {
   this->timestamp_ = std::chrono::steady_clock::now();
 }
@@ -0,0 +1,91 @@
+#include "state_representation/filters/BiquadFilter.hpp"
+
+#include "state_representation/exceptions/EmptyStateException.hpp"
+#include "state_representation/exceptions/IncompatibleSizeException.hpp"
+#include "state_representation/exceptions/InvalidParameterException.hpp"
+
+// the kernel runs over one joint per loop iteration on contiguous values, and is cloned such that several joints are
+// filtered with the widest vector registers of the processor
+#if defined(__x86_64__) && defined(__linux__) && defined(__GNUC__)
+#define BATCH_KERNEL __attribute__((target_clones("avx512f", "avx2", "default")))
+#else
+#define BATCH_KERNEL
+#endif
+
+namespace {
+
+BATCH_KERNEL void biquad_kernel(
+    double* values, double* z1, double* z2, Eigen::Index size, double b0, double b1, double b2, double a1, double a2
+) {
+  for (Eigen::Index i = 0; i < size; ++i) {
+    double x = values[i];
+    double y = b0 * x + z1[i];
+    z1[i] = b1 * x - a1 * y + z2[i];
+    z2[i] = b2 * x - a2 * y;
+    values[i] = y;
+  }
+}
+}// namespace
+
+namespace state_representation {
+
+using namespace exceptions;
+
+BiquadFilter::BiquadFilter(
+    unsigned int nb_joints, const JointStateVariable& variable, double b0, double b1, double b2, double a1, double a2
+) : nb_joints_(nb_joints), variable_(variable), b0_(b0), b1_(b1), b2_(b2), a1_(a1), a2_(a2), initialized_(false) {
+  Eigen::Index size = variable == JointStateVariable::ALL ? 4 * nb_joints : nb_joints;
+  this->z1_.setZero(size);
+  this->z2_.setZero(size);
+}
+
+BiquadFilter BiquadFilter::FirstOrderLowPass(
+    unsigned int nb_joints, const JointStateVariable& variable, double cutoff_frequency, double dt
+) {
+  if (cutoff_frequency <= 0 || dt <= 0) {
+    throw InvalidParameterException("The cutoff frequency and the sampling period of a filter must be positive");
+  }
+  double time_constant = 1 / (2 * M_PI * cutoff_frequency);
+  double alpha = dt / (time_constant + dt);
+  return BiquadFilter(nb_joints, variable, alpha, 0, 0, alpha - 1, 0);
+}
+
+BiquadFilter BiquadFilter::ButterworthLowPass(
+    unsigned int nb_joints, const JointStateVariable& variable, double cutoff_frequency, double dt
+) {
+  if (dt <= 0 || cutoff_frequency <= 0 || cutoff_frequency >= 0.5 / dt) {
+    throw InvalidParameterException(
+        "The cutoff frequency of a filter must be between 0 and the Nyquist frequency " + std::to_string(0.5 / dt));
+  }
+  // the analog cutoff frequency is prewarped such that the digital filter has its cutoff at the requested frequency
+  double k = std::tan(M_PI * cutoff_frequency * dt);
+  double norm = 1 / (1 + M_SQRT2 * k + k * k);
+  double b0 = k * k * norm;
+  return BiquadFilter(
+      nb_joints, variable, b0, 2 * b0, b0, 2 * (k * k - 1) * norm, (1 - M_SQRT2 * k + k * k) * norm
+  );
+}
+
+void BiquadFilter::update(JointState& state) {
+  if (state.is_empty()) {
+    throw EmptyStateException(state.get_name() + " state is empty");
+  }
+  if (state.get_size() != this->nb_joints_) {
+    throw IncompatibleSizeException(
+        "The joint state " + state.get_name() + " has " + std::to_string(state.get_size())
+            + " joints instead of the " + std::to_string(this->nb_joints_) + " joints of the filter");
+  }
+  auto values = state.get_variable_map(this->variable_);
+  if (!this->initialized_) {
+    // steady state of the filter for a constant input, the output being the input scaled by the gain at 0 Hz
+    double gain = (this->b0_ + this->b1_ + this->b2_) / (1 + this->a1_ + this->a2_);
+    this->z1_ = (gain - this->b0_) * values;
+    this->z2_ = (this->b2_ - this->a2_ * gain) * values;
+    this->initialized_ = true;
+  }
+  biquad_kernel(
+      values.data(), this->z1_.data(), this->z2_.data(), values.size(), this->b0_, this->b1_, this->b2_, this->a1_,
+      this->a2_
+  );
+}
+}// namespace state_representation
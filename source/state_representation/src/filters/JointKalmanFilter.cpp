@@ -0,0 +1,93 @@
+#include "state_representation/filters/JointKalmanFilter.hpp"
+
+#include "state_representation/exceptions/EmptyStateException.hpp"
+#include "state_representation/exceptions/IncompatibleSizeException.hpp"
+#include "state_representation/exceptions/InvalidParameterException.hpp"
+
+// the kernel runs over one joint per loop iteration on contiguous values, and is cloned such that several joints are
+// estimated with the widest vector registers of the processor
+#if defined(__x86_64__) && defined(__linux__) && defined(__GNUC__)
+#define BATCH_KERNEL __attribute__((target_clones("avx512f", "avx2", "default")))
+#else
+#define BATCH_KERNEL
+#endif
+
+namespace {
+
+BATCH_KERNEL void kalman_kernel(
+    double* positions, double* velocities, double* accelerations, double* p, double* v, double* a, Eigen::Index size,
+    double dt, double k0, double k1, double k2
+) {
+  double half_dt2 = 0.5 * dt * dt;
+  for (Eigen::Index i = 0; i < size; ++i) {
+    double predicted_p = p[i] + dt * v[i] + half_dt2 * a[i];
+    double predicted_v = v[i] + dt * a[i];
+    double innovation = positions[i] - predicted_p;
+    p[i] = predicted_p + k0 * innovation;
+    v[i] = predicted_v + k1 * innovation;
+    a[i] += k2 * innovation;
+    positions[i] = p[i];
+    velocities[i] = v[i];
+    accelerations[i] = a[i];
+  }
+}
+}// namespace
+
+namespace state_representation {
+
+using namespace exceptions;
+
+JointKalmanFilter::JointKalmanFilter(
+    unsigned int nb_joints, double dt, double process_noise, double measurement_noise
+) : nb_joints_(nb_joints), measurement_noise_(measurement_noise), gain_(Eigen::Vector3d::Zero()),
+    initialized_(false) {
+  if (dt <= 0 || process_noise <= 0 || measurement_noise <= 0) {
+    throw InvalidParameterException("The sampling period and the noises of a Kalman filter must be positive");
+  }
+  this->transition_ << 1, dt, 0.5 * dt * dt, 0, 1, dt, 0, 0, 1;
+  double dt2 = dt * dt;
+  double dt3 = dt2 * dt;
+  this->process_noise_ << dt3 * dt2 / 20, dt2 * dt2 / 8, dt3 / 6,
+      dt2 * dt2 / 8, dt3 / 3, dt2 / 2,
+      dt3 / 6, dt2 / 2, dt;
+  this->process_noise_ *= process_noise;
+  // the velocity and acceleration are only known from differences of measurements after the first one
+  this->initial_covariance_ = Eigen::Vector3d(1, 1 / dt2, 1 / (dt2 * dt2)).asDiagonal();
+  this->initial_covariance_ *= measurement_noise;
+  this->covariance_ = this->initial_covariance_;
+  this->estimates_.setZero(nb_joints, 3);
+}
+
+void JointKalmanFilter::update(JointState& state) {
+  if (state.is_empty()) {
+    throw EmptyStateException(state.get_name() + " state is empty");
+  }
+  if (state.get_size() != this->nb_joints_) {
+    throw IncompatibleSizeException(
+        "The joint state " + state.get_name() + " has " + std::to_string(state.get_size())
+            + " joints instead of the " + std::to_string(this->nb_joints_) + " joints of the filter");
+  }
+  auto positions = state.get_variable_map(JointStateVariable::POSITIONS);
+  auto velocities = state.get_variable_map(JointStateVariable::VELOCITIES);
+  auto accelerations = state.get_variable_map(JointStateVariable::ACCELERATIONS);
+  if (!this->initialized_) {
+    this->estimates_.col(0) = positions;
+    this->estimates_.rightCols<2>().setZero();
+    this->covariance_ = this->initial_covariance_;
+    this->gain_.setZero();
+    velocities.setZero();
+    accelerations.setZero();
+    this->initialized_ = true;
+    return;
+  }
+  // the covariance and the gain do not depend on the measurements and are shared by all the joints
+  Eigen::Matrix3d predicted = this->transition_ * this->covariance_ * this->transition_.transpose()
+      + this->process_noise_;
+  this->gain_ = predicted.col(0) / (predicted(0, 0) + this->measurement_noise_);
+  this->covariance_ = predicted - this->gain_ * predicted.row(0);
+  kalman_kernel(
+      positions.data(), velocities.data(), accelerations.data(), this->estimates_.col(0).data(),
+      this->estimates_.col(1).data(), this->estimates_.col(2).data(), this->nb_joints_, this->transition_(0, 1),
+      this->gain_(0), this->gain_(1), this->gain_(2));
+}
+}// namespace state_representation
@@ -0,0 +1,94 @@
+#include "state_representation/filters/SavitzkyGolayDifferentiator.hpp"
+
+#include "state_representation/exceptions/EmptyStateException.hpp"
+#include "state_representation/exceptions/IncompatibleSizeException.hpp"
+#include "state_representation/exceptions/InvalidParameterException.hpp"
+
+// the inner loop runs over the joints of a sample, and is cloned such that several joints are weighted with the
+// widest vector registers of the processor
+#if defined(__x86_64__) && defined(__linux__) && defined(__GNUC__)
+#define BATCH_KERNEL __attribute__((target_clones("avx512f", "avx2", "default")))
+#else
+#define BATCH_KERNEL
+#endif
+
+namespace {
+
+BATCH_KERNEL void weighted_sum_kernel(
+    const double* samples, Eigen::Index size, Eigen::Index window, Eigen::Index oldest, const double* weights,
+    Eigen::Index weights_stride, double* result
+) {
+  for (Eigen::Index i = 0; i < size; ++i) {
+    result[i] = 0;
+  }
+  for (Eigen::Index k = 0; k < window; ++k) {
+    const double* sample = samples + ((oldest + k) % window) * size;
+    double weight = weights[k * weights_stride];
+    for (Eigen::Index i = 0; i < size; ++i) {
+      result[i] += weight * sample[i];
+    }
+  }
+}
+}// namespace
+
+namespace state_representation {
+
+using namespace exceptions;
+
+SavitzkyGolayDifferentiator::SavitzkyGolayDifferentiator(
+    unsigned int nb_joints, unsigned int window, unsigned int order, double dt
+) : nb_joints_(nb_joints), window_(window), order_(order), newest_(0), initialized_(false) {
+  if (order == 0 || window <= order) {
+    throw IncompatibleSizeException(
+        "The window of a differentiator must be larger than the order of the polynomial, and the order positive");
+  }
+  if (dt <= 0) {
+    throw InvalidParameterException("The sampling period of a differentiator must be positive");
+  }
+  // fit of the polynomial on the sample times relative to the newest sample, such that the derivatives at the newest
+  // sample are the coefficients of the polynomial scaled by the factorial of their degree
+  Eigen::MatrixXd vandermonde(window, order + 1);
+  for (unsigned int k = 0; k < window; ++k) {
+    double t = static_cast<double>(k) - static_cast<double>(window - 1);
+    vandermonde(k, 0) = 1;
+    for (unsigned int p = 1; p <= order; ++p) {
+      vandermonde(k, p) = vandermonde(k, p - 1) * t;
+    }
+  }
+  Eigen::MatrixXd fit = vandermonde.completeOrthogonalDecomposition().pseudoInverse();
+  unsigned int derivatives = std::min(order, 2u);
+  this->weights_.resize(derivatives, window);
+  this->weights_.row(0) = fit.row(1) / dt;
+  if (derivatives == 2) {
+    this->weights_.row(1) = 2 * fit.row(2) / (dt * dt);
+  }
+  this->samples_.setZero(nb_joints, window);
+}
+
+void SavitzkyGolayDifferentiator::update(JointState& state) {
+  if (state.is_empty()) {
+    throw EmptyStateException(state.get_name() + " state is empty");
+  }
+  if (state.get_size() != this->nb_joints_) {
+    throw IncompatibleSizeException(
+        "The joint state " + state.get_name() + " has " + std::to_string(state.get_size())
+            + " joints instead of the " + std::to_string(this->nb_joints_) + " joints of the differentiator");
+  }
+  auto positions = state.get_variable_map(JointStateVariable::POSITIONS);
+  if (!this->initialized_) {
+    this->samples_.colwise() = positions;
+    this->initialized_ = true;
+  }
+  this->newest_ = (this->newest_ + 1) % this->window_;
+  this->samples_.col(this->newest_) = positions;
+  unsigned int oldest = (this->newest_ + 1) % this->window_;
+  weighted_sum_kernel(
+      this->samples_.data(), this->nb_joints_, this->window_, oldest, this->weights_.data(), this->weights_.rows(),
+      state.get_variable_map(JointStateVariable::VELOCITIES).data());
+  if (this->weights_.rows() == 2) {
+    weighted_sum_kernel(
+        this->samples_.data(), this->nb_joints_, this->window_, oldest, this->weights_.data() + 1,
+        this->weights_.rows(), state.get_variable_map(JointStateVariable::ACCELERATIONS).data());
+  }
+}
+}// namespace state_representation
@@ -38,6 +38,23 @@ Ellipsoid& Ellipsoid::operator=(const Ellipsoid& state) {
   return *this;
 }
 
+Ellipsoid::Ellipsoid(Ellipsoid&& ellipsoid) noexcept :
+    Shape(std::move(ellipsoid)),
+    axis_lengths_(std::move(ellipsoid.axis_lengths_)),
+    rotation_angle_(ellipsoid.rotation_angle_) {
+  this->set_type(StateType::GEOMETRY_ELLIPSOID);
+}
+
+Ellipsoid& Ellipsoid::operator=(Ellipsoid&& ellipsoid) noexcept {
+  if (this == &ellipsoid) {
+    return *this;
+  }
+  Shape::operator=(std::move(ellipsoid));
+  this->axis_lengths_ = std::move(ellipsoid.axis_lengths_);
+  this->rotation_angle_ = ellipsoid.rotation_angle_;
+  return *this;
+}
+
 const std::vector<double>& Ellipsoid::get_axis_lengths() const {
   this->assert_not_empty();
   return this->axis_lengths_;
@@ -32,6 +32,19 @@ Shape& Shape::operator=(const Shape& state) {
   return *this;
 }
 
+Shape::Shape(Shape&& shape) noexcept : State(std::move(shape)), center_state_(std::move(shape.center_state_)) {
+  this->set_type(StateType::GEOMETRY_SHAPE);
+}
+
+Shape& Shape::operator=(Shape&& shape) noexcept {
+  if (this == &shape) {
+    return *this;
+  }
+  State::operator=(std::move(shape));
+  this->center_state_ = std::move(shape.center_state_);
+  return *this;
+}
+
 const CartesianState& Shape::get_center_state() const {
   this->assert_not_empty();
   return this->center_state_;
@@ -66,7 +79,7 @@ void Shape::set_center_state(const CartesianState& state) {
 }
 
 void Shape::set_center_pose(const CartesianPose& pose) {
-  if (this->center_state_.get_reference_frame() != pose.get_reference_frame()) {
+  if (this->center_state_.get_reference_frame_id() != pose.get_reference_frame_id()) {
     throw exceptions::IncompatibleReferenceFramesException(
         "The shape state and the given pose are not expressed in the same reference frame");
   }
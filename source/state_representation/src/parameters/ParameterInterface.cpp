@@ -22,6 +22,20 @@ ParameterInterface& ParameterInterface::operator=(const ParameterInterface& stat
   return (*this);
 }
 
+ParameterInterface::ParameterInterface(ParameterInterface&& parameter) noexcept :
+    State(std::move(parameter)),
+    parameter_type_(parameter.parameter_type_),
+    parameter_state_type_(parameter.parameter_state_type_) {
+  this->set_type(StateType::PARAMETER);
+}
+
+ParameterInterface& ParameterInterface::operator=(ParameterInterface&& parameter) noexcept {
+  State::operator=(std::move(parameter));
+  this->parameter_type_ = parameter.parameter_type_;
+  this->parameter_state_type_ = parameter.parameter_state_type_;
+  return *this;
+}
+
 ParameterType ParameterInterface::get_parameter_type() const {
   return parameter_type_;
 }
@@ -77,8 +77,40 @@ Jacobian Jacobian::Random(
 }
 
 Jacobian& Jacobian::operator=(const Jacobian& jacobian) {
-  Jacobian tmp(jacobian);
-  swap(*this, tmp);
+  // assign the members in place to reuse the storage of the joint names and data when the sizes match
+  State::operator=(jacobian);
+  this->joint_names_ = jacobian.joint_names_;
+  this->frame_ = jacobian.frame_;
+  this->reference_frame_ = jacobian.reference_frame_;
+  if (jacobian) {
+    this->data_ = jacobian.data_;
+  } else {
+    this->data_.setZero(6, jacobian.data_.cols());
+  }
+  this->set_empty(jacobian.is_empty());
+  return *this;
+}
+
+Jacobian::Jacobian(Jacobian&& jacobian) noexcept :
+    State(std::move(jacobian)),
+    joint_names_(std::move(jacobian.joint_names_)),
+    frame_(std::move(jacobian.frame_)),
+    reference_frame_(std::move(jacobian.reference_frame_)),
+    data_(std::move(jacobian.data_)) {
+  this->set_type(StateType::JACOBIAN);
+}
+
+Jacobian& Jacobian::operator=(Jacobian&& jacobian) noexcept {
+  if (this == &jacobian) {
+    return *this;
+  }
+  State::operator=(std::move(jacobian));
+  this->joint_names_ = std::move(jacobian.joint_names_);
+  this->frame_ = std::move(jacobian.frame_);
+  this->reference_frame_ = std::move(jacobian.reference_frame_);
+  this->data_ = std::move(jacobian.data_);
+  // the previous matrix of this Jacobian is swapped into the moved-from Jacobian, release it to match its empty names
+  jacobian.data_.resize(0, 0);
   return *this;
 }
 
@@ -193,7 +225,7 @@ bool Jacobian::is_incompatible(const State& state) const {
   try {
     switch (state.get_type()) {
       case StateType::JACOBIAN: {
-        auto other = dynamic_cast<const Jacobian&>(state);
+        const auto& other = dynamic_cast<const Jacobian&>(state);
         if (this->cols() != other.joint_names_.size()) {
           return true;
         }
@@ -212,7 +244,7 @@ bool Jacobian::is_incompatible(const State& state) const {
       case StateType::JOINT_VELOCITIES:
       case StateType::JOINT_ACCELERATIONS:
       case StateType::JOINT_TORQUES: {
-        auto other = dynamic_cast<const JointState&>(state);
+        const auto& other = dynamic_cast<const JointState&>(state);
         if (this->cols() != other.get_names().size()) {
           return true;
         }
@@ -228,7 +260,7 @@ bool Jacobian::is_incompatible(const State& state) const {
       case StateType::CARTESIAN_TWIST:
       case StateType::CARTESIAN_ACCELERATION:
       case StateType::CARTESIAN_WRENCH: {
-        auto other = dynamic_cast<const CartesianState&>(state);
+        const auto& other = dynamic_cast<const CartesianState&>(state);
         if (this->reference_frame_ != other.get_reference_frame()) {
           return true;
         }
@@ -248,7 +280,7 @@ Eigen::MatrixXd Jacobian::pseudoinverse() const {
 
 Eigen::MatrixXd Jacobian::pseudoinverse(const Eigen::MatrixXd& matrix) const {
   assert_matrix_size(matrix, this->rows(), matrix.cols());
-  return this->pseudoinverse() * matrix;
+  return this->data().completeOrthogonalDecomposition().solve(matrix);
 }
 
 JointVelocities Jacobian::pseudoinverse(const CartesianTwist& twist) const {
@@ -266,7 +298,7 @@ JointTorques Jacobian::transpose(const CartesianWrench& wrench) const {
   if (this->is_incompatible(wrench)) {
     throw IncompatibleStatesException("The Jacobian and the given Cartesian wrench are incompatible");
   }
-  return JointTorques(this->get_name(), this->get_joint_names(), this->transpose() * wrench.data());
+  return JointTorques(this->get_name(), this->get_joint_names(), this->data().transpose() * wrench.data());
 }
 
 Eigen::MatrixXd Jacobian::operator*(const Eigen::MatrixXd& matrix) const {
@@ -0,0 +1,152 @@
+#include "state_representation/space/JacobianPseudoinverse.hpp"
+
+#include <cmath>
+#include <limits>
+
+#include "state_representation/exceptions/EmptyStateException.hpp"
+#include "state_representation/exceptions/IncompatibleSizeException.hpp"
+#include "state_representation/exceptions/IncompatibleStatesException.hpp"
+#include "state_representation/exceptions/InvalidParameterException.hpp"
+
+namespace state_representation {
+
+using namespace exceptions;
+
+JacobianPseudoinverse::JacobianPseudoinverse(double condition_threshold, double max_damping) :
+    condition_threshold_(),
+    max_damping_(),
+    computed_(false),
+    use_svd_(false),
+    condition_number_(0),
+    manipulability_(0),
+    damping_(0) {
+  this->set_condition_threshold(condition_threshold);
+  this->set_max_damping(max_damping);
+}
+
+JacobianPseudoinverse::JacobianPseudoinverse(
+    const Jacobian& jacobian, double condition_threshold, double max_damping
+) : JacobianPseudoinverse(condition_threshold, max_damping) {
+  this->compute(jacobian);
+}
+
+void JacobianPseudoinverse::set_condition_threshold(double condition_threshold) {
+  if (!(condition_threshold > 1)) {
+    throw InvalidParameterException("The condition threshold has to be greater than 1");
+  }
+  this->condition_threshold_ = condition_threshold;
+}
+
+void JacobianPseudoinverse::set_max_damping(double max_damping) {
+  if (!(max_damping > 0)) {
+    throw InvalidParameterException("The maximum damping has to be positive");
+  }
+  this->max_damping_ = max_damping;
+}
+
+void JacobianPseudoinverse::compute(const Jacobian& jacobian) {
+  if (jacobian.is_empty()) {
+    throw EmptyStateException(jacobian.get_name() + " state is empty");
+  }
+  this->jacobian_ = jacobian;
+  const Eigen::MatrixXd& data = this->jacobian_.data();
+  this->use_svd_ = true;
+  if (data.cols() >= data.rows()) {
+    Eigen::Matrix<double, 6, 6> gram;
+    gram.noalias() = data * data.transpose();
+    this->ldlt_.compute(gram);
+    // the condition number of JJ^T is the square of the one of J, and the estimate of LDLT ignores zero pivots
+    bool definite = this->ldlt_.info() == Eigen::Success && this->ldlt_.vectorD().minCoeff() > 0;
+    double rcond = definite ? this->ldlt_.rcond() : 0;
+    if (rcond > 0 && std::sqrt(1 / rcond) <= this->condition_threshold_) {
+      this->use_svd_ = false;
+      this->condition_number_ = std::sqrt(1 / rcond);
+      this->manipulability_ = std::sqrt(this->ldlt_.vectorD().prod());
+      this->damping_ = 0;
+    }
+  }
+  if (this->use_svd_) {
+    this->compute_svd();
+  }
+  this->computed_ = true;
+}
+
+void JacobianPseudoinverse::compute_svd() {
+  this->svd_.compute(this->jacobian_.data(), Eigen::ComputeThinU | Eigen::ComputeThinV);
+  const Eigen::VectorXd& singular_values = this->svd_.singularValues();
+  double max_singular_value = singular_values(0);
+  double min_singular_value = singular_values(singular_values.size() - 1);
+  this->condition_number_ = min_singular_value > 0 ? max_singular_value / min_singular_value
+                                                   : std::numeric_limits<double>::infinity();
+  this->manipulability_ = singular_values.prod();
+  // damp the singular values in the region below the largest one divided by the threshold, the damping growing
+  // from zero at its boundary to the maximum damping at the singularity
+  double singular_region = max_singular_value / this->condition_threshold_;
+  this->damping_ = 0;
+  if (min_singular_value < singular_region) {
+    double ratio = min_singular_value / singular_region;
+    this->damping_ = this->max_damping_ * std::sqrt(1 - ratio * ratio);
+  }
+  this->inverse_singular_values_.resize(singular_values.size());
+  for (Eigen::Index i = 0; i < singular_values.size(); ++i) {
+    double denominator = singular_values(i) * singular_values(i) + this->damping_ * this->damping_;
+    this->inverse_singular_values_(i) = denominator > 0 ? singular_values(i) / denominator : 0;
+  }
+}
+
+void JacobianPseudoinverse::assert_computed() const {
+  if (!this->computed_) {
+    throw EmptyStateException("No Jacobian has been decomposed");
+  }
+}
+
+void JacobianPseudoinverse::solve_vector(
+    const Eigen::Matrix<double, 6, 1>& vector, Eigen::Ref<Eigen::VectorXd> result
+) const {
+  if (!this->use_svd_) {
+    Eigen::Matrix<double, 6, 1> solution = this->ldlt_.solve(vector);
+    result.noalias() = this->jacobian_.data().transpose() * solution;
+  } else {
+    Eigen::Matrix<double, Eigen::Dynamic, 1, 0, 6, 1> projection = this->svd_.matrixU().transpose() * vector;
+    projection.array() *= this->inverse_singular_values_.array();
+    result.noalias() = this->svd_.matrixV() * projection;
+  }
+}
+
+Eigen::MatrixXd JacobianPseudoinverse::get_pseudoinverse() const {
+  return this->solve(Eigen::MatrixXd::Identity(6, 6));
+}
+
+Eigen::MatrixXd JacobianPseudoinverse::solve(const Eigen::MatrixXd& matrix) const {
+  this->assert_computed();
+  if (matrix.rows() != 6) {
+    throw IncompatibleSizeException(
+        "Input matrix is of incorrect size, expected 6 rows, got " + std::to_string(matrix.rows()));
+  }
+  Eigen::MatrixXd result(this->jacobian_.cols(), matrix.cols());
+  for (Eigen::Index i = 0; i < matrix.cols(); ++i) {
+    this->solve_vector(matrix.col(i), result.col(i));
+  }
+  return result;
+}
+
+JointVelocities JacobianPseudoinverse::solve(const CartesianTwist& twist) const {
+  this->assert_computed();
+  JointVelocities velocities(this->jacobian_.get_name(), this->jacobian_.get_joint_names());
+  this->solve(twist, velocities);
+  return velocities;
+}
+
+void JacobianPseudoinverse::solve(const CartesianTwist& twist, JointVelocities& velocities) const {
+  this->assert_computed();
+  if (this->jacobian_.is_incompatible(twist)) {
+    throw IncompatibleStatesException("The Jacobian and the given Cartesian twist are incompatible");
+  }
+  if (velocities.get_name() != this->jacobian_.get_name()
+      || velocities.get_names() != this->jacobian_.get_joint_names()) {
+    velocities = JointVelocities(this->jacobian_.get_name(), this->jacobian_.get_joint_names());
+  }
+  this->solve_vector(twist.get_twist(), velocities.get_variable_map(JointStateVariable::VELOCITIES));
+  velocities.set_empty(false);
+}
+}// namespace state_representation
@@ -4,7 +4,7 @@
 
 namespace state_representation {
 
-SpatialState::SpatialState() : State(), reference_frame_("world") {
+SpatialState::SpatialState() : State(), reference_frame_(FrameRegistry::WORLD) {
   this->set_type(StateType::SPATIAL_STATE);
 }
 
@@ -13,34 +13,59 @@ SpatialState::SpatialState(const std::string& name, const std::string& reference
   this->set_type(StateType::SPATIAL_STATE);
 }
 
-SpatialState::SpatialState(const SpatialState& state) : State(state), reference_frame_(state.reference_frame_) {
+SpatialState::SpatialState(const SpatialState& state) :
+    State(state), reference_frame_(state.reference_frame_) {
   this->set_type(StateType::SPATIAL_STATE);
 }
 
 SpatialState& SpatialState::operator=(const SpatialState& state) {
-  SpatialState tmp(state);
-  swap(*this, tmp);
+  State::operator=(state);
+  this->reference_frame_ = state.reference_frame_;
+  return *this;
+}
+
+SpatialState::SpatialState(SpatialState&& state) noexcept :
+    State(std::move(state)), reference_frame_(state.reference_frame_) {
+  this->set_type(StateType::SPATIAL_STATE);
+}
+
+SpatialState& SpatialState::operator=(SpatialState&& state) noexcept {
+  if (this == &state) {
+    return *this;
+  }
+  State::operator=(std::move(state));
+  this->reference_frame_ = state.reference_frame_;
   return *this;
 }
 
 const std::string& SpatialState::get_reference_frame() const {
-  return this->reference_frame_;
+  return this->reference_frame_.get_name();
+}
+
+FrameId SpatialState::get_reference_frame_id() const {
+  return this->reference_frame_.get_id();
 }
 
 void SpatialState::set_reference_frame(const std::string& reference_frame) {
-  this->reference_frame_ = reference_frame;
+  this->reference_frame_ = FrameReference(reference_frame);
+  this->reset_timestamp();
+}
+
+void SpatialState::set_reference_frame_id(FrameId reference_frame_id) {
+  this->reference_frame_.set_id(reference_frame_id);
   this->reset_timestamp();
 }
 
 bool SpatialState::is_incompatible(const State& state) const {
   try {
-    auto other = dynamic_cast<const SpatialState&>(state);
+    const auto& other = dynamic_cast<const SpatialState&>(state);
     // the three conditions for compatibility are:
     // 1) this name matches other reference frame (this is parent transform of other)
     // 2) this reference frame matches other name (this is child transform of other)
     // 3) this reference frame matches other reference frame (this is sibling transform of other)
-    return (this->get_name() != other.reference_frame_) && (this->reference_frame_ != other.get_name())
-        && (this->get_reference_frame() != other.reference_frame_);
+    return (this->get_name_id() != other.get_reference_frame_id())
+        && (this->get_reference_frame_id() != other.get_name_id())
+        && (this->get_reference_frame_id() != other.get_reference_frame_id());
   } catch (const std::bad_cast& ex) {
     throw exceptions::InvalidCastException(
         std::string("Could not cast the given object to a SpatialState: ") + ex.what());
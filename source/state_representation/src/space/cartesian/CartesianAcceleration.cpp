@@ -48,6 +48,10 @@ CartesianAcceleration::CartesianAcceleration(const CartesianState& state) : Cart
 CartesianAcceleration::CartesianAcceleration(const CartesianAcceleration& acceleration) :
     CartesianAcceleration(static_cast<const CartesianState&>(acceleration)) {}
 
+CartesianAcceleration::CartesianAcceleration(CartesianAcceleration&& acceleration) noexcept : CartesianState(std::move(acceleration)) {
+  this->set_type(StateType::CARTESIAN_ACCELERATION);
+}
+
 CartesianAcceleration::CartesianAcceleration(const CartesianTwist& twist) :
     CartesianAcceleration(twist.differentiate(1.0)) {}
 
@@ -111,7 +115,9 @@ CartesianTwist CartesianAcceleration::integrate(const std::chrono::nanoseconds&
 }
 
 CartesianAcceleration CartesianAcceleration::inverse() const {
-  return this->CartesianState::inverse();
+  CartesianAcceleration result;
+  this->invert(CartesianStateVariable::ACCELERATION, result);
+  return result;
 }
 
 CartesianAcceleration CartesianAcceleration::normalized(const CartesianStateVariable& state_variable_type) const {
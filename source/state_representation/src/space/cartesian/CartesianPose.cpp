@@ -53,6 +53,10 @@ CartesianPose::CartesianPose(const CartesianState& state) : CartesianState(state
 
 CartesianPose::CartesianPose(const CartesianPose& pose) : CartesianPose(static_cast<const CartesianState&>(pose)) {}
 
+CartesianPose::CartesianPose(CartesianPose&& pose) noexcept : CartesianState(std::move(pose)) {
+  this->set_type(StateType::CARTESIAN_POSE);
+}
+
 CartesianPose::CartesianPose(const CartesianTwist& twist) : CartesianPose(twist.integrate(1.0)) {}
 
 CartesianPose CartesianPose::Identity(const std::string& name, const std::string& reference) {
@@ -105,7 +109,9 @@ CartesianTwist CartesianPose::differentiate(const std::chrono::nanoseconds& dt)
 }
 
 CartesianPose CartesianPose::inverse() const {
-  return this->CartesianState::inverse();
+  CartesianPose result;
+  this->invert(CartesianStateVariable::POSE, result);
+  return result;
 }
 
 CartesianPose CartesianPose::normalized(const CartesianStateVariable& state_variable_type) const {
@@ -117,12 +123,12 @@ std::vector<double> CartesianPose::norms(const CartesianStateVariable& state_var
 }
 
 CartesianPose& CartesianPose::operator*=(const CartesianState& state) {
-  this->CartesianState::operator*=(state);
+  this->transform_by_pose(state, CartesianStateVariable::POSE, *this);
   return (*this);
 }
 
 CartesianPose& CartesianPose::operator*=(const CartesianPose& pose) {
-  this->CartesianState::operator*=(pose);
+  this->transform_by_pose(pose, CartesianStateVariable::POSE, *this);
   return (*this);
 }
 
@@ -131,19 +137,27 @@ CartesianState CartesianPose::operator*(const CartesianState& state) const {
 }
 
 CartesianPose CartesianPose::operator*(const CartesianPose& pose) const {
-  return this->CartesianState::operator*(pose);
+  CartesianPose result;
+  this->transform_by_pose(pose, CartesianStateVariable::POSE, result);
+  return result;
 }
 
 CartesianTwist CartesianPose::operator*(const CartesianTwist& twist) const {
-  return this->CartesianState::operator*(twist);
+  CartesianTwist result;
+  this->transform_by_pose(twist, CartesianStateVariable::TWIST, result);
+  return result;
 }
 
 CartesianAcceleration CartesianPose::operator*(const CartesianAcceleration& acceleration) const {
-  return this->CartesianState::operator*(acceleration);
+  CartesianAcceleration result;
+  this->transform_by_pose(acceleration, CartesianStateVariable::ACCELERATION, result);
+  return result;
 }
 
 CartesianWrench CartesianPose::operator*(const CartesianWrench& wrench) const {
-  return this->CartesianState::operator*(wrench);
+  CartesianWrench result;
+  this->transform_by_pose(wrench, CartesianStateVariable::WRENCH, result);
+  return result;
 }
 
 CartesianPose& CartesianPose::operator*=(double lambda) {
@@ -58,8 +58,9 @@ CartesianState::CartesianState(const std::string& name, const std::string& refer
   this->set_reference_frame(reference);
 }
 
-CartesianState::CartesianState(const CartesianState& state) :
-    CartesianState(state.get_name(), state.get_reference_frame()) {
+CartesianState::CartesianState(const CartesianState& state) : CartesianState() {
+  this->set_name_id(state.get_name_id());
+  this->set_reference_frame_id(state.get_reference_frame_id());
   if (state) {
     this->set_state_variable(state.get_state_variable(CartesianStateVariable::ALL), CartesianStateVariable::ALL);
   }
@@ -81,8 +82,49 @@ CartesianState CartesianState::Random(const std::string& name, const std::string
 }
 
 CartesianState& CartesianState::operator=(const CartesianState& state) {
-  CartesianState tmp(state);
-  swap(*this, tmp);
+  SpatialState::operator=(state);
+  if (state) {
+    this->position_ = state.position_;
+    this->orientation_ = state.orientation_;
+    this->linear_velocity_ = state.linear_velocity_;
+    this->angular_velocity_ = state.angular_velocity_;
+    this->linear_acceleration_ = state.linear_acceleration_;
+    this->angular_acceleration_ = state.angular_acceleration_;
+    this->force_ = state.force_;
+    this->torque_ = state.torque_;
+  } else {
+    this->set_zero();
+  }
+  this->set_empty(state.is_empty());
+  return *this;
+}
+
+CartesianState::CartesianState(CartesianState&& state) noexcept :
+    SpatialState(std::move(state)),
+    position_(state.position_),
+    orientation_(state.orientation_),
+    linear_velocity_(state.linear_velocity_),
+    angular_velocity_(state.angular_velocity_),
+    linear_acceleration_(state.linear_acceleration_),
+    angular_acceleration_(state.angular_acceleration_),
+    force_(state.force_),
+    torque_(state.torque_) {
+  this->set_type(StateType::CARTESIAN_STATE);
+}
+
+CartesianState& CartesianState::operator=(CartesianState&& state) noexcept {
+  if (this == &state) {
+    return *this;
+  }
+  SpatialState::operator=(std::move(state));
+  this->position_ = state.position_;
+  this->orientation_ = state.orientation_;
+  this->linear_velocity_ = state.linear_velocity_;
+  this->angular_velocity_ = state.angular_velocity_;
+  this->linear_acceleration_ = state.linear_acceleration_;
+  this->angular_acceleration_ = state.angular_acceleration_;
+  this->force_ = state.force_;
+  this->torque_ = state.torque_;
   return *this;
 }
 
@@ -172,7 +214,10 @@ const Eigen::Vector3d& CartesianState::get_angular_velocity() const {
 }
 
 Eigen::Matrix<double, 6, 1> CartesianState::get_twist() const {
-  return this->get_state_variable(CartesianStateVariable::TWIST);
+  this->assert_not_empty();
+  Eigen::Matrix<double, 6, 1> twist;
+  twist << this->linear_velocity_, this->angular_velocity_;
+  return twist;
 }
 
 const Eigen::Vector3d& CartesianState::get_linear_acceleration() const {
@@ -186,7 +231,10 @@ const Eigen::Vector3d& CartesianState::get_angular_acceleration() const {
 }
 
 Eigen::Matrix<double, 6, 1> CartesianState::get_acceleration() const {
-  return this->get_state_variable(CartesianStateVariable::ACCELERATION);
+  this->assert_not_empty();
+  Eigen::Matrix<double, 6, 1> acceleration;
+  acceleration << this->linear_acceleration_, this->angular_acceleration_;
+  return acceleration;
 }
 
 const Eigen::Vector3d& CartesianState::get_force() const {
@@ -200,7 +248,10 @@ const Eigen::Vector3d& CartesianState::get_torque() const {
 }
 
 Eigen::Matrix<double, 6, 1> CartesianState::get_wrench() const {
-  return this->get_state_variable(CartesianStateVariable::WRENCH);
+  this->assert_not_empty();
+  Eigen::Matrix<double, 6, 1> wrench;
+  wrench << this->force_, this->torque_;
+  return wrench;
 }
 
 Eigen::VectorXd CartesianState::data() const {
@@ -475,7 +526,7 @@ CartesianState CartesianState::copy() const {
 }
 
 double CartesianState::dist(const CartesianState& state, const CartesianStateVariable& state_variable_type) const {
-  if (!(this->get_reference_frame() == state.get_reference_frame())) {
+  if (this->get_reference_frame_id() != state.get_reference_frame_id()) {
     throw IncompatibleReferenceFramesException("The two states do not have the same reference frame");
   }
   // calculation
@@ -529,9 +580,8 @@ void CartesianState::reset() {
 CartesianState CartesianState::inverse() const {
   CartesianState inverse(*this);
   // invert name and reference frame
-  std::string ref = inverse.get_reference_frame();
-  inverse.set_reference_frame(inverse.get_name());
-  inverse.set_name(ref);
+  inverse.set_reference_frame_id(this->get_name_id());
+  inverse.set_name_id(this->get_reference_frame_id());
 
   Eigen::Quaterniond inverse_orientation = this->get_orientation().conjugate();
   Eigen::Vector3d inverse_position = inverse_orientation * (-this->get_position());
@@ -647,10 +697,10 @@ std::vector<double> CartesianState::norms(const CartesianStateVariable& state_va
 }
 
 CartesianState& CartesianState::operator*=(const CartesianState& state) {
-  if (this->get_name() != state.get_reference_frame()) {
+  if (this->get_name_id() != state.get_reference_frame_id()) {
     throw IncompatibleReferenceFramesException("Expected " + this->get_name() + ", got " + state.get_reference_frame());
   }
-  this->set_name(state.get_name());
+  this->set_name_id(state.get_name_id());
 
   // intermediate variables for f_S_b
   Eigen::Vector3d f_P_b = this->get_position();
@@ -670,28 +720,29 @@ CartesianState& CartesianState::operator*=(const CartesianState& state) {
   Eigen::Vector3d b_F_c = state.get_force();
   Eigen::Vector3d b_tau_c = state.get_torque();
   // pose
-  this->set_position(f_P_b + f_R_b * b_P_c);
+  this->position_ = f_P_b + f_R_b * b_P_c;
   auto orientation = f_R_b * b_R_c;
 
   // specific operation on quaternion using Hamilton product, keeping the resulting quaternion on the same hemisphere
-  if (orientation.dot(this->get_orientation()) < 0) {
+  if (orientation.dot(f_R_b) < 0) {
     orientation = Eigen::Quaterniond(-orientation.coeffs());
   }
-  this->set_orientation(orientation);
+  this->orientation_ = orientation.normalized();
 
   // twist
-  this->set_linear_velocity(f_v_b + f_R_b * b_v_c + f_omega_b.cross(f_R_b * b_P_c));
-  this->set_angular_velocity(f_omega_b + f_R_b * b_omega_c);
+  this->linear_velocity_ = f_v_b + f_R_b * b_v_c + f_omega_b.cross(f_R_b * b_P_c);
+  this->angular_velocity_ = f_omega_b + f_R_b * b_omega_c;
 
   // acceleration
-  this->set_linear_acceleration(
+  this->linear_acceleration_ =
       f_a_b + f_R_b * b_a_c + f_alpha_b.cross(f_R_b * b_P_c) + 2 * f_omega_b.cross(f_R_b * b_v_c)
-          + f_omega_b.cross(f_omega_b.cross(f_R_b * b_P_c)));
-  this->set_angular_acceleration(f_alpha_b + f_R_b * b_alpha_c + f_omega_b.cross(f_R_b * b_omega_c));
+          + f_omega_b.cross(f_omega_b.cross(f_R_b * b_P_c));
+  this->angular_acceleration_ = f_alpha_b + f_R_b * b_alpha_c + f_omega_b.cross(f_R_b * b_omega_c);
 
   // keep only the wrench measured at the distal frame, aligned with the new reference frame
-  this->set_force(f_R_b * b_F_c);
-  this->set_torque(f_R_b * b_tau_c);
+  this->force_ = f_R_b * b_F_c;
+  this->torque_ = f_R_b * b_tau_c;
+  this->reset_timestamp();
 
   return (*this);
 }
@@ -702,6 +753,70 @@ CartesianState CartesianState::operator*(const CartesianState& state) const {
   return result;
 }
 
+void CartesianState::transform_by_pose(
+    const CartesianState& state, const CartesianStateVariable& state_variable_type, CartesianState& result
+) const {
+  this->assert_not_empty();
+  state.assert_not_empty();
+  if (this->get_name_id() != state.get_reference_frame_id()) {
+    throw IncompatibleReferenceFramesException("Expected " + this->get_name() + ", got " + state.get_reference_frame());
+  }
+  const Eigen::Quaterniond& f_R_b = this->orientation_;
+  switch (state_variable_type) {
+    case CartesianStateVariable::POSE: {
+      Eigen::Vector3d position = this->position_ + f_R_b * state.position_;
+      Eigen::Quaterniond orientation = f_R_b * state.orientation_;
+      // keep the resulting quaternion on the same hemisphere as in the full transform
+      if (orientation.dot(f_R_b) < 0) {
+        orientation.coeffs() = -orientation.coeffs();
+      }
+      result.position_ = position;
+      result.orientation_ = orientation;
+      break;
+    }
+    case CartesianStateVariable::TWIST:
+      result.linear_velocity_ = f_R_b * state.linear_velocity_;
+      result.angular_velocity_ = f_R_b * state.angular_velocity_;
+      break;
+    case CartesianStateVariable::ACCELERATION:
+      result.linear_acceleration_ = f_R_b * state.linear_acceleration_;
+      result.angular_acceleration_ = f_R_b * state.angular_acceleration_;
+      break;
+    case CartesianStateVariable::WRENCH:
+      result.force_ = f_R_b * state.force_;
+      result.torque_ = f_R_b * state.torque_;
+      break;
+    default:
+      throw NotImplementedException("transform_by_pose is not implemented for this state variable");
+  }
+  result.set_reference_frame_id(this->get_reference_frame_id());
+  result.set_name_id(state.get_name_id());
+  result.set_empty(false);
+}
+
+void CartesianState::invert(const CartesianStateVariable& state_variable_type, CartesianState& result) const {
+  this->assert_not_empty();
+  switch (state_variable_type) {
+    case CartesianStateVariable::POSE:
+      result.orientation_ = this->orientation_.conjugate();
+      result.position_ = result.orientation_ * (-this->position_);
+      break;
+    case CartesianStateVariable::TWIST:
+      result.linear_velocity_ = -this->linear_velocity_;
+      result.angular_velocity_ = -this->angular_velocity_;
+      break;
+    case CartesianStateVariable::ACCELERATION:
+      result.linear_acceleration_ = -this->linear_acceleration_;
+      result.angular_acceleration_ = -this->angular_acceleration_;
+      break;
+    default:
+      throw NotImplementedException("invert is not implemented for this state variable");
+  }
+  result.set_name_id(this->get_reference_frame_id());
+  result.set_reference_frame_id(this->get_name_id());
+  result.set_empty(false);
+}
+
 CartesianState& CartesianState::operator*=(double lambda) {
   // operation
   this->set_position(lambda * this->get_position());
@@ -747,7 +862,7 @@ CartesianState CartesianState::operator/(double lambda) const {
 }
 
 CartesianState& CartesianState::operator+=(const CartesianState& state) {
-  if (!(this->get_reference_frame() == state.get_reference_frame())) {
+  if (this->get_reference_frame_id() != state.get_reference_frame_id()) {
     throw IncompatibleReferenceFramesException("The two states do not have the same reference frame");
   }
   // operation on pose
@@ -789,7 +904,25 @@ CartesianState CartesianState::operator-() const {
 }
 
 CartesianState& CartesianState::operator-=(const CartesianState& state) {
-  (*this) += -state;
+  state.assert_not_empty();
+  if (this->get_reference_frame_id() != state.get_reference_frame_id()) {
+    throw IncompatibleReferenceFramesException("The two states do not have the same reference frame");
+  }
+  // operation on pose
+  this->set_position(this->get_position() - state.position_);
+  // specific operation on quaternion using Hamilton product with the conjugate, keeping the resulting quaternion
+  // on the same hemisphere
+  auto orientation = this->get_orientation() * state.orientation_.conjugate();
+  if (orientation.dot(this->get_orientation()) < 0) {
+    orientation = Eigen::Quaterniond(-orientation.coeffs());
+  }
+  this->set_orientation(orientation);
+  // operation on twist
+  this->set_twist(this->get_twist() - state.get_twist());
+  // operation on acceleration
+  this->set_acceleration(this->get_acceleration() - state.get_acceleration());
+  // operation on wrench
+  this->set_wrench(this->get_wrench() - state.get_wrench());
   return (*this);
 }
 
@@ -0,0 +1,288 @@
+#include "state_representation/space/cartesian/CartesianStateArray.hpp"
+
+#include <stdexcept>
+
+#include "state_representation/exceptions/EmptyStateException.hpp"
+#include "state_representation/exceptions/IncompatibleReferenceFramesException.hpp"
+
+// the kernels run over one sample per loop iteration on contiguous coordinates, and are cloned such that the loads
+// and stores of several samples use the widest vector registers of the processor
+#if defined(__x86_64__) && defined(__linux__) && defined(__GNUC__)
+#define BATCH_KERNEL __attribute__((target_clones("avx512f", "avx2", "default")))
+#else
+#define BATCH_KERNEL
+#endif
+
+namespace {
+
+/**
+ * @brief Rotate the vectors and add an offset, v = offset + R * v
+ * @param rotation The column-major rotation matrix
+ * @param offset The offset vector
+ */
+BATCH_KERNEL void rotate_kernel(
+    const double* rotation, const double* offset, double* __restrict x, double* __restrict y, double* __restrict z,
+    Eigen::Index size
+) {
+  const double r00 = rotation[0], r10 = rotation[1], r20 = rotation[2];
+  const double r01 = rotation[3], r11 = rotation[4], r21 = rotation[5];
+  const double r02 = rotation[6], r12 = rotation[7], r22 = rotation[8];
+  const double o0 = offset[0], o1 = offset[1], o2 = offset[2];
+  for (Eigen::Index i = 0; i < size; ++i) {
+    double vx = x[i], vy = y[i], vz = z[i];
+    x[i] = o0 + r00 * vx + r01 * vy + r02 * vz;
+    y[i] = o1 + r10 * vx + r11 * vy + r12 * vz;
+    z[i] = o2 + r20 * vx + r21 * vy + r22 * vz;
+  }
+}
+
+/**
+ * @brief Transform the linear velocities, v = f_v_b + R * v + f_omega_b x (R * p), with the positions p of the samples
+ * before their transformation
+ */
+BATCH_KERNEL void linear_velocity_kernel(
+    const double* rotation, const double* linear_velocity, const double* angular_velocity, const double* __restrict px,
+    const double* __restrict py, const double* __restrict pz, double* __restrict vx, double* __restrict vy,
+    double* __restrict vz, Eigen::Index size
+) {
+  const double r00 = rotation[0], r10 = rotation[1], r20 = rotation[2];
+  const double r01 = rotation[3], r11 = rotation[4], r21 = rotation[5];
+  const double r02 = rotation[6], r12 = rotation[7], r22 = rotation[8];
+  const double v0 = linear_velocity[0], v1 = linear_velocity[1], v2 = linear_velocity[2];
+  const double w0 = angular_velocity[0], w1 = angular_velocity[1], w2 = angular_velocity[2];
+  for (Eigen::Index i = 0; i < size; ++i) {
+    double rpx = r00 * px[i] + r01 * py[i] + r02 * pz[i];
+    double rpy = r10 * px[i] + r11 * py[i] + r12 * pz[i];
+    double rpz = r20 * px[i] + r21 * py[i] + r22 * pz[i];
+    double x = vx[i], y = vy[i], z = vz[i];
+    vx[i] = v0 + r00 * x + r01 * y + r02 * z + w1 * rpz - w2 * rpy;
+    vy[i] = v1 + r10 * x + r11 * y + r12 * z + w2 * rpx - w0 * rpz;
+    vz[i] = v2 + r20 * x + r21 * y + r22 * z + w0 * rpy - w1 * rpx;
+  }
+}
+
+/**
+ * @brief Compose the orientations with the Hamilton product q = f_R_b * q, keeping the results on the hemisphere
+ * of f_R_b
+ * @param orientation The (w, x, y, z) coefficients of f_R_b
+ */
+BATCH_KERNEL void orientation_kernel(
+    const double* orientation, double* __restrict qw, double* __restrict qx, double* __restrict qy,
+    double* __restrict qz, Eigen::Index size
+) {
+  const double aw = orientation[0], ax = orientation[1], ay = orientation[2], az = orientation[3];
+  for (Eigen::Index i = 0; i < size; ++i) {
+    double bw = qw[i], bx = qx[i], by = qy[i], bz = qz[i];
+    double w = aw * bw - ax * bx - ay * by - az * bz;
+    double x = aw * bx + bw * ax + ay * bz - az * by;
+    double y = aw * by + bw * ay + az * bx - ax * bz;
+    double z = aw * bz + bw * az + ax * by - ay * bx;
+    double sign = aw * w + ax * x + ay * y + az * z < 0 ? -1. : 1.;
+    qw[i] = sign * w;
+    qx[i] = sign * x;
+    qy[i] = sign * y;
+    qz[i] = sign * z;
+  }
+}
+
+/**
+ * @brief Rotate the rows of an array of vectors and add an offset
+ */
+void rotate(
+    const Eigen::Matrix3d& rotation, const Eigen::Vector3d& offset,
+    state_representation::CartesianStateArray::Vector3Array& array
+) {
+  rotate_kernel(
+      rotation.data(), offset.data(), array.col(0).data(), array.col(1).data(), array.col(2).data(), array.rows());
+}
+}// namespace
+
+namespace state_representation {
+
+using namespace exceptions;
+
+CartesianStateArray::CartesianStateArray(const std::string& name, const std::string& reference, Eigen::Index size) :
+    name_(name),
+    reference_frame_(reference),
+    has_twists_(false),
+    has_wrenches_(false) {
+  this->resize(size);
+}
+
+void CartesianStateArray::resize(Eigen::Index size) {
+  Eigen::Index previous_size = this->size();
+  auto resize_vectors = [&](Vector3Array& array) {
+    array.conservativeResize(size, Eigen::NoChange);
+    if (size > previous_size) {
+      array.bottomRows(size - previous_size).setZero();
+    }
+  };
+  resize_vectors(this->positions_);
+  this->orientations_.conservativeResize(size, Eigen::NoChange);
+  if (size > previous_size) {
+    this->orientations_.bottomRows(size - previous_size).setZero();
+    this->orientations_.col(0).tail(size - previous_size).setOnes();
+  }
+  if (this->has_twists_) {
+    resize_vectors(this->linear_velocities_);
+    resize_vectors(this->angular_velocities_);
+  }
+  if (this->has_wrenches_) {
+    resize_vectors(this->forces_);
+    resize_vectors(this->torques_);
+  }
+}
+
+void CartesianStateArray::add_variable(const CartesianStateVariable& variable) {
+  switch (variable) {
+    case CartesianStateVariable::POSITION:
+    case CartesianStateVariable::ORIENTATION:
+    case CartesianStateVariable::POSE:
+      break;
+    case CartesianStateVariable::LINEAR_VELOCITY:
+    case CartesianStateVariable::ANGULAR_VELOCITY:
+    case CartesianStateVariable::TWIST:
+      if (!this->has_twists_) {
+        this->linear_velocities_.setZero(this->size(), 3);
+        this->angular_velocities_.setZero(this->size(), 3);
+        this->has_twists_ = true;
+      }
+      break;
+    case CartesianStateVariable::FORCE:
+    case CartesianStateVariable::TORQUE:
+    case CartesianStateVariable::WRENCH:
+      if (!this->has_wrenches_) {
+        this->forces_.setZero(this->size(), 3);
+        this->torques_.setZero(this->size(), 3);
+        this->has_wrenches_ = true;
+      }
+      break;
+    default:
+      throw InvalidStateVariableException("Only the pose, twist and wrench can be held by a Cartesian state array");
+  }
+}
+
+void CartesianStateArray::assert_size(Eigen::Index rows) const {
+  if (rows != this->size()) {
+    throw IncompatibleSizeException(
+        "Input array is of incorrect size, expected " + std::to_string(this->size()) + " rows, got "
+            + std::to_string(rows));
+  }
+}
+
+void CartesianStateArray::assert_index_in_range(Eigen::Index index) const {
+  if (index < 0 || index >= this->size()) {
+    throw std::out_of_range(
+        "Index " + std::to_string(index) + " is out of the range of the " + std::to_string(this->size()) + " samples");
+  }
+}
+
+void CartesianStateArray::set_positions(const Eigen::Ref<const Vector3Array>& positions) {
+  this->assert_size(positions.rows());
+  this->positions_ = positions;
+}
+
+void CartesianStateArray::set_orientations(const Eigen::Ref<const QuaternionArray>& orientations) {
+  this->assert_size(orientations.rows());
+  this->orientations_ = orientations;
+  this->orientations_.rowwise().normalize();
+}
+
+void CartesianStateArray::set_linear_velocities(const Eigen::Ref<const Vector3Array>& linear_velocities) {
+  this->assert_size(linear_velocities.rows());
+  this->add_variable(CartesianStateVariable::TWIST);
+  this->linear_velocities_ = linear_velocities;
+}
+
+void CartesianStateArray::set_angular_velocities(const Eigen::Ref<const Vector3Array>& angular_velocities) {
+  this->assert_size(angular_velocities.rows());
+  this->add_variable(CartesianStateVariable::TWIST);
+  this->angular_velocities_ = angular_velocities;
+}
+
+void CartesianStateArray::set_forces(const Eigen::Ref<const Vector3Array>& forces) {
+  this->assert_size(forces.rows());
+  this->add_variable(CartesianStateVariable::WRENCH);
+  this->forces_ = forces;
+}
+
+void CartesianStateArray::set_torques(const Eigen::Ref<const Vector3Array>& torques) {
+  this->assert_size(torques.rows());
+  this->add_variable(CartesianStateVariable::WRENCH);
+  this->torques_ = torques;
+}
+
+CartesianState CartesianStateArray::get_state(Eigen::Index index) const {
+  this->assert_index_in_range(index);
+  CartesianState state(this->get_name(), this->get_reference_frame());
+  state.set_position(this->positions_.row(index).transpose());
+  state.set_orientation(Eigen::Vector4d(this->orientations_.row(index).transpose()));
+  if (this->has_twists_) {
+    state.set_linear_velocity(this->linear_velocities_.row(index).transpose());
+    state.set_angular_velocity(this->angular_velocities_.row(index).transpose());
+  }
+  if (this->has_wrenches_) {
+    state.set_force(this->forces_.row(index).transpose());
+    state.set_torque(this->torques_.row(index).transpose());
+  }
+  return state;
+}
+
+void CartesianStateArray::set_state(Eigen::Index index, const CartesianState& state) {
+  this->assert_index_in_range(index);
+  if (state.is_empty()) {
+    throw EmptyStateException(state.get_name() + " state is empty");
+  }
+  if (state.get_reference_frame_id() != this->reference_frame_.get_id()) {
+    throw IncompatibleReferenceFramesException(
+        "Expected " + this->get_reference_frame() + ", got " + state.get_reference_frame());
+  }
+  this->positions_.row(index) = state.get_position().transpose();
+  this->orientations_.row(index) = state.get_orientation_coefficients().transpose();
+  if (this->has_twists_) {
+    this->linear_velocities_.row(index) = state.get_linear_velocity().transpose();
+    this->angular_velocities_.row(index) = state.get_angular_velocity().transpose();
+  }
+  if (this->has_wrenches_) {
+    this->forces_.row(index) = state.get_force().transpose();
+    this->torques_.row(index) = state.get_torque().transpose();
+  }
+}
+
+void CartesianStateArray::transform(const CartesianState& state) {
+  if (state.is_empty()) {
+    throw EmptyStateException(state.get_name() + " state is empty");
+  }
+  if (state.get_name_id() != this->reference_frame_.get_id()) {
+    throw IncompatibleReferenceFramesException("Expected " + this->get_reference_frame() + ", got " + state.get_name());
+  }
+  this->reference_frame_.set_id(state.get_reference_frame_id());
+
+  const Eigen::Matrix3d rotation = state.get_orientation().toRotationMatrix();
+  const Eigen::Quaterniond& quaternion = state.get_orientation();
+  const Eigen::Vector4d orientation(quaternion.w(), quaternion.x(), quaternion.y(), quaternion.z());
+  // the twist depends on the positions of the samples before their transformation
+  if (this->has_twists_) {
+    linear_velocity_kernel(
+        rotation.data(), state.get_linear_velocity().data(), state.get_angular_velocity().data(),
+        this->positions_.col(0).data(), this->positions_.col(1).data(), this->positions_.col(2).data(),
+        this->linear_velocities_.col(0).data(), this->linear_velocities_.col(1).data(),
+        this->linear_velocities_.col(2).data(), this->size());
+    rotate(rotation, state.get_angular_velocity(), this->angular_velocities_);
+  }
+  if (this->has_wrenches_) {
+    rotate(rotation, Eigen::Vector3d::Zero(), this->forces_);
+    rotate(rotation, Eigen::Vector3d::Zero(), this->torques_);
+  }
+  rotate(rotation, state.get_position(), this->positions_);
+  orientation_kernel(
+      orientation.data(), this->orientations_.col(0).data(), this->orientations_.col(1).data(),
+      this->orientations_.col(2).data(), this->orientations_.col(3).data(), this->size());
+}
+
+CartesianStateArray operator*(const CartesianState& state, const CartesianStateArray& array) {
+  CartesianStateArray result(array);
+  result.transform(state);
+  return result;
+}
+}// namespace state_representation
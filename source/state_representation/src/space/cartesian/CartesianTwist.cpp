@@ -49,6 +49,10 @@ CartesianTwist::CartesianTwist(const CartesianState& state) : CartesianState(sta
 CartesianTwist::CartesianTwist(const CartesianTwist& twist) :
     CartesianTwist(static_cast<const CartesianState&>(twist)) {}
 
+CartesianTwist::CartesianTwist(CartesianTwist&& twist) noexcept : CartesianState(std::move(twist)) {
+  this->set_type(StateType::CARTESIAN_TWIST);
+}
+
 CartesianTwist::CartesianTwist(const CartesianPose& pose) : CartesianTwist(pose.differentiate(1.0)) {}
 
 CartesianTwist::CartesianTwist(const CartesianAcceleration& acceleration) :
@@ -142,7 +146,9 @@ CartesianPose CartesianTwist::integrate(const std::chrono::nanoseconds& dt, cons
 }
 
 CartesianTwist CartesianTwist::inverse() const {
-  return this->CartesianState::inverse();
+  CartesianTwist result;
+  this->invert(CartesianStateVariable::TWIST, result);
+  return result;
 }
 
 CartesianTwist CartesianTwist::normalized(const CartesianStateVariable& state_variable_type) const {
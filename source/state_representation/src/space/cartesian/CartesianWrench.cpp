@@ -46,6 +46,10 @@ CartesianWrench::CartesianWrench(const CartesianState& state) : CartesianState(s
 CartesianWrench::CartesianWrench(const CartesianWrench& wrench) :
     CartesianWrench(static_cast<const CartesianState&>(wrench)) {}
 
+CartesianWrench::CartesianWrench(CartesianWrench&& wrench) noexcept : CartesianState(std::move(wrench)) {
+  this->set_type(StateType::CARTESIAN_WRENCH);
+}
+
 CartesianWrench CartesianWrench::Zero(const std::string& name, const std::string& reference) {
   return CartesianState::Identity(name, reference);
 }
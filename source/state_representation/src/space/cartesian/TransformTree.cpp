@@ -0,0 +1,428 @@
+#include "state_representation/space/cartesian/TransformTree.hpp"
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <stdexcept>
+
+#include "state_representation/exceptions/EmptyStateException.hpp"
+#include "state_representation/exceptions/ExtrapolationException.hpp"
+#include "state_representation/exceptions/IncompatibleReferenceFramesException.hpp"
+#include "state_representation/exceptions/IncompatibleSizeException.hpp"
+#include "state_representation/exceptions/IncompatibleStatesException.hpp"
+
+namespace state_representation {
+
+using namespace exceptions;
+
+namespace {
+
+constexpr std::uint32_t NO_PARENT = std::numeric_limits<std::uint32_t>::max();
+
+std::uint64_t hash(std::uint64_t key) {
+  return (key * 0x9E3779B97F4A7C15ull) >> 32;
+}
+
+std::int64_t to_nanoseconds(const std::chrono::steady_clock::time_point& time) {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(time.time_since_epoch()).count();
+}
+}// namespace
+
+// the poses and the cached paths are sequence locked: the writer makes the sequence odd while it writes and the
+// readers retry or give up when the sequence changed while they read, all the data being atomic to avoid data races
+struct TransformTree::Node {
+  struct Slot {
+    std::atomic<std::uint64_t> sequence{0};
+    std::atomic<std::int64_t> time{0};
+    std::array<std::atomic<double>, 7> pose{};///< position and (w, x, y, z) orientation coefficients
+  };
+
+  /**
+   * @brief Write the next pose, the k-th pose written going to the slot k modulo the buffer size with sequence 2k + 2
+   */
+  void write(
+      std::size_t buffer_size, std::int64_t time, const Eigen::Vector3d& position, const Eigen::Quaterniond& orientation
+  ) {
+    auto k = this->count.load(std::memory_order_relaxed);
+    auto& slot = this->slots[k % buffer_size];
+    slot.sequence.store(2 * k + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.time.store(time, std::memory_order_relaxed);
+    const std::array<double, 7> pose = {
+        position.x(), position.y(), position.z(), orientation.w(), orientation.x(), orientation.y(), orientation.z()
+    };
+    for (std::size_t i = 0; i < pose.size(); ++i) {
+      slot.pose[i].store(pose[i], std::memory_order_relaxed);
+    }
+    slot.sequence.store(2 * k + 2, std::memory_order_release);
+    this->count.store(k + 1, std::memory_order_release);
+  }
+
+  /**
+   * @brief Read the k-th pose written
+   * @return False if the pose was overwritten by a newer one before or while it was read
+   */
+  bool read(std::size_t buffer_size, std::uint64_t k, std::int64_t& time, std::array<double, 7>& pose) const {
+    const auto& slot = this->slots[k % buffer_size];
+    auto sequence = slot.sequence.load(std::memory_order_acquire);
+    if (sequence != 2 * k + 2) {
+      return false;
+    }
+    time = slot.time.load(std::memory_order_relaxed);
+    for (std::size_t i = 0; i < pose.size(); ++i) {
+      pose[i] = slot.pose[i].load(std::memory_order_relaxed);
+    }
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return slot.sequence.load(std::memory_order_relaxed) == sequence;
+  }
+
+  /**
+   * @brief Get the time of the last pose written, which is only called by the writer holding the lock such that the
+   * pose cannot be overwritten while it is read
+   */
+  std::int64_t get_last_time(std::size_t buffer_size) const {
+    auto k = this->count.load(std::memory_order_relaxed);
+    return this->slots[(k - 1) % buffer_size].time.load(std::memory_order_relaxed);
+  }
+
+  FrameReference frame;                        ///< frame of the node, set before the node is published
+  std::atomic<std::uint32_t> parent{NO_PARENT};///< index of the parent node, set once after the first pose
+  std::atomic<std::uint64_t> count{0};         ///< number of poses written
+  std::unique_ptr<Slot[]> slots;               ///< ring buffer of poses, allocated before the node is published
+};
+
+struct TransformTree::CachedPath {
+  std::atomic<std::uint64_t> sequence{0};
+  std::atomic<std::uint64_t> key{0};
+  std::atomic<std::uint32_t> up_size{0};
+  std::atomic<std::uint32_t> down_size{0};
+  std::array<std::atomic<std::uint32_t>, 2 * MAX_DEPTH> nodes{};
+};
+
+// the path from a frame to a reference frame goes up from the frame to the child of their common ancestor, then down
+// from there to the reference frame, which is stored from the reference frame up as well
+struct TransformTree::Path {
+  std::array<std::uint32_t, MAX_DEPTH> up;
+  std::size_t up_size = 0;
+  std::array<std::uint32_t, MAX_DEPTH> down;
+  std::size_t down_size = 0;
+};
+
+TransformTree::TransformTree(std::size_t max_frames, std::size_t buffer_size, std::size_t cache_size) :
+    max_frames_(max_frames), buffer_size_(buffer_size), cache_size_(cache_size), size_(0) {
+  if (max_frames == 0 || max_frames >= NO_PARENT || buffer_size == 0) {
+    throw IncompatibleSizeException("The maximum number of frames and the buffer size of the tree must be positive");
+  }
+  // the table has at least twice as many entries as frames such that the probes always end on an empty entry
+  std::size_t table_size = 1;
+  while (table_size < 2 * max_frames) {
+    table_size *= 2;
+  }
+  this->table_mask_ = table_size - 1;
+  this->nodes_ = std::make_unique<Node[]>(max_frames);
+  this->table_ = std::make_unique<std::atomic<std::uint64_t>[]>(table_size);
+  for (std::size_t i = 0; i < table_size; ++i) {
+    this->table_[i].store(0, std::memory_order_relaxed);
+  }
+  if (cache_size > 0) {
+    this->cache_ = std::make_unique<CachedPath[]>(cache_size);
+  }
+}
+
+TransformTree::~TransformTree() = default;
+
+std::size_t TransformTree::find_node(FrameId frame) const {
+  if (frame == FrameRegistry::EMPTY || frame == FrameRegistry::UNKNOWN) {
+    return this->max_frames_;
+  }
+  for (auto i = hash(frame) & this->table_mask_;; i = (i + 1) & this->table_mask_) {
+    auto entry = this->table_[i].load(std::memory_order_acquire);
+    if (entry == 0) {
+      return this->max_frames_;
+    }
+    if ((entry >> 32) == frame) {
+      return entry & 0xFFFFFFFF;
+    }
+  }
+}
+
+std::size_t TransformTree::add_node(FrameId frame) {
+  auto index = this->size_.load(std::memory_order_relaxed);
+  auto& node = this->nodes_[index];
+  node.frame.set_id(frame);
+  node.slots = std::make_unique<Node::Slot[]>(this->buffer_size_);
+  auto i = hash(frame) & this->table_mask_;
+  while (this->table_[i].load(std::memory_order_relaxed) != 0) {
+    i = (i + 1) & this->table_mask_;
+  }
+  this->table_[i].store((static_cast<std::uint64_t>(frame) << 32) | index, std::memory_order_release);
+  this->size_.store(index + 1, std::memory_order_release);
+  return index;
+}
+
+bool TransformTree::has_frame(const std::string& frame) const {
+  return this->find_node(FrameRegistry::find_id(frame)) < this->max_frames_;
+}
+
+void TransformTree::set_transform(const CartesianPose& pose) {
+  this->set_transform(pose, pose.get_timestamp());
+}
+
+void TransformTree::set_transform(const CartesianPose& pose, const std::chrono::steady_clock::time_point& time) {
+  if (pose.is_empty()) {
+    throw EmptyStateException(pose.get_name() + " state is empty");
+  }
+  auto frame = pose.get_name_id();
+  auto parent = pose.get_reference_frame_id();
+  if (frame == FrameRegistry::EMPTY || parent == FrameRegistry::EMPTY) {
+    throw IncompatibleReferenceFramesException("The pose of an unnamed frame cannot be added to the tree");
+  }
+  if (frame == parent) {
+    throw IncompatibleReferenceFramesException("The pose of " + pose.get_name() + " is expressed in its own frame");
+  }
+  auto nanoseconds = to_nanoseconds(time);
+
+  std::lock_guard<std::mutex> lock(this->mutex_);
+  auto node_index = this->find_node(frame);
+  auto parent_index = this->find_node(parent);
+  auto current_parent = node_index < this->max_frames_
+                        ? this->nodes_[node_index].parent.load(std::memory_order_relaxed) : NO_PARENT;
+  if (current_parent != NO_PARENT) {
+    auto& node = this->nodes_[node_index];
+    if (current_parent != parent_index) {
+      throw IncompatibleReferenceFramesException(
+          "The frame " + pose.get_name() + " is already a child of "
+              + this->nodes_[current_parent].frame.get_name());
+    }
+    if (nanoseconds < node.get_last_time(this->buffer_size_)) {
+      throw IncompatibleStatesException(
+          "The pose of " + pose.get_name() + " is older than the last pose of the frame in the tree");
+    }
+    node.write(this->buffer_size_, nanoseconds, pose.get_position(), pose.get_orientation());
+    return;
+  }
+
+  // the frame gets a parent, checking that this keeps a tree within the capacity and depth limits
+  std::size_t new_nodes = (node_index == this->max_frames_) + (parent_index == this->max_frames_);
+  if (this->size_.load(std::memory_order_relaxed) + new_nodes > this->max_frames_) {
+    throw std::length_error("The tree cannot hold more than " + std::to_string(this->max_frames_) + " frames");
+  }
+  std::size_t parent_depth = 0;
+  if (parent_index < this->max_frames_) {
+    for (auto i = this->nodes_[parent_index].parent.load(std::memory_order_relaxed); i != NO_PARENT;
+         i = this->nodes_[i].parent.load(std::memory_order_relaxed)) {
+      ++parent_depth;
+    }
+  }
+  for (std::size_t i = 0; node_index < this->max_frames_ && i < this->size_.load(std::memory_order_relaxed); ++i) {
+    // depth of each node below the frame, which includes the parent itself if the parent is a descendant
+    std::size_t depth = 0;
+    auto j = static_cast<std::uint32_t>(i);
+    while (j != node_index && j != NO_PARENT) {
+      j = this->nodes_[j].parent.load(std::memory_order_relaxed);
+      ++depth;
+    }
+    if (j == NO_PARENT) {
+      continue;
+    }
+    if (i == parent_index) {
+      throw IncompatibleReferenceFramesException(
+          "The frame " + pose.get_reference_frame() + " cannot be the parent of its ancestor " + pose.get_name());
+    }
+    if (depth + parent_depth + 1 > MAX_DEPTH) {
+      throw std::length_error("The tree cannot be deeper than " + std::to_string(MAX_DEPTH) + " frames");
+    }
+  }
+  if (parent_depth + 1 > MAX_DEPTH) {
+    throw std::length_error("The tree cannot be deeper than " + std::to_string(MAX_DEPTH) + " frames");
+  }
+  if (node_index == this->max_frames_) {
+    node_index = this->add_node(frame);
+  }
+  if (parent_index == this->max_frames_) {
+    parent_index = this->add_node(parent);
+  }
+  auto& node = this->nodes_[node_index];
+  node.write(this->buffer_size_, nanoseconds, pose.get_position(), pose.get_orientation());
+  // publishing the parent after the first pose guarantees that the readers find a pose on each edge
+  node.parent.store(static_cast<std::uint32_t>(parent_index), std::memory_order_release);
+}
+
+bool TransformTree::find_path(FrameId frame, FrameId reference_frame, Path& path) const {
+  auto key = (static_cast<std::uint64_t>(frame) << 32) | reference_frame;
+  CachedPath* cached = this->cache_size_ > 0 ? &this->cache_[hash(key) % this->cache_size_] : nullptr;
+  std::uint64_t sequence = 1;
+  if (cached != nullptr) {
+    sequence = cached->sequence.load(std::memory_order_acquire);
+    if (!(sequence & 1) && cached->key.load(std::memory_order_relaxed) == key) {
+      path.up_size = std::min<std::size_t>(cached->up_size.load(std::memory_order_relaxed), MAX_DEPTH);
+      path.down_size = std::min<std::size_t>(cached->down_size.load(std::memory_order_relaxed), MAX_DEPTH);
+      for (std::size_t i = 0; i < path.up_size; ++i) {
+        path.up[i] = cached->nodes[i].load(std::memory_order_relaxed);
+      }
+      for (std::size_t i = 0; i < path.down_size; ++i) {
+        path.down[i] = cached->nodes[MAX_DEPTH + i].load(std::memory_order_relaxed);
+      }
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (cached->sequence.load(std::memory_order_relaxed) == sequence) {
+        return true;
+      }
+    }
+  }
+
+  auto node_index = this->find_node(frame);
+  auto reference_index = this->find_node(reference_frame);
+  if (node_index == this->max_frames_ || reference_index == this->max_frames_) {
+    return false;
+  }
+  // walk both frames up to their root and drop the common part of the chains
+  std::array<std::uint32_t, MAX_DEPTH + 1> up_chain{}, down_chain{};
+  std::size_t up_size = 0, down_size = 0;
+  for (auto i = static_cast<std::uint32_t>(node_index); i != NO_PARENT && up_size <= MAX_DEPTH;
+       i = this->nodes_[i].parent.load(std::memory_order_acquire)) {
+    up_chain[up_size++] = i;
+  }
+  for (auto i = static_cast<std::uint32_t>(reference_index); i != NO_PARENT && down_size <= MAX_DEPTH;
+       i = this->nodes_[i].parent.load(std::memory_order_acquire)) {
+    down_chain[down_size++] = i;
+  }
+  if (up_chain[up_size - 1] != down_chain[down_size - 1]) {
+    return false;
+  }
+  while (up_size > 0 && down_size > 0 && up_chain[up_size - 1] == down_chain[down_size - 1]) {
+    --up_size;
+    --down_size;
+  }
+  std::copy(up_chain.begin(), up_chain.begin() + up_size, path.up.begin());
+  std::copy(down_chain.begin(), down_chain.begin() + down_size, path.down.begin());
+  path.up_size = up_size;
+  path.down_size = down_size;
+
+  // paths never change once the frames are connected, such that any reader can cache them unless another one is
+  // writing the same entry
+  if (cached != nullptr && !(sequence & 1)
+      && cached->sequence.compare_exchange_strong(sequence, sequence + 1, std::memory_order_relaxed)) {
+    std::atomic_thread_fence(std::memory_order_release);
+    cached->key.store(key, std::memory_order_relaxed);
+    cached->up_size.store(static_cast<std::uint32_t>(up_size), std::memory_order_relaxed);
+    cached->down_size.store(static_cast<std::uint32_t>(down_size), std::memory_order_relaxed);
+    for (std::size_t i = 0; i < up_size; ++i) {
+      cached->nodes[i].store(path.up[i], std::memory_order_relaxed);
+    }
+    for (std::size_t i = 0; i < down_size; ++i) {
+      cached->nodes[MAX_DEPTH + i].store(path.down[i], std::memory_order_relaxed);
+    }
+    cached->sequence.store(sequence + 2, std::memory_order_release);
+  }
+  return true;
+}
+
+void TransformTree::interpolate(
+    const Node& node, std::int64_t time, Eigen::Vector3d& position, Eigen::Quaterniond& orientation
+) const {
+  std::int64_t first_time, second_time;
+  std::array<double, 7> first{}, second{};
+  while (true) {
+    auto count = node.count.load(std::memory_order_acquire);
+    auto oldest = count > this->buffer_size_ ? count - this->buffer_size_ : 0;
+    // the newest pose is used for any time after it, then the poses around the time are searched by bisection,
+    // starting over if a pose gets overwritten by the writer in the meantime
+    if (!node.read(this->buffer_size_, count - 1, second_time, second)) {
+      continue;
+    }
+    if (time >= second_time) {
+      position = Eigen::Vector3d(second[0], second[1], second[2]);
+      orientation = Eigen::Quaterniond(second[3], second[4], second[5], second[6]);
+      return;
+    }
+    if (!node.read(this->buffer_size_, oldest, first_time, first)) {
+      continue;
+    }
+    if (time < first_time) {
+      throw ExtrapolationException(
+          "The requested time is before the oldest pose of " + node.frame.get_name() + " in the tree");
+    }
+    auto lower = oldest, upper = count - 1;
+    bool overwritten = false;
+    while (upper - lower > 1) {
+      auto middle = lower + (upper - lower) / 2;
+      std::int64_t middle_time;
+      std::array<double, 7> middle_pose{};
+      if (!node.read(this->buffer_size_, middle, middle_time, middle_pose)) {
+        overwritten = true;
+        break;
+      }
+      if (middle_time <= time) {
+        lower = middle;
+        first_time = middle_time;
+        first = middle_pose;
+      } else {
+        upper = middle;
+        second_time = middle_time;
+        second = middle_pose;
+      }
+    }
+    if (overwritten) {
+      continue;
+    }
+    double t = static_cast<double>(time - first_time) / static_cast<double>(second_time - first_time);
+    position = (1 - t) * Eigen::Vector3d(first[0], first[1], first[2])
+        + t * Eigen::Vector3d(second[0], second[1], second[2]);
+    orientation = Eigen::Quaterniond(first[3], first[4], first[5], first[6]).slerp(
+        t, Eigen::Quaterniond(second[3], second[4], second[5], second[6]));
+    return;
+  }
+}
+
+CartesianPose TransformTree::get_transform(const std::string& frame, const std::string& reference_frame) const {
+  return this->get_transform(frame, reference_frame, std::chrono::steady_clock::time_point::max());
+}
+
+CartesianPose TransformTree::get_transform(
+    const std::string& frame, const std::string& reference_frame, const std::chrono::steady_clock::time_point& time
+) const {
+  // the frames are looked up without registering them, such that unknown frames are not added to the registry
+  auto frame_id = FrameRegistry::find_id(frame);
+  auto reference_frame_id = FrameRegistry::find_id(reference_frame);
+  if (this->find_node(frame_id) == this->max_frames_ || this->find_node(reference_frame_id) == this->max_frames_) {
+    throw IncompatibleReferenceFramesException(
+        "The frames " + frame + " and " + reference_frame + " are not connected in the tree");
+  }
+  CartesianPose result;
+  this->get_transform(frame_id, reference_frame_id, time, result);
+  return result;
+}
+
+void TransformTree::get_transform(
+    FrameId frame, FrameId reference_frame, const std::chrono::steady_clock::time_point& time, CartesianPose& result
+) const {
+  Path path;
+  if (!this->find_path(frame, reference_frame, path)) {
+    throw IncompatibleReferenceFramesException(
+        "The frames " + FrameRegistry::get_name(frame) + " and " + FrameRegistry::get_name(reference_frame)
+            + " are not connected in the tree");
+  }
+  auto nanoseconds = to_nanoseconds(time);
+  // compose the poses of both chains with respect to the common ancestor, from the top down
+  Eigen::Vector3d up_position = Eigen::Vector3d::Zero(), down_position = Eigen::Vector3d::Zero(), position;
+  Eigen::Quaterniond up_orientation = Eigen::Quaterniond::Identity(),
+      down_orientation = Eigen::Quaterniond::Identity(), orientation;
+  for (auto i = path.up_size; i > 0; --i) {
+    this->interpolate(this->nodes_[path.up[i - 1]], nanoseconds, position, orientation);
+    up_position += up_orientation * position;
+    up_orientation *= orientation;
+  }
+  for (auto i = path.down_size; i > 0; --i) {
+    this->interpolate(this->nodes_[path.down[i - 1]], nanoseconds, position, orientation);
+    down_position += down_orientation * position;
+    down_orientation *= orientation;
+  }
+  CartesianState& state = result;
+  auto inverse_orientation = down_orientation.conjugate();
+  state.get_variable_map(CartesianStateVariable::POSITION) = inverse_orientation * (up_position - down_position);
+  state.set_orientation(inverse_orientation * up_orientation);
+  state.set_name_id(frame);
+  state.set_reference_frame_id(reference_frame);
+  state.set_empty(false);
+}
+}// namespace state_representation
@@ -43,6 +43,10 @@ JointAccelerations::JointAccelerations(const JointState& state) : JointState(sta
 JointAccelerations::JointAccelerations(const JointAccelerations& accelerations) :
     JointAccelerations(static_cast<const JointState&>(accelerations)) {}
 
+JointAccelerations::JointAccelerations(JointAccelerations&& accelerations) noexcept : JointState(std::move(accelerations)) {
+  this->set_type(StateType::JOINT_ACCELERATIONS);
+}
+
 JointAccelerations::JointAccelerations(const JointVelocities& velocities) :
     JointAccelerations(velocities.differentiate(1.0)) {}
 
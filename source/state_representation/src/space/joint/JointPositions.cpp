@@ -44,6 +44,10 @@ JointPositions::JointPositions(const JointState& state) : JointState(state) {
 JointPositions::JointPositions(const JointPositions& positions) :
     JointPositions(static_cast<const JointState&>(positions)) {}
 
+JointPositions::JointPositions(JointPositions&& positions) noexcept : JointState(std::move(positions)) {
+  this->set_type(StateType::JOINT_POSITIONS);
+}
+
 JointPositions::JointPositions(const JointVelocities& velocities) : JointPositions(velocities.integrate(1.0)) {}
 
 JointPositions JointPositions::Zero(const std::string& robot_name, unsigned int nb_joints) {
@@ -30,6 +30,16 @@ static unsigned int get_state_variable_size_factor(const JointStateVariable& sta
   }
 }
 
+static void assert_state_variable_size(
+    std::size_t size, const JointStateVariable& state_variable_type, unsigned int nb_joints
+) {
+  auto expected_size = get_state_variable_size_factor(state_variable_type) * nb_joints;
+  if (size != expected_size) {
+    throw exceptions::IncompatibleSizeException(
+        "Input is of incorrect size, expected " + std::to_string(expected_size) + ", got " + std::to_string(size));
+  }
+}
+
 JointState::JointState() : State() {
   this->set_type(StateType::JOINT_STATE);
 }
@@ -37,10 +47,7 @@ JointState::JointState() : State() {
 JointState::JointState(const std::string& robot_name, unsigned int nb_joints) :
     State(robot_name),
     names_(nb_joints),
-    positions_(Eigen::VectorXd::Zero(nb_joints)),
-    velocities_(Eigen::VectorXd::Zero(nb_joints)),
-    accelerations_(Eigen::VectorXd::Zero(nb_joints)),
-    torques_(Eigen::VectorXd::Zero(nb_joints)) {
+    data_(Eigen::VectorXd::Zero(4 * nb_joints)) {
   this->set_type(StateType::JOINT_STATE);
   this->set_names(nb_joints);
 }
@@ -50,9 +57,13 @@ JointState::JointState(const std::string& robot_name, const std::vector<std::str
   this->set_names(joint_names);
 }
 
-JointState::JointState(const JointState& state) : JointState(state.get_name(), state.names_) {
+JointState::JointState(const JointState& state) : State(state.get_name()), names_(state.names_) {
+  this->set_type(StateType::JOINT_STATE);
   if (state) {
-    this->set_state_variable(state.get_state_variable(JointStateVariable::ALL), JointStateVariable::ALL);
+    this->data_ = state.data_;
+    this->set_empty(false);
+  } else {
+    this->data_ = Eigen::VectorXd::Zero(state.data_.size());
   }
 }
 
@@ -85,30 +96,38 @@ JointState JointState::Random(const std::string& robot_name, const std::vector<s
 }
 
 JointState& JointState::operator=(const JointState& state) {
-  JointState tmp(state);
-  swap(*this, tmp);
+  // assign the members in place to reuse the storage of the names and variables when the sizes match
+  State::operator=(state);
+  this->names_ = state.names_;
+  if (state) {
+    this->data_ = state.data_;
+  } else {
+    this->data_.setZero(state.data_.size());
+  }
+  this->set_empty(state.is_empty());
+  return *this;
+}
+
+JointState::JointState(JointState&& state) noexcept :
+    State(std::move(state)), names_(std::move(state.names_)), data_(std::move(state.data_)) {
+  this->set_type(StateType::JOINT_STATE);
+}
+
+JointState& JointState::operator=(JointState&& state) noexcept {
+  if (this == &state) {
+    return *this;
+  }
+  State::operator=(std::move(state));
+  this->names_ = std::move(state.names_);
+  this->data_ = std::move(state.data_);
+  // the previous buffer of this state is swapped into the moved-from state, release it to match its empty names
+  state.data_.resize(0);
   return *this;
 }
 
 Eigen::VectorXd JointState::get_state_variable(const JointStateVariable& state_variable_type) const {
   this->assert_not_empty();
-  switch (state_variable_type) {
-    case JointStateVariable::POSITIONS:
-      return this->positions_;
-    case JointStateVariable::VELOCITIES:
-      return this->velocities_;
-    case JointStateVariable::ACCELERATIONS:
-      return this->accelerations_;
-    case JointStateVariable::TORQUES:
-      return this->torques_;
-    case JointStateVariable::ALL: {
-      Eigen::VectorXd all_fields(this->get_size() * 4);
-      all_fields << this->positions_, this->velocities_, this->accelerations_, this->torques_;
-      return all_fields;
-    }
-    default:
-      return {};
-  }
+  return this->get_variable_map(state_variable_type);
 }
 
 unsigned int JointState::get_size() const {
@@ -127,64 +146,84 @@ unsigned int JointState::get_joint_index(const std::string& joint_name) const {
   return std::distance(this->names_.begin(), finder);
 }
 
-const Eigen::VectorXd& JointState::get_positions() const {
+Eigen::VectorXd JointState::get_positions() const {
   this->assert_not_empty();
-  return this->positions_;
+  return this->get_variable_map(JointStateVariable::POSITIONS);
+}
+
+Eigen::Map<const Eigen::VectorXd> JointState::get_positions_view() const& {
+  this->assert_not_empty();
+  return this->get_variable_map(JointStateVariable::POSITIONS);
 }
 
 double JointState::get_position(const std::string& joint_name) const {
-  return this->positions_(this->get_joint_index(joint_name));
+  return this->get_variable_map(JointStateVariable::POSITIONS)(this->get_joint_index(joint_name));
 }
 
 double JointState::get_position(unsigned int joint_index) const {
   this->assert_not_empty();
   assert_index_in_range(joint_index, this->get_size());
-  return this->positions_(joint_index);
+  return this->get_variable_map(JointStateVariable::POSITIONS)(joint_index);
+}
+
+Eigen::VectorXd JointState::get_velocities() const {
+  this->assert_not_empty();
+  return this->get_variable_map(JointStateVariable::VELOCITIES);
 }
 
-const Eigen::VectorXd& JointState::get_velocities() const {
+Eigen::Map<const Eigen::VectorXd> JointState::get_velocities_view() const& {
   this->assert_not_empty();
-  return this->velocities_;
+  return this->get_variable_map(JointStateVariable::VELOCITIES);
 }
 
 double JointState::get_velocity(const std::string& joint_name) const {
-  return this->velocities_(this->get_joint_index(joint_name));
+  return this->get_variable_map(JointStateVariable::VELOCITIES)(this->get_joint_index(joint_name));
 }
 
 double JointState::get_velocity(unsigned int joint_index) const {
   this->assert_not_empty();
   assert_index_in_range(joint_index, this->get_size());
-  return this->velocities_(joint_index);
+  return this->get_variable_map(JointStateVariable::VELOCITIES)(joint_index);
+}
+
+Eigen::VectorXd JointState::get_accelerations() const {
+  this->assert_not_empty();
+  return this->get_variable_map(JointStateVariable::ACCELERATIONS);
 }
 
-const Eigen::VectorXd& JointState::get_accelerations() const {
+Eigen::Map<const Eigen::VectorXd> JointState::get_accelerations_view() const& {
   this->assert_not_empty();
-  return this->accelerations_;
+  return this->get_variable_map(JointStateVariable::ACCELERATIONS);
 }
 
 double JointState::get_acceleration(const std::string& joint_name) const {
-  return this->accelerations_(this->get_joint_index(joint_name));
+  return this->get_variable_map(JointStateVariable::ACCELERATIONS)(this->get_joint_index(joint_name));
 }
 
 double JointState::get_acceleration(unsigned int joint_index) const {
   this->assert_not_empty();
   assert_index_in_range(joint_index, this->get_size());
-  return this->accelerations_(joint_index);
+  return this->get_variable_map(JointStateVariable::ACCELERATIONS)(joint_index);
+}
+
+Eigen::VectorXd JointState::get_torques() const {
+  this->assert_not_empty();
+  return this->get_variable_map(JointStateVariable::TORQUES);
 }
 
-const Eigen::VectorXd& JointState::get_torques() const {
+Eigen::Map<const Eigen::VectorXd> JointState::get_torques_view() const& {
   this->assert_not_empty();
-  return this->torques_;
+  return this->get_variable_map(JointStateVariable::TORQUES);
 }
 
 double JointState::get_torque(const std::string& joint_name) const {
-  return this->torques_(this->get_joint_index(joint_name));
+  return this->get_variable_map(JointStateVariable::TORQUES)(this->get_joint_index(joint_name));
 }
 
 double JointState::get_torque(unsigned int joint_index) const {
   this->assert_not_empty();
   assert_index_in_range(joint_index, this->get_size());
-  return this->torques_(joint_index);
+  return this->get_variable_map(JointStateVariable::TORQUES)(joint_index);
 }
 
 Eigen::VectorXd JointState::data() const {
@@ -198,38 +237,14 @@ Eigen::ArrayXd JointState::array() const {
 void JointState::set_state_variable(
     const std::vector<double>& new_value, const JointStateVariable& state_variable_type
 ) {
-  this->set_state_variable(Eigen::VectorXd::Map(new_value.data(), new_value.size()), state_variable_type);
+  assert_state_variable_size(new_value.size(), state_variable_type, this->get_size());
+  this->get_variable_map(state_variable_type) = Eigen::VectorXd::Map(new_value.data(), new_value.size());
+  this->set_empty(false);
 }
 
 void JointState::set_state_variable(const Eigen::VectorXd& new_value, const JointStateVariable& state_variable_type) {
-  auto expected_size = get_state_variable_size_factor(state_variable_type) * this->get_size();
-  if (new_value.size() != expected_size) {
-    throw exceptions::IncompatibleSizeException(
-        "Input is of incorrect size, expected " + std::to_string(expected_size) + ", got "
-            + std::to_string(new_value.size()));
-  }
-  switch (state_variable_type) {
-    case JointStateVariable::POSITIONS:
-      this->positions_ = new_value;
-      break;
-    case JointStateVariable::VELOCITIES:
-      this->velocities_ = new_value;
-      break;
-    case JointStateVariable::ACCELERATIONS:
-      this->accelerations_ = new_value;
-      break;
-    case JointStateVariable::TORQUES:
-      this->torques_ = new_value;
-      break;
-    case JointStateVariable::ALL: {
-      auto size = this->get_size();
-      this->positions_ = new_value.head(size);
-      this->velocities_ = new_value.segment(size, size);
-      this->accelerations_ = new_value.segment(2 * size, size);
-      this->torques_ = new_value.tail(size);
-      break;
-    }
-  }
+  assert_state_variable_size(new_value.size(), state_variable_type, this->get_size());
+  this->get_variable_map(state_variable_type) = new_value;
   this->set_empty(false);
 }
 
@@ -237,24 +252,13 @@ void JointState::set_state_variable(
     double new_value, unsigned int joint_index, const JointStateVariable& state_variable_type
 ) {
   assert_index_in_range(joint_index, this->get_size());
-  switch (state_variable_type) {
-    case JointStateVariable::POSITIONS:
-      this->positions_(joint_index) = new_value;
-      break;
-    case JointStateVariable::VELOCITIES:
-      this->velocities_(joint_index) = new_value;
-      break;
-    case JointStateVariable::ACCELERATIONS:
-      this->accelerations_(joint_index) = new_value;
-      break;
-    case JointStateVariable::TORQUES:
-      this->torques_(joint_index) = new_value;
-      break;
-    case JointStateVariable::ALL:
-      this->positions_(joint_index) = new_value;
-      this->velocities_(joint_index) = new_value;
-      this->accelerations_(joint_index) = new_value;
-      this->torques_(joint_index) = new_value;
+  if (state_variable_type == JointStateVariable::ALL) {
+    for (auto variable : {JointStateVariable::POSITIONS, JointStateVariable::VELOCITIES,
+                          JointStateVariable::ACCELERATIONS, JointStateVariable::TORQUES}) {
+      this->get_variable_map(variable)(joint_index) = new_value;
+    }
+  } else {
+    this->get_variable_map(state_variable_type)(joint_index) = new_value;
   }
   this->set_empty(false);
 }
@@ -406,16 +410,16 @@ double JointState::dist(const JointState& state, const JointStateVariable& state
   // calculation
   double result = 0;
   if (state_variable_type == JointStateVariable::POSITIONS || state_variable_type == JointStateVariable::ALL) {
-    result += (this->get_positions() - state.get_positions()).norm();
+    result += (this->get_positions_view() - state.get_positions_view()).norm();
   }
   if (state_variable_type == JointStateVariable::VELOCITIES || state_variable_type == JointStateVariable::ALL) {
-    result += (this->get_velocities() - state.get_velocities()).norm();
+    result += (this->get_velocities_view() - state.get_velocities_view()).norm();
   }
   if (state_variable_type == JointStateVariable::ACCELERATIONS || state_variable_type == JointStateVariable::ALL) {
-    result += (this->get_accelerations() - state.get_accelerations()).norm();
+    result += (this->get_accelerations_view() - state.get_accelerations_view()).norm();
   }
   if (state_variable_type == JointStateVariable::TORQUES || state_variable_type == JointStateVariable::ALL) {
-    result += (this->get_torques() - state.get_torques()).norm();
+    result += (this->get_torques_view() - state.get_torques_view()).norm();
   }
   return result;
 }
@@ -431,7 +435,7 @@ void JointState::reset() {
 
 bool JointState::is_incompatible(const State& state) const {
   try {
-    auto other = dynamic_cast<const JointState&>(state);
+    const auto& other = dynamic_cast<const JointState&>(state);
     if (this->names_.size() != other.names_.size()) {
       return true;
     }
@@ -449,10 +453,7 @@ bool JointState::is_incompatible(const State& state) const {
 
 void JointState::set_zero() {
   if (this->get_size() > 0) {
-    this->positions_.setZero();
-    this->velocities_.setZero();
-    this->accelerations_.setZero();
-    this->torques_.setZero();
+    this->data_.setZero();
     this->set_empty(false);
   }
 }
@@ -475,7 +476,9 @@ void JointState::multiply_state_variable(const Eigen::MatrixXd& lambda, const Jo
 }
 
 JointState& JointState::operator*=(double lambda) {
-  this->set_state_variable(lambda * this->get_state_variable(JointStateVariable::ALL), JointStateVariable::ALL);
+  this->assert_not_empty();
+  this->data_ *= lambda;
+  this->reset_timestamp();
   return (*this);
 }
 
@@ -513,10 +516,10 @@ JointState& JointState::operator+=(const JointState& state) {
         "The two joint states are incompatible, check name, joint names and order or size"
     );
   }
-  this->set_state_variable(
-      this->get_state_variable(JointStateVariable::ALL) + state.get_state_variable(JointStateVariable::ALL),
-      JointStateVariable::ALL
-  );
+  this->assert_not_empty();
+  state.assert_not_empty();
+  this->data_ += state.data_;
+  this->reset_timestamp();
   return (*this);
 }
 
@@ -529,12 +532,20 @@ JointState JointState::operator+(const JointState& state) const {
 JointState JointState::operator-() const {
   // create a copy of the state
   JointState result(*this);
-  result.set_state_variable(-result.get_state_variable(JointStateVariable::ALL), JointStateVariable::ALL);
+  result *= -1;
   return result;
 }
 
 JointState& JointState::operator-=(const JointState& state) {
-  (*this) += -state;
+  if (this->is_incompatible(state)) {
+    throw IncompatibleStatesException(
+        "The two joint states are incompatible, check name, joint names and order or size"
+    );
+  }
+  this->assert_not_empty();
+  state.assert_not_empty();
+  this->data_ -= state.data_;
+  this->reset_timestamp();
   return (*this);
 }
 
@@ -39,6 +39,10 @@ JointTorques::JointTorques(const JointState& state) : JointState(state) {
 
 JointTorques::JointTorques(const JointTorques& torques) : JointTorques(static_cast<const JointState&>(torques)) {}
 
+JointTorques::JointTorques(JointTorques&& torques) noexcept : JointState(std::move(torques)) {
+  this->set_type(StateType::JOINT_TORQUES);
+}
+
 JointTorques JointTorques::Zero(const std::string& robot_name, unsigned int nb_joints) {
   return JointState::Zero(robot_name, nb_joints);
 }
@@ -43,6 +43,10 @@ JointVelocities::JointVelocities(const JointState& state) : JointState(state) {
 JointVelocities::JointVelocities(const JointVelocities& velocities) :
     JointVelocities(static_cast<const JointState&>(velocities)) {}
 
+JointVelocities::JointVelocities(JointVelocities&& velocities) noexcept : JointState(std::move(velocities)) {
+  this->set_type(StateType::JOINT_VELOCITIES);
+}
+
 JointVelocities::JointVelocities(const JointAccelerations& accelerations) :
     JointVelocities(accelerations.integrate(1.0)) {}
 
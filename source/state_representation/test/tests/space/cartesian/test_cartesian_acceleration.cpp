@@ -135,3 +135,13 @@ TEST(CartesianAccelerationTest, TestIntegrate) {
   CartesianTwist twist(acc);
   EXPECT_TRUE(acc.get_acceleration().isApprox(twist.get_twist()));
 }
+
+TEST(CartesianAccelerationTest, TestInverse) {
+  auto acceleration = CartesianAcceleration::Random("test", "world");
+  auto inverse = acceleration.inverse();
+  EXPECT_EQ(inverse.get_type(), StateType::CARTESIAN_ACCELERATION);
+  EXPECT_EQ(inverse.get_name(), "world");
+  EXPECT_EQ(inverse.get_reference_frame(), "test");
+  EXPECT_TRUE(inverse.data().isApprox(CartesianAcceleration(static_cast<const CartesianState&>(acceleration).inverse()).data()));
+  expect_only_acceleration(inverse);
+}
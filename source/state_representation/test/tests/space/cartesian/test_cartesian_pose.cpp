@@ -1,6 +1,8 @@
 #include <gtest/gtest.h>
 
 #include "state_representation/space/cartesian/CartesianPose.hpp"
+#include "state_representation/exceptions/EmptyStateException.hpp"
+#include "state_representation/exceptions/IncompatibleReferenceFramesException.hpp"
 
 using namespace state_representation;
 using namespace std::chrono_literals;
@@ -169,6 +171,48 @@ TEST(CartesianPoseTest, MultiplyPoseAndState) {
   EXPECT_GT(abs(res.get_orientation().dot(res2.get_orientation())), 1 - 1e-5);
 }
 
+TEST(CartesianPoseTest, PoseOnlyOperationsMatchFullTransform) {
+  CartesianPose pose = CartesianPose::Random("test", "world");
+  CartesianState full_pose = pose;
+
+  CartesianPose other = CartesianPose::Random("test2", "test");
+  CartesianPose product = pose * other;
+  CartesianState expected = full_pose * static_cast<const CartesianState&>(other);
+  EXPECT_EQ(product.get_name(), "test2");
+  EXPECT_EQ(product.get_reference_frame(), "world");
+  EXPECT_TRUE(product.get_pose().isApprox(expected.get_pose()));
+  expect_only_pose(product);
+  CartesianPose in_place = pose;
+  in_place *= other;
+  EXPECT_TRUE(in_place.get_pose().isApprox(expected.get_pose()));
+  CartesianState state = CartesianState::Random("test2", "test");
+  in_place = pose;
+  in_place *= state;
+  EXPECT_TRUE(in_place.get_pose().isApprox((full_pose * state).get_pose()));
+  expect_only_pose(in_place);
+  EXPECT_THROW(pose * CartesianPose::Random("test2"), exceptions::IncompatibleReferenceFramesException);
+
+  CartesianPose inverse = pose.inverse();
+  CartesianState expected_inverse = full_pose.inverse();
+  EXPECT_EQ(inverse.get_name(), "world");
+  EXPECT_EQ(inverse.get_reference_frame(), "test");
+  EXPECT_TRUE(inverse.get_pose().isApprox(expected_inverse.get_pose()));
+  expect_only_pose(inverse);
+
+  CartesianTwist twist = CartesianTwist::Random("test2", "test");
+  CartesianTwist transformed_twist = pose * twist;
+  EXPECT_EQ(transformed_twist.get_name(), "test2");
+  EXPECT_EQ(transformed_twist.get_reference_frame(), "world");
+  EXPECT_TRUE(transformed_twist.data().isApprox(CartesianTwist(full_pose * twist).data()));
+
+  CartesianAcceleration acceleration = CartesianAcceleration::Random("test2", "test");
+  EXPECT_TRUE((pose * acceleration).data().isApprox(CartesianAcceleration(full_pose * acceleration).data()));
+
+  CartesianWrench wrench = CartesianWrench::Random("test2", "test");
+  EXPECT_TRUE((pose * wrench).data().isApprox(CartesianWrench(full_pose * wrench).data()));
+  EXPECT_THROW(CartesianPose("test") * wrench, exceptions::EmptyStateException);
+}
+
 TEST_F(CartesianPoseTestClass, TestAddTwoPoses) {
   tf1.set_position(Eigen::Vector3d::Zero());
   Eigen::Vector3d pos2(1, 0, 0);
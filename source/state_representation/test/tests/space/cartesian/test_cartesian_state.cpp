@@ -6,6 +6,7 @@
 #include "state_representation/space/cartesian/CartesianTwist.hpp"
 #include "state_representation/space/cartesian/CartesianAcceleration.hpp"
 #include "state_representation/space/cartesian/CartesianWrench.hpp"
+#include "state_representation/space/cartesian/CartesianStateExpression.hpp"
 #include "state_representation/exceptions/EmptyStateException.hpp"
 #include "state_representation/exceptions/InvalidStateVariableException.hpp"
 #include "state_representation/exceptions/IncompatibleReferenceFramesException.hpp"
@@ -292,6 +293,38 @@ TEST(CartesianStateTest, SetZero) {
   EXPECT_FLOAT_EQ(random2.data().norm(), 1);
 }
 
+TEST(CartesianStateTest, UncheckedGetters) {
+  CartesianState state = CartesianState::Random("test");
+  EXPECT_EQ(&state.get_position_unchecked(), &state.get_position());
+  EXPECT_EQ(&state.get_orientation_unchecked(), &state.get_orientation());
+  EXPECT_EQ(&state.get_linear_velocity_unchecked(), &state.get_linear_velocity());
+  EXPECT_EQ(&state.get_angular_velocity_unchecked(), &state.get_angular_velocity());
+  EXPECT_EQ(&state.get_linear_acceleration_unchecked(), &state.get_linear_acceleration());
+  EXPECT_EQ(&state.get_angular_acceleration_unchecked(), &state.get_angular_acceleration());
+  EXPECT_EQ(&state.get_force_unchecked(), &state.get_force());
+  EXPECT_EQ(&state.get_torque_unchecked(), &state.get_torque());
+  EXPECT_TRUE(noexcept(state.get_position_unchecked()));
+
+  // the unchecked getters do not throw on an empty state
+  state.reset();
+  EXPECT_THROW(state.get_position(), exceptions::EmptyStateException);
+  EXPECT_NO_THROW(state.get_position_unchecked());
+}
+
+TEST(CartesianStateTest, VariableMaps) {
+  CartesianState state("test");
+  state.get_variable_map(CartesianStateVariable::POSITION) = Eigen::Vector3d(1, 2, 3);
+  state.get_variable_map(CartesianStateVariable::TORQUE).setConstant(4);
+  // writing the variables in place does not fill the state
+  EXPECT_TRUE(state.is_empty());
+  state.set_empty(false);
+  EXPECT_TRUE(state.get_position().isApprox(Eigen::Vector3d(1, 2, 3)));
+  EXPECT_TRUE(state.get_torque().isApprox(Eigen::Vector3d::Constant(4)));
+  EXPECT_EQ(state.get_variable_map(CartesianStateVariable::FORCE).data(), state.get_force().data());
+  EXPECT_THROW(state.get_variable_map(CartesianStateVariable::ORIENTATION), exceptions::InvalidStateVariableException);
+  EXPECT_THROW(state.get_variable_map(CartesianStateVariable::TWIST), exceptions::InvalidStateVariableException);
+}
+
 TEST(CartesianStateTest, GetSetData) {
   CartesianState cs1 = CartesianState::Identity("test");
   CartesianState cs2 = CartesianState::Random("test");
@@ -1090,6 +1123,37 @@ TEST(CartesianStateTest, TestSubtractionOperators) {
   //wrench -= acc;
 }
 
+TEST(CartesianStateTest, LazyExpressions) {
+  CartesianState a = CartesianState::Random("a");
+  CartesianState b = CartesianState::Random("b");
+  CartesianState c = CartesianState::Random("c");
+
+  CartesianState expected = 0.5 * (a - b) + c;
+  CartesianState result = 0.5 * (lazy(a) - b) + c;
+  EXPECT_EQ(result.get_name(), a.get_name());
+  EXPECT_EQ(result.get_reference_frame(), a.get_reference_frame());
+  EXPECT_TRUE(result.data().isApprox(expected.data()));
+  result = -(lazy(a) + b) / 2.0;
+  EXPECT_TRUE(result.data().isApprox((-(a + b) / 2.0).data()));
+
+  // evaluation into an existing state, which can be an operand
+  expected = a - b;
+  (lazy(a) - b).evaluate(a);
+  EXPECT_TRUE(a.data().isApprox(expected.data()));
+
+  CartesianTwist t1 = CartesianTwist::Random("t1");
+  CartesianTwist t2 = CartesianTwist::Random("t2");
+  CartesianTwist twist = 2.0 * (lazy(t1) - t2);
+  EXPECT_EQ(twist.get_type(), StateType::CARTESIAN_TWIST);
+  EXPECT_TRUE(twist.data().isApprox((2.0 * (t1 - t2)).data()));
+
+  CartesianState other = CartesianState::Random("other", "other_world");
+  EXPECT_THROW(CartesianState(lazy(b) + other), exceptions::IncompatibleReferenceFramesException);
+  CartesianState empty("empty");
+  EXPECT_THROW(CartesianState(lazy(b) + empty), exceptions::EmptyStateException);
+  EXPECT_THROW(lazy(b) / 0.0, std::runtime_error);
+}
+
 TEST(CartesianStateTest, TestUtilities) {
   auto state_variable_type = string_to_cartesian_state_variable("position");
   EXPECT_EQ(state_variable_type, CartesianStateVariable::POSITION);
@@ -0,0 +1,106 @@
+#include "state_representation/space/cartesian/CartesianStateArray.hpp"
+#include "state_representation/RealtimeSection.hpp"
+#include "state_representation/exceptions/EmptyStateException.hpp"
+#include "state_representation/exceptions/IncompatibleReferenceFramesException.hpp"
+#include <gtest/gtest.h>
+
+using namespace state_representation;
+using namespace state_representation::exceptions;
+
+static CartesianStateArray random_array(Eigen::Index size, bool with_twists, bool with_wrenches) {
+  CartesianStateArray array("sample", "frame", size);
+  if (with_twists) {
+    array.add_variable(CartesianStateVariable::TWIST);
+  }
+  if (with_wrenches) {
+    array.add_variable(CartesianStateVariable::WRENCH);
+  }
+  for (Eigen::Index i = 0; i < size; ++i) {
+    array.set_state(i, CartesianState::Random("sample", "frame"));
+  }
+  return array;
+}
+
+static void expect_transformed(
+    const CartesianState& frame, const CartesianStateArray& array, const CartesianStateArray& result
+) {
+  EXPECT_EQ(result.get_name(), array.get_name());
+  EXPECT_EQ(result.get_reference_frame(), frame.get_reference_frame());
+  for (Eigen::Index i = 0; i < array.size(); ++i) {
+    CartesianState expected = frame * array.get_state(i);
+    CartesianState sample = result.get_state(i);
+    EXPECT_TRUE(sample.get_position().isApprox(expected.get_position()));
+    EXPECT_TRUE(sample.get_orientation().coeffs().isApprox(expected.get_orientation().coeffs()));
+    if (array.has_twists()) {
+      EXPECT_TRUE(sample.get_twist().isApprox(expected.get_twist()));
+    }
+    if (array.has_wrenches()) {
+      EXPECT_TRUE(sample.get_wrench().isApprox(expected.get_wrench()));
+    }
+  }
+}
+
+TEST(CartesianStateArrayTest, Create) {
+  CartesianStateArray array("sample", "frame", 3);
+  EXPECT_EQ(array.get_name(), "sample");
+  EXPECT_EQ(array.get_reference_frame(), "frame");
+  EXPECT_EQ(array.size(), 3);
+  EXPECT_FALSE(array.has_twists());
+  EXPECT_FALSE(array.has_wrenches());
+  EXPECT_TRUE(array.get_positions().isZero());
+  EXPECT_TRUE(array.get_orientations().col(0).isOnes());
+  EXPECT_TRUE(array.get_orientations().rightCols(3).isZero());
+  EXPECT_EQ(array.get_linear_velocities().rows(), 0);
+
+  array.set_forces(Eigen::Matrix<double, 3, 3>::Ones());
+  EXPECT_TRUE(array.has_wrenches());
+  EXPECT_TRUE(array.get_torques().isZero());
+  EXPECT_EQ(array.get_torques().rows(), 3);
+  array.resize(5);
+  EXPECT_TRUE(array.get_forces().bottomRows(2).isZero());
+  EXPECT_TRUE(array.get_orientations().col(0).isOnes());
+  EXPECT_THROW(array.set_positions(Eigen::Matrix<double, 3, 3>::Zero()), IncompatibleSizeException);
+  EXPECT_THROW(array.add_variable(CartesianStateVariable::ACCELERATION), InvalidStateVariableException);
+
+  CartesianState state = CartesianState::Random("sample", "frame");
+  array.set_state(4, state);
+  CartesianState sample = array.get_state(4);
+  EXPECT_TRUE(sample.get_pose().isApprox(state.get_pose()));
+  EXPECT_TRUE(sample.get_wrench().isApprox(state.get_wrench()));
+  EXPECT_TRUE(sample.get_twist().isZero());
+  EXPECT_THROW(array.set_state(0, CartesianState::Random("sample")), IncompatibleReferenceFramesException);
+  EXPECT_THROW(array.set_state(0, CartesianState("sample", "frame")), EmptyStateException);
+  EXPECT_THROW(array.get_state(array.size()), std::out_of_range);
+  EXPECT_THROW(array.get_state(-1), std::out_of_range);
+  EXPECT_THROW(array.set_state(array.size(), state), std::out_of_range);
+}
+
+TEST(CartesianStateArrayTest, TransformPoses) {
+  CartesianStateArray array = random_array(37, false, false);
+  CartesianState frame = CartesianState::Random("frame", "world");
+  CartesianStateArray result = frame * array;
+  expect_transformed(frame, array, result);
+  EXPECT_FALSE(result.has_twists());
+  EXPECT_THROW(frame * result, IncompatibleReferenceFramesException);
+  EXPECT_THROW(CartesianState("frame") * array, EmptyStateException);
+}
+
+TEST(CartesianStateArrayTest, TransformStates) {
+  CartesianState frame = CartesianState::Random("frame", "world");
+  for (auto [with_twists, with_wrenches]: {std::pair{true, false}, {false, true}, {true, true}}) {
+    CartesianStateArray array = random_array(21, with_twists, with_wrenches);
+    expect_transformed(frame, array, frame * array);
+  }
+}
+
+TEST(CartesianStateArrayTest, TransformWithoutAllocation) {
+  CartesianStateArray array = random_array(100, true, true);
+  CartesianStateArray expected = array;
+  CartesianState frame = CartesianState::Random("frame", "world");
+  {
+    // any heap allocation aborts the test program as it is linked with the allocation check
+    RealtimeSection section;
+    array.transform(frame);
+  }
+  expect_transformed(frame, expected, array);
+}
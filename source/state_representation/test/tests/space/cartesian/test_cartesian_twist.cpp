@@ -160,3 +160,13 @@ TEST(CartesianTwistTest, TestDifferentiate) {
   CartesianAcceleration acc(twist);
   EXPECT_TRUE(acc.get_acceleration().isApprox(twist.get_twist()));
 }
+
+TEST(CartesianTwistTest, TestInverse) {
+  auto twist = CartesianTwist::Random("test", "world");
+  auto inverse = twist.inverse();
+  EXPECT_EQ(inverse.get_type(), StateType::CARTESIAN_TWIST);
+  EXPECT_EQ(inverse.get_name(), "world");
+  EXPECT_EQ(inverse.get_reference_frame(), "test");
+  EXPECT_TRUE(inverse.data().isApprox(CartesianTwist(static_cast<const CartesianState&>(twist).inverse()).data()));
+  expect_only_twist(inverse);
+}
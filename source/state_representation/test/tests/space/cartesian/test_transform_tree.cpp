@@ -0,0 +1,164 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+
+#include "state_representation/RealtimeSection.hpp"
+#include "state_representation/space/cartesian/TransformTree.hpp"
+#include "state_representation/exceptions/EmptyStateException.hpp"
+#include "state_representation/exceptions/ExtrapolationException.hpp"
+#include "state_representation/exceptions/IncompatibleReferenceFramesException.hpp"
+#include "state_representation/exceptions/IncompatibleStatesException.hpp"
+
+using namespace state_representation;
+using namespace std::chrono_literals;
+
+static void expect_pose_near(const CartesianPose& pose, const CartesianPose& expected) {
+  EXPECT_EQ(pose.get_name(), expected.get_name());
+  EXPECT_EQ(pose.get_reference_frame(), expected.get_reference_frame());
+  EXPECT_TRUE(pose.get_position().isApprox(expected.get_position()));
+  EXPECT_NEAR(std::abs(pose.get_orientation().dot(expected.get_orientation())), 1.0, 1e-9);
+}
+
+TEST(TransformTreeTest, ComposeChain) {
+  TransformTree tree;
+  auto base = CartesianPose::Random("base", "world");
+  auto tool = CartesianPose::Random("tool", "base");
+  auto camera = CartesianPose::Random("camera", "tool");
+  auto gripper = CartesianPose::Random("gripper", "tool");
+  auto table = CartesianPose::Random("table", "world");
+  for (const auto& pose: {base, tool, camera, gripper, table}) {
+    tree.set_transform(pose);
+  }
+  EXPECT_EQ(tree.size(), 6);
+  EXPECT_TRUE(tree.has_frame("world"));
+  EXPECT_TRUE(tree.has_frame("camera"));
+  // looking up unknown frames does not register them
+  auto registry_size = FrameRegistry::size();
+  EXPECT_FALSE(tree.has_frame("transform_tree_unknown_frame"));
+  EXPECT_THROW(tree.get_transform("transform_tree_unknown_frame", "world"),
+               exceptions::IncompatibleReferenceFramesException);
+  EXPECT_EQ(FrameRegistry::size(), registry_size);
+
+  expect_pose_near(tree.get_transform("camera", "world"), base * tool * camera);
+  expect_pose_near(tree.get_transform("world", "camera"), (base * tool * camera).inverse());
+  expect_pose_near(tree.get_transform("camera", "gripper"), gripper.inverse() * camera);
+  expect_pose_near(tree.get_transform("camera", "table"), table.inverse() * base * tool * camera);
+  expect_pose_near(tree.get_transform("table", "camera"), (base * tool * camera).inverse() * table);
+  expect_pose_near(tree.get_transform("tool", "base"), tool);
+  // the second lookup goes through the cached path
+  expect_pose_near(tree.get_transform("camera", "world"), base * tool * camera);
+
+  auto identity = tree.get_transform("tool", "tool");
+  EXPECT_TRUE(identity.get_position().isZero());
+  EXPECT_TRUE(identity.get_orientation().isApprox(Eigen::Quaterniond::Identity()));
+}
+
+TEST(TransformTreeTest, InterpolateInTime) {
+  TransformTree tree(8, 3);
+  auto start = std::chrono::steady_clock::now();
+  CartesianPose first("sensor", Eigen::Vector3d(1, 0, 0), Eigen::Quaterniond::Identity(), "world");
+  CartesianPose second(
+      "sensor", Eigen::Vector3d(3, 2, 0), Eigen::Quaterniond(Eigen::AngleAxisd(M_PI / 2, Eigen::Vector3d::UnitZ())),
+      "world"
+  );
+  tree.set_transform(first, start);
+  tree.set_transform(second, start + 1s);
+
+  auto middle = tree.get_transform("sensor", "world", start + 250ms);
+  EXPECT_TRUE(middle.get_position().isApprox(Eigen::Vector3d(1.5, 0.5, 0)));
+  EXPECT_TRUE(middle.get_orientation().isApprox(
+      Eigen::Quaterniond(Eigen::AngleAxisd(M_PI / 8, Eigen::Vector3d::UnitZ()))));
+  expect_pose_near(tree.get_transform("sensor", "world", start), first);
+  expect_pose_near(tree.get_transform("sensor", "world", start + 2s), second);
+  expect_pose_near(tree.get_transform("sensor", "world"), second);
+  EXPECT_THROW(tree.get_transform("sensor", "world", start - 1ms), exceptions::ExtrapolationException);
+  EXPECT_THROW(tree.set_transform(first, start + 500ms), exceptions::IncompatibleStatesException);
+
+  // the ring buffer only keeps the last poses
+  tree.set_transform(first, start + 2s);
+  tree.set_transform(second, start + 3s);
+  EXPECT_THROW(tree.get_transform("sensor", "world", start + 500ms), exceptions::ExtrapolationException);
+  auto late = tree.get_transform("sensor", "world", start + 2500ms);
+  EXPECT_TRUE(late.get_position().isApprox(Eigen::Vector3d(2, 1, 0)));
+}
+
+TEST(TransformTreeTest, InvalidTransforms) {
+  TransformTree tree(4);
+  tree.set_transform(CartesianPose::Random("a", "world"));
+  tree.set_transform(CartesianPose::Random("b", "a"));
+
+  EXPECT_THROW(tree.set_transform(CartesianPose("c")), exceptions::EmptyStateException);
+  EXPECT_THROW(tree.set_transform(CartesianPose::Random("c", "c")), exceptions::IncompatibleReferenceFramesException);
+  EXPECT_THROW(tree.set_transform(CartesianPose::Random("b", "world")),
+               exceptions::IncompatibleReferenceFramesException);
+  EXPECT_THROW(tree.set_transform(CartesianPose::Random("world", "b")),
+               exceptions::IncompatibleReferenceFramesException);
+  EXPECT_THROW(tree.set_transform(CartesianPose::Random("d", "e")), std::length_error);
+  EXPECT_EQ(tree.size(), 3);
+
+  tree.set_transform(CartesianPose::Random("d", "b"));
+  EXPECT_THROW(tree.set_transform(CartesianPose::Random("e", "d")), std::length_error);
+  EXPECT_THROW(tree.get_transform("a", "transform_tree_unknown_frame"),
+               exceptions::IncompatibleReferenceFramesException);
+
+  TransformTree forest;
+  forest.set_transform(CartesianPose::Random("a", "world"));
+  forest.set_transform(CartesianPose::Random("b", "map"));
+  EXPECT_THROW(forest.get_transform("a", "b"), exceptions::IncompatibleReferenceFramesException);
+  // connecting the roots of the two trees
+  forest.set_transform(CartesianPose::Random("map", "world"));
+  EXPECT_NO_THROW(forest.get_transform("a", "b"));
+}
+
+TEST(TransformTreeTest, LookupWithoutAllocation) {
+  TransformTree tree;
+  auto base = CartesianPose::Random("base", "world");
+  auto tool = CartesianPose::Random("tool", "base");
+  tree.set_transform(base);
+  tree.set_transform(tool);
+  auto time = std::chrono::steady_clock::now();
+  CartesianPose result;
+  {
+    // any heap allocation aborts the test program as it is linked with the allocation check
+    RealtimeSection section;
+    tree.get_transform(tool.get_name_id(), FrameRegistry::WORLD, time, result);
+    tree.get_transform(tool.get_name_id(), FrameRegistry::WORLD, time, result);
+  }
+  expect_pose_near(result, base * tool);
+}
+
+TEST(TransformTreeTest, ConcurrentLookups) {
+  TransformTree tree(8, 16);
+  tree.set_transform(CartesianPose("moving", Eigen::Vector3d::Zero(), "world"));
+  tree.set_transform(CartesianPose("static", Eigen::Vector3d(0, 0, 1), "moving"));
+  std::atomic<bool> done(false);
+  std::thread writer([&tree, &done] {
+    for (int i = 1; i <= 10000; ++i) {
+      tree.set_transform(CartesianPose("moving", Eigen::Vector3d(i, i, i), "world"));
+    }
+    done = true;
+  });
+  std::vector<std::thread> readers;
+  std::atomic<int> inconsistent(0);
+  auto frame = FrameRegistry::find_id("static");
+  for (int r = 0; r < 2; ++r) {
+    readers.emplace_back([&] {
+      CartesianPose result;
+      while (!done) {
+        // a torn read of a pose would mix the coordinates of different poses
+        tree.get_transform(frame, FrameRegistry::WORLD, std::chrono::steady_clock::time_point::max(), result);
+        const auto& position = result.get_position();
+        if (position.x() != position.y() || position.z() != position.x() + 1) {
+          ++inconsistent;
+        }
+      }
+    });
+  }
+  writer.join();
+  for (auto& reader: readers) {
+    reader.join();
+  }
+  EXPECT_EQ(inconsistent, 0);
+  EXPECT_TRUE(tree.get_transform("static", "world").get_position().isApprox(Eigen::Vector3d(10000, 10000, 10001)));
+}
@@ -5,6 +5,7 @@
 #include "state_representation/space/joint/JointVelocities.hpp"
 #include "state_representation/space/joint/JointAccelerations.hpp"
 #include "state_representation/space/joint/JointTorques.hpp"
+#include "state_representation/space/joint/JointStateExpression.hpp"
 #include "state_representation/exceptions/IncompatibleSizeException.hpp"
 #include "state_representation/exceptions/IncompatibleStatesException.hpp"
 #include "state_representation/exceptions/JointNotFoundException.hpp"
@@ -602,6 +603,97 @@ TEST(JointStateTest, TestSubtractionOperators) {
   //torques -= accelerations;
 }
 
+TEST(JointStateTest, LazyExpressions) {
+  JointState a = JointState::Random("test", 3);
+  JointState b = JointState::Random("test", 3);
+  JointState c = JointState::Random("test", 3);
+
+  JointState expected = 2.0 * (a - b) + c;
+  JointState result = 2.0 * (lazy(a) - b) + c;
+  EXPECT_EQ(result.get_name(), a.get_name());
+  EXPECT_EQ(result.get_names(), a.get_names());
+  EXPECT_TRUE(result.data().isApprox(expected.data()));
+  result = -(lazy(a) + b) / 2.0;
+  EXPECT_TRUE(result.data().isApprox((-(a + b) / 2.0).data()));
+
+  // evaluation into an existing state, which can be an operand
+  expected = a - 0.5 * b;
+  (lazy(a) - 0.5 * lazy(b)).evaluate(a);
+  EXPECT_TRUE(a.data().isApprox(expected.data()));
+
+  JointPositions p1 = JointPositions::Random("test", 3);
+  JointPositions p2 = JointPositions::Random("test", 3);
+  JointPositions positions = lazy(p1) - p2;
+  EXPECT_EQ(positions.get_type(), StateType::JOINT_POSITIONS);
+  EXPECT_TRUE(positions.data().isApprox((p1 - p2).data()));
+  auto mixed = (lazy(p1) + b).evaluate();
+  EXPECT_EQ(mixed.get_type(), StateType::JOINT_STATE);
+  EXPECT_TRUE(mixed.data().isApprox((p1 + b).data()));
+
+  JointState other = JointState::Random("test", 4);
+  EXPECT_THROW(JointState(lazy(a) + other), exceptions::IncompatibleStatesException);
+  JointState empty("test", 3);
+  EXPECT_THROW(JointState(lazy(a) + empty), exceptions::EmptyStateException);
+}
+
+TEST(JointStateTest, ContiguousStorage) {
+  JointState state = JointState::Random("test", 3);
+  EXPECT_EQ(state.get_positions_view().data() + 3, state.get_velocities_view().data());
+  EXPECT_EQ(state.get_velocities_view().data() + 3, state.get_accelerations_view().data());
+  EXPECT_EQ(state.get_accelerations_view().data() + 3, state.get_torques_view().data());
+  Eigen::VectorXd data = state.data();
+  EXPECT_TRUE(data.segment(6, 3).cwiseEqual(state.get_accelerations()).all());
+
+  // the getters return copies that do not follow the updates of the state
+  auto positions = state.get_positions();
+  state.set_position(1.0, 0);
+  EXPECT_NE(positions(0), 1.0);
+  EXPECT_NE(positions.data(), state.get_positions_view().data());
+
+  // the views follow the updates of the state
+  auto positions_view = state.get_positions_view();
+  EXPECT_TRUE(positions_view.cwiseEqual(state.get_positions()).all());
+  state.set_state_variable(Eigen::VectorXd::Ones(12), JointStateVariable::ALL);
+  EXPECT_TRUE(positions_view.cwiseEqual(1.0).all());
+  JointState empty("test", 3);
+  EXPECT_THROW(empty.get_torques_view(), exceptions::EmptyStateException);
+
+  JointState copy(state);
+  EXPECT_NE(copy.get_positions_view().data(), state.get_positions_view().data());
+  EXPECT_TRUE(copy.data().cwiseEqual(state.data()).all());
+
+  // the variable maps write in place without filling the state
+  empty.get_variable_map(JointStateVariable::VELOCITIES).setConstant(2);
+  EXPECT_TRUE(empty.is_empty());
+  empty.set_empty(false);
+  EXPECT_TRUE(empty.get_velocities().cwiseEqual(2.0).all());
+  EXPECT_EQ(empty.get_variable_map(JointStateVariable::ALL).size(), 12);
+}
+
+TEST(JointStateTest, UncheckedGetters) {
+  JointState state = JointState::Random("test", 3);
+  // the const variable maps are the unchecked variant of the views
+  const JointState& const_state = state;
+  EXPECT_EQ(const_state.get_variable_map(JointStateVariable::POSITIONS).data(), state.get_positions_view().data());
+  EXPECT_EQ(const_state.get_variable_map(JointStateVariable::VELOCITIES).data(), state.get_velocities_view().data());
+  EXPECT_EQ(
+      const_state.get_variable_map(JointStateVariable::ACCELERATIONS).data(), state.get_accelerations_view().data());
+  EXPECT_EQ(const_state.get_variable_map(JointStateVariable::TORQUES).data(), state.get_torques_view().data());
+  for (unsigned int i = 0; i < state.get_size(); ++i) {
+    EXPECT_EQ(state.get_position_unchecked(i), state.get_position(i));
+    EXPECT_EQ(state.get_velocity_unchecked(i), state.get_velocity(i));
+    EXPECT_EQ(state.get_acceleration_unchecked(i), state.get_acceleration(i));
+    EXPECT_EQ(state.get_torque_unchecked(i), state.get_torque(i));
+  }
+  EXPECT_TRUE(noexcept(const_state.get_variable_map(JointStateVariable::POSITIONS)));
+  EXPECT_TRUE(noexcept(state.get_torque_unchecked(0)));
+
+  // the unchecked getters do not throw on an empty state
+  const JointState empty("test", 3);
+  EXPECT_THROW(empty.get_positions(), exceptions::EmptyStateException);
+  EXPECT_NO_THROW(empty.get_variable_map(JointStateVariable::POSITIONS));
+}
+
 TEST(JointStateTest, TestUtilities) {
   auto state_variable_type = string_to_joint_state_variable("positions");
   EXPECT_EQ(state_variable_type, JointStateVariable::POSITIONS);
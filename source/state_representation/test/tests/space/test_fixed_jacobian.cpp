@@ -0,0 +1,91 @@
+#include "state_representation/space/FixedJacobian.hpp"
+#include "state_representation/RealtimeSection.hpp"
+#include "state_representation/exceptions/EmptyStateException.hpp"
+#include "state_representation/exceptions/IncompatibleSizeException.hpp"
+#include "state_representation/exceptions/IncompatibleStatesException.hpp"
+#include <gtest/gtest.h>
+
+using namespace state_representation;
+using namespace state_representation::exceptions;
+
+TEST(FixedJacobianTest, Create) {
+  FixedJacobian<7> jac("robot", "test");
+  EXPECT_EQ(jac.get_name(), "robot");
+  EXPECT_EQ(jac.get_frame(), "test");
+  EXPECT_EQ(jac.get_reference_frame(), "world");
+  for (int i = 0; i < 7; ++i) {
+    EXPECT_EQ(jac.get_joint_names().at(i), ("joint" + std::to_string(i)));
+  }
+  EXPECT_TRUE(jac.data().isZero());
+  EXPECT_THROW(FixedJacobian<7>("robot", std::vector<std::string>{"j0"}, "test"), IncompatibleSizeException);
+
+  Jacobian dynamic = Jacobian::Random("robot", 7, "test", "test_ref");
+  FixedJacobian<7> converted(dynamic);
+  EXPECT_EQ(converted.get_reference_frame(), "test_ref");
+  EXPECT_TRUE(converted.data().isApprox(dynamic.data()));
+  EXPECT_TRUE(converted.to_jacobian().data().isApprox(dynamic.data()));
+  EXPECT_THROW(FixedJacobian<6>{dynamic}, IncompatibleSizeException);
+}
+
+TEST(FixedJacobianTest, SetData) {
+  FixedJacobian<7> jac("robot", "test", "test_ref");
+  EXPECT_THROW(jac.set_data(Jacobian::Random("robot", 7, "test", "world")), IncompatibleStatesException);
+  Jacobian dynamic = Jacobian::Random("robot", 7, "test", "test_ref");
+  jac.set_data(dynamic);
+  EXPECT_TRUE(jac.data().isApprox(dynamic.data()));
+  EXPECT_TRUE(jac.pseudoinverse().isApprox(dynamic.pseudoinverse()));
+  jac.set_data(Eigen::Matrix<double, 6, 7>::Identity());
+  EXPECT_TRUE(jac.pseudoinverse().isApprox(Eigen::Matrix<double, 7, 6>::Identity()));
+}
+
+TEST(FixedJacobianTest, Products) {
+  Jacobian dynamic = Jacobian::Random("robot", 7, "test", "test_ref");
+  FixedJacobian<7> jac(dynamic);
+
+  JointVelocities velocities = JointVelocities::Random("robot", 7);
+  CartesianTwist twist;
+  jac.multiply(velocities, twist);
+  CartesianTwist expected_twist = dynamic * velocities;
+  EXPECT_EQ(twist.get_name(), "test");
+  EXPECT_EQ(twist.get_reference_frame(), "test_ref");
+  EXPECT_TRUE(twist.data().isApprox(expected_twist.data()));
+  EXPECT_THROW(jac.multiply(JointVelocities::Random("robot", 6), twist), IncompatibleStatesException);
+  EXPECT_THROW(jac.multiply(JointVelocities("robot", 7), twist), EmptyStateException);
+
+  CartesianWrench wrench = CartesianWrench::Random("test", "test_ref");
+  JointTorques torques;
+  jac.transpose(wrench, torques);
+  EXPECT_EQ(torques.get_name(), "robot");
+  EXPECT_EQ(torques.get_names(), dynamic.get_joint_names());
+  EXPECT_TRUE(torques.data().isApprox(dynamic.transpose(wrench).data()));
+  EXPECT_THROW(jac.transpose(CartesianWrench::Random("test"), torques), IncompatibleStatesException);
+
+  twist = CartesianTwist::Random("test", "test_ref");
+  JointVelocities solution;
+  jac.pseudoinverse(twist, solution);
+  EXPECT_TRUE(solution.data().isApprox(dynamic.pseudoinverse(twist).data()));
+  EXPECT_THROW(jac.pseudoinverse(CartesianTwist::Random("test"), solution), IncompatibleStatesException);
+}
+
+TEST(FixedJacobianTest, ProductsWithoutAllocation) {
+  FixedJacobian<7> jac(Jacobian::Random("robot", 7, "test", "test_ref"));
+  JointVelocities velocities = JointVelocities::Random("robot", 7);
+  CartesianTwist twist("test", "test_ref");
+  CartesianWrench wrench = CartesianWrench::Random("test", "test_ref");
+  JointTorques torques("robot", 7);
+  JointVelocities solution("robot", 7);
+  Eigen::Matrix<double, 6, 7> data = Eigen::Matrix<double, 6, 7>::Random();
+  {
+    // any heap allocation aborts the test program as it is linked with the allocation check
+    RealtimeSection section;
+    for (int i = 0; i < 3; ++i) {
+      jac.set_data(data);
+      jac.multiply(velocities, twist);
+      jac.transpose(wrench, torques);
+      jac.pseudoinverse(twist, solution);
+      jac.pseudoinverse(twist, solution);
+    }
+  }
+  EXPECT_TRUE(solution.get_velocities().isApprox(jac.pseudoinverse() * twist.get_twist()));
+  EXPECT_TRUE(torques.get_torques().isApprox(data.transpose() * wrench.get_wrench()));
+}
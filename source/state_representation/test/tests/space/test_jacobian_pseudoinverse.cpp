@@ -0,0 +1,126 @@
+#include "state_representation/space/JacobianPseudoinverse.hpp"
+#include "state_representation/RealtimeSection.hpp"
+#include "state_representation/exceptions/EmptyStateException.hpp"
+#include "state_representation/exceptions/IncompatibleStatesException.hpp"
+#include "state_representation/exceptions/InvalidParameterException.hpp"
+#include <gtest/gtest.h>
+
+using namespace state_representation;
+using namespace state_representation::exceptions;
+
+static Eigen::MatrixXd damped_pseudoinverse(const Eigen::MatrixXd& matrix, double damping) {
+  return matrix.transpose()
+      * (matrix * matrix.transpose() + damping * damping * Eigen::MatrixXd::Identity(6, 6)).inverse();
+}
+
+TEST(JacobianPseudoinverseTest, Create) {
+  JacobianPseudoinverse pinv;
+  EXPECT_FALSE(pinv.is_computed());
+  EXPECT_EQ(pinv.get_condition_threshold(), 100);
+  EXPECT_EQ(pinv.get_max_damping(), 0.1);
+  EXPECT_THROW(pinv.get_pseudoinverse(), EmptyStateException);
+  EXPECT_THROW(pinv.solve(CartesianTwist::Random("test")), EmptyStateException);
+  EXPECT_THROW(pinv.compute(Jacobian("robot", 7, "test")), EmptyStateException);
+  EXPECT_THROW(pinv.set_condition_threshold(0.5), InvalidParameterException);
+  EXPECT_THROW(pinv.set_max_damping(0), InvalidParameterException);
+}
+
+TEST(JacobianPseudoinverseTest, WellConditioned) {
+  Eigen::MatrixXd data = Eigen::MatrixXd::Identity(6, 7) + 0.1 * Eigen::MatrixXd::Random(6, 7);
+  Jacobian jacobian("robot", "test", data, "test_ref");
+  JacobianPseudoinverse pinv(jacobian);
+  EXPECT_TRUE(pinv.is_computed());
+  EXPECT_FALSE(pinv.uses_svd());
+  EXPECT_EQ(pinv.get_damping(), 0);
+  EXPECT_TRUE(pinv.get_pseudoinverse().isApprox(jacobian.pseudoinverse()));
+
+  Eigen::JacobiSVD<Eigen::MatrixXd> svd(data);
+  const Eigen::VectorXd& singular_values = svd.singularValues();
+  double condition_number = singular_values(0) / singular_values(5);
+  EXPECT_NEAR(pinv.get_manipulability(), singular_values.prod(), 1e-9);
+  EXPECT_GT(pinv.get_condition_number(), condition_number / 4);
+  EXPECT_LT(pinv.get_condition_number(), condition_number * 4);
+
+  CartesianTwist twist = CartesianTwist::Random("test", "test_ref");
+  JointVelocities velocities = pinv.solve(twist);
+  EXPECT_EQ(velocities.get_name(), "robot");
+  EXPECT_EQ(velocities.get_names(), jacobian.get_joint_names());
+  EXPECT_TRUE(velocities.data().isApprox(jacobian.pseudoinverse(twist).data()));
+  EXPECT_THROW(pinv.solve(CartesianTwist::Random("test")), IncompatibleStatesException);
+}
+
+TEST(JacobianPseudoinverseTest, Singular) {
+  Eigen::MatrixXd data = Eigen::MatrixXd::Random(6, 7);
+  data.row(5) = data.row(4);
+  Jacobian jacobian("robot", "test", data);
+  JacobianPseudoinverse pinv(jacobian, 100, 0.2);
+  EXPECT_TRUE(pinv.uses_svd());
+  EXPECT_GT(pinv.get_condition_number(), 1e10);
+  EXPECT_NEAR(pinv.get_manipulability(), 0, 1e-9);
+  EXPECT_NEAR(pinv.get_damping(), 0.2, 1e-9);
+  EXPECT_TRUE(pinv.get_pseudoinverse().isApprox(damped_pseudoinverse(data, pinv.get_damping())));
+}
+
+TEST(JacobianPseudoinverseTest, DampingNearSingularity) {
+  Eigen::MatrixXd data = Eigen::MatrixXd::Identity(6, 7);
+  Jacobian jacobian("robot", "test", data);
+  JacobianPseudoinverse pinv(jacobian, 100, 0.1);
+  EXPECT_FALSE(pinv.uses_svd());
+  EXPECT_NEAR(pinv.get_condition_number(), 1, 1e-9);
+
+  // outside of the singular region the pseudoinverse is not damped
+  data(5, 5) = 0.02;
+  jacobian.set_data(data);
+  pinv.compute(jacobian);
+  EXPECT_EQ(pinv.get_damping(), 0);
+  EXPECT_TRUE(pinv.get_pseudoinverse().isApprox(jacobian.pseudoinverse()));
+
+  // the damping grows as the smallest singular value goes to zero
+  double previous_damping = 0;
+  for (double singular_value: {0.009, 0.005, 0.001, 0.}) {
+    data(5, 5) = singular_value;
+    jacobian.set_data(data);
+    pinv.compute(jacobian);
+    EXPECT_TRUE(pinv.uses_svd());
+    EXPECT_NEAR(pinv.get_manipulability(), singular_value, 1e-12);
+    EXPECT_GT(pinv.get_damping(), previous_damping);
+    EXPECT_LE(pinv.get_damping(), 0.1);
+    EXPECT_TRUE(pinv.get_pseudoinverse().isApprox(damped_pseudoinverse(data, pinv.get_damping())));
+    previous_damping = pinv.get_damping();
+  }
+  EXPECT_NEAR(previous_damping, 0.1, 1e-12);
+}
+
+TEST(JacobianPseudoinverseTest, FewerJoints) {
+  Jacobian jacobian = Jacobian::Random("robot", 3, "test");
+  JacobianPseudoinverse pinv(jacobian);
+  EXPECT_TRUE(pinv.uses_svd());
+  EXPECT_TRUE(pinv.get_pseudoinverse().isApprox(jacobian.pseudoinverse()));
+}
+
+TEST(JacobianPseudoinverseTest, SolveWithoutAllocation) {
+  std::vector<std::string> joint_names{"a_long_joint_name_1", "a_long_joint_name_2", "a_long_joint_name_3",
+                                       "a_long_joint_name_4", "a_long_joint_name_5", "a_long_joint_name_6",
+                                       "a_long_joint_name_7"};
+  Eigen::MatrixXd data = Eigen::MatrixXd::Identity(6, 7) + 0.1 * Eigen::MatrixXd::Random(6, 7);
+  Jacobian jacobian("a_long_robot_name", joint_names, "test", data);
+  Eigen::MatrixXd singular_data = data;
+  singular_data.row(5) = singular_data.row(4);
+  Jacobian singular_jacobian("a_long_robot_name", joint_names, "test", singular_data);
+  JacobianPseudoinverse pinv(singular_jacobian);
+  CartesianTwist twist = CartesianTwist::Random("test");
+  JointVelocities velocities("a_long_robot_name", joint_names);
+  JointVelocities singular_velocities("a_long_robot_name", joint_names);
+  {
+    // any heap allocation aborts the test program as it is linked with the allocation check
+    RealtimeSection section;
+    pinv.solve(twist, singular_velocities);
+    pinv.compute(jacobian);
+    pinv.solve(twist, velocities);
+    pinv.solve(twist, velocities);
+  }
+  EXPECT_FALSE(pinv.uses_svd());
+  EXPECT_TRUE(velocities.data().isApprox(jacobian.pseudoinverse(twist).data()));
+  EXPECT_TRUE(singular_velocities.get_velocities().isApprox(
+      damped_pseudoinverse(singular_data, 0.1) * twist.get_twist(), 1e-6));
+}
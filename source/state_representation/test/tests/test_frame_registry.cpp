@@ -0,0 +1,113 @@
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include "state_representation/FrameRegistry.hpp"
+#include "state_representation/RealtimeSection.hpp"
+#include "state_representation/space/cartesian/CartesianPose.hpp"
+
+using namespace state_representation;
+
+TEST(FrameRegistryTest, RegisterNames) {
+  EXPECT_EQ(FrameReference().get_id(), FrameRegistry::EMPTY);
+  EXPECT_EQ(FrameReference("").get_id(), FrameRegistry::EMPTY);
+  EXPECT_EQ(FrameReference("world").get_id(), FrameRegistry::WORLD);
+  EXPECT_EQ(FrameRegistry::get_name(FrameRegistry::WORLD), "world");
+
+  auto size = FrameRegistry::size();
+  EXPECT_EQ(FrameRegistry::find_id("frame_registry_test_frame"), FrameRegistry::UNKNOWN);
+  EXPECT_EQ(FrameRegistry::size(), size);
+  {
+    FrameReference reference("frame_registry_test_frame");
+    EXPECT_EQ(FrameRegistry::size(), size + 1);
+    EXPECT_EQ(FrameRegistry::find_id("frame_registry_test_frame"), reference.get_id());
+    FrameReference other("frame_registry_test_frame");
+    EXPECT_EQ(other.get_id(), reference.get_id());
+    EXPECT_EQ(FrameRegistry::size(), size + 1);
+    EXPECT_EQ(reference.get_name(), "frame_registry_test_frame");
+  }
+  // the name is removed with its last reference
+  EXPECT_EQ(FrameRegistry::size(), size);
+  EXPECT_EQ(FrameRegistry::find_id("frame_registry_test_frame"), FrameRegistry::UNKNOWN);
+}
+
+TEST(FrameRegistryTest, ReleaseNames) {
+  auto size = FrameRegistry::size();
+  {
+    CartesianPose pose("frame_registry_released_frame", "frame_registry_released_reference");
+    auto id = pose.get_name_id();
+    EXPECT_EQ(FrameRegistry::size(), size + 2);
+    CartesianPose copy = pose;
+    pose.set_name("frame_registry_renamed_frame");
+    EXPECT_EQ(FrameRegistry::size(), size + 3);
+    EXPECT_EQ(copy.get_name(), "frame_registry_released_frame");
+    EXPECT_EQ(copy.get_name_id(), id);
+  }
+  EXPECT_EQ(FrameRegistry::size(), size);
+  // the identifiers of removed names are reused, such that registering and releasing names does not grow the registry
+  auto temporary_id = FrameReference("frame_registry_temporary_frame").get_id();
+  for (int i = 0; i < 10000; ++i) {
+    CartesianPose pose("frame_registry_temporary_frame_" + std::to_string(i), "world");
+    EXPECT_EQ(pose.get_name_id(), temporary_id);
+    EXPECT_EQ(FrameRegistry::size(), size + 1);
+  }
+  EXPECT_EQ(FrameRegistry::size(), size);
+}
+
+TEST(FrameRegistryTest, ConcurrentRegistration) {
+  std::vector<std::vector<FrameReference>> references(4);
+  std::vector<std::thread> threads;
+  for (std::size_t t = 0; t < references.size(); ++t) {
+    threads.emplace_back([&references, t] {
+      for (int i = 0; i < 3000; ++i) {
+        references.at(t).emplace_back("frame_registry_concurrent_" + std::to_string(i));
+        // the names registered and released concurrently by all threads keep consistent identifiers
+        FrameReference temporary("frame_registry_concurrent_temporary_" + std::to_string(i % 10));
+        EXPECT_EQ(temporary.get_name(), "frame_registry_concurrent_temporary_" + std::to_string(i % 10));
+      }
+    });
+  }
+  for (auto& thread: threads) {
+    thread.join();
+  }
+  for (int i = 0; i < 3000; ++i) {
+    EXPECT_EQ(references.at(0).at(i).get_name(), "frame_registry_concurrent_" + std::to_string(i));
+    for (std::size_t t = 1; t < references.size(); ++t) {
+      EXPECT_EQ(references.at(t).at(i).get_id(), references.at(0).at(i).get_id());
+    }
+  }
+  for (int i = 0; i < 10; ++i) {
+    EXPECT_EQ(FrameRegistry::find_id("frame_registry_concurrent_temporary_" + std::to_string(i)),
+              FrameRegistry::UNKNOWN);
+  }
+}
+
+TEST(FrameRegistryTest, StateFrames) {
+  CartesianPose pose("a_long_frame_name_that_does_not_fit_in_a_small_string", "a_long_reference_frame_name");
+  EXPECT_EQ(pose.get_name_id(), FrameRegistry::find_id(pose.get_name()));
+  EXPECT_EQ(pose.get_reference_frame_id(), FrameRegistry::find_id("a_long_reference_frame_name"));
+  pose.set_reference_frame("world");
+  EXPECT_EQ(pose.get_reference_frame_id(), FrameRegistry::WORLD);
+  EXPECT_EQ(FrameRegistry::find_id("a_long_reference_frame_name"), FrameRegistry::UNKNOWN);
+
+  CartesianPose default_pose;
+  EXPECT_EQ(default_pose.get_name_id(), FrameRegistry::EMPTY);
+  EXPECT_EQ(default_pose.get_reference_frame_id(), FrameRegistry::WORLD);
+}
+
+TEST(FrameRegistryTest, CompositionWithoutAllocation) {
+  auto parent = CartesianPose::Random("a_long_frame_name_that_does_not_fit_in_a_small_string", "world");
+  auto child = CartesianPose::Random("another_long_frame_name_for_the_child_frame",
+                                     "a_long_frame_name_that_does_not_fit_in_a_small_string");
+  CartesianState state = parent;
+  CartesianPose pose = parent;
+  {
+    // any heap allocation aborts the test program as it is linked with the allocation check
+    RealtimeSection section;
+    state *= child;
+    pose *= child;
+  }
+  EXPECT_EQ(state.get_name(), "another_long_frame_name_for_the_child_frame");
+  EXPECT_EQ(state.get_reference_frame(), "world");
+  EXPECT_EQ(pose.get_name_id(), child.get_name_id());
+}
@@ -0,0 +1,131 @@
+#include <gtest/gtest.h>
+
+#include "state_representation/RealtimeSection.hpp"
+#include "state_representation/filters/BiquadFilter.hpp"
+#include "state_representation/filters/JointKalmanFilter.hpp"
+#include "state_representation/filters/SavitzkyGolayDifferentiator.hpp"
+#include "state_representation/exceptions/EmptyStateException.hpp"
+#include "state_representation/exceptions/IncompatibleSizeException.hpp"
+#include "state_representation/exceptions/InvalidParameterException.hpp"
+
+using namespace state_representation;
+
+TEST(JointFiltersTest, FirstOrderLowPass) {
+  double dt = 0.001;
+  auto filter = BiquadFilter::FirstOrderLowPass(2, JointStateVariable::POSITIONS, 10, dt);
+  JointState state("robot", 2);
+  state.set_positions(Eigen::Vector2d(1, -1));
+  // the first sample initializes the filter to its steady state
+  filter.update(state);
+  EXPECT_TRUE(state.get_positions().isApprox(Eigen::Vector2d(1, -1)));
+  // step response of a first-order system reaching 1 - exp(-1) after a time constant
+  double time_constant = 1 / (2 * M_PI * 10);
+  int steps = static_cast<int>(std::round(time_constant / dt));
+  for (int i = 0; i < steps; ++i) {
+    state.set_positions(Eigen::Vector2d(2, 1));
+    filter.update(state);
+  }
+  EXPECT_NEAR(state.get_position(0), 2 - std::exp(-1), 1e-2);
+  EXPECT_NEAR(state.get_position(1), -1 + 2 * (1 - std::exp(-1)), 2e-2);
+  // the other variables are not filtered
+  EXPECT_TRUE(state.get_velocities().isZero());
+}
+
+TEST(JointFiltersTest, ButterworthLowPass) {
+  double dt = 0.001;
+  auto filter = BiquadFilter::ButterworthLowPass(3, JointStateVariable::ALL, 20, dt);
+  auto coefficients = filter.get_coefficients();
+  EXPECT_NEAR((coefficients(0) + coefficients(1) + coefficients(2)) / (1 + coefficients(3) + coefficients(4)), 1,
+              1e-12);
+  // a sinusoid at the cutoff frequency is attenuated by 3 dB, one at a decade above by 40 dB
+  for (double frequency: {20.0, 200.0}) {
+    filter.reset();
+    JointState state("robot", 3);
+    double amplitude = 0;
+    for (int i = 0; i < 2000; ++i) {
+      double value = std::sin(2 * M_PI * frequency * i * dt);
+      state.set_data(Eigen::VectorXd::Constant(12, value));
+      filter.update(state);
+      if (i >= 1000) {
+        amplitude = std::max(amplitude, state.data().cwiseAbs().maxCoeff());
+      }
+    }
+    EXPECT_NEAR(amplitude, frequency == 20 ? M_SQRT1_2 : 0.0101, 1e-2);
+  }
+  EXPECT_THROW(BiquadFilter::ButterworthLowPass(3, JointStateVariable::ALL, 500, dt),
+               exceptions::InvalidParameterException);
+  EXPECT_THROW(BiquadFilter::FirstOrderLowPass(3, JointStateVariable::ALL, 10, 0),
+               exceptions::InvalidParameterException);
+  JointState state("robot", 3);
+  EXPECT_THROW(filter.update(state), exceptions::EmptyStateException);
+  state = JointState::Random("robot", 2);
+  EXPECT_THROW(filter.update(state), exceptions::IncompatibleSizeException);
+}
+
+TEST(JointFiltersTest, SavitzkyGolayDifferentiator) {
+  double dt = 0.01;
+  SavitzkyGolayDifferentiator differentiator(2, 7, 2, dt);
+  EXPECT_EQ(differentiator.get_weights().rows(), 2);
+  EXPECT_NEAR(differentiator.get_weights().row(0).sum(), 0, 1e-9);
+  JointState state("robot", 2);
+  // quadratic positions are differentiated exactly once the window is filled
+  for (int i = 0; i < 20; ++i) {
+    double t = i * dt;
+    state.set_positions(Eigen::Vector2d(3 * t * t + t, -2 * t));
+    differentiator.update(state);
+  }
+  double t = 19 * dt;
+  EXPECT_NEAR(state.get_velocity(0), 6 * t + 1, 1e-9);
+  EXPECT_NEAR(state.get_velocity(1), -2, 1e-9);
+  EXPECT_NEAR(state.get_acceleration(0), 6, 1e-6);
+  EXPECT_NEAR(state.get_acceleration(1), 0, 1e-6);
+
+  // the window is filled with the first sample after a reset
+  differentiator.reset();
+  differentiator.update(state);
+  EXPECT_NEAR(state.get_velocity(0), 0, 1e-9);
+
+  EXPECT_THROW(SavitzkyGolayDifferentiator(2, 2, 2, dt), exceptions::IncompatibleSizeException);
+  EXPECT_THROW(SavitzkyGolayDifferentiator(2, 5, 2, -dt), exceptions::InvalidParameterException);
+}
+
+TEST(JointFiltersTest, JointKalmanFilter) {
+  double dt = 0.001;
+  JointKalmanFilter filter(2, dt, 10, 1e-6 / 3);
+  JointState state("robot", 2);
+  std::srand(0);
+  // noisy positions of joints moving with constant accelerations
+  for (int i = 0; i < 3000; ++i) {
+    double t = i * dt;
+    Eigen::Vector2d noise = 1e-3 * Eigen::Vector2d::Random();
+    state.set_positions(Eigen::Vector2d(0.5 * t * t, 1 - 2 * t) + noise);
+    filter.update(state);
+  }
+  double t = 2999 * dt;
+  EXPECT_NEAR(state.get_position(0), 0.5 * t * t, 2e-3);
+  EXPECT_NEAR(state.get_velocity(0), t, 5e-2);
+  EXPECT_NEAR(state.get_velocity(1), -2, 5e-2);
+  EXPECT_NEAR(state.get_acceleration(0), 1, 0.5);
+  // the gain converges to the steady state of the filter
+  EXPECT_GT(filter.get_gain()(0), 0);
+  EXPECT_LT(filter.get_gain()(0), 1);
+  EXPECT_THROW(JointKalmanFilter(2, dt, 1, 0), exceptions::InvalidParameterException);
+}
+
+TEST(JointFiltersTest, UpdateWithoutAllocation) {
+  auto low_pass = BiquadFilter::ButterworthLowPass(7, JointStateVariable::POSITIONS, 10, 0.001);
+  SavitzkyGolayDifferentiator differentiator(7, 9, 2, 0.001);
+  JointKalmanFilter kalman_filter(7, 0.001, 1, 1e-6);
+  auto state = JointState::Random("robot", 7);
+  auto timestamp = state.get_timestamp();
+  {
+    // any heap allocation aborts the test program as it is linked with the allocation check
+    RealtimeSection section;
+    for (int i = 0; i < 10; ++i) {
+      low_pass.update(state);
+      differentiator.update(state);
+      kalman_filter.update(state);
+    }
+  }
+  EXPECT_EQ(state.get_timestamp(), timestamp);
+}
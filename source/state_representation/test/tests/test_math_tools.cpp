@@ -0,0 +1,98 @@
+#include <gtest/gtest.h>
+
+#include "state_representation/MathTools.hpp"
+#include "state_representation/exceptions/IncompatibleSizeException.hpp"
+
+using namespace state_representation;
+
+static Eigen::Matrix4Xd random_quaternions(Eigen::Index size) {
+  Eigen::Matrix4Xd quaternions(4, size);
+  for (Eigen::Index i = 0; i < size; ++i) {
+    quaternions.col(i) = Eigen::Quaterniond::UnitRandom().coeffs();
+  }
+  // special cases of the identity, opposite and almost identical quaternions
+  quaternions.col(0) = Eigen::Quaterniond::Identity().coeffs();
+  quaternions.col(1) = -Eigen::Quaterniond::Identity().coeffs();
+  quaternions.col(2) = Eigen::Quaterniond(Eigen::AngleAxisd(1e-6, Eigen::Vector3d::UnitX())).coeffs();
+  quaternions.col(3) = Eigen::Quaterniond(Eigen::AngleAxisd(M_PI, Eigen::Vector3d::UnitZ())).coeffs();
+  return quaternions;
+}
+
+TEST(MathToolsTest, BatchLog) {
+  Eigen::Matrix4Xd quaternions = random_quaternions(37);
+  Eigen::Matrix4Xd result(4, quaternions.cols());
+  math_tools::log(quaternions, result);
+  for (Eigen::Index i = 0; i < quaternions.cols(); ++i) {
+    auto expected = math_tools::log(Eigen::Quaterniond(quaternions.col(i)));
+    EXPECT_TRUE(result.col(i).isApprox(expected.coeffs(), 1e-12) || expected.coeffs().isZero())
+              << i << ": " << result.col(i).transpose() << " != " << expected.coeffs().transpose();
+  }
+  math_tools::log(quaternions, quaternions);
+  EXPECT_TRUE(quaternions.isApprox(result));
+  Eigen::Matrix4Xd wrong_size(4, 3);
+  EXPECT_THROW(math_tools::log(quaternions, wrong_size), exceptions::IncompatibleSizeException);
+}
+
+TEST(MathToolsTest, BatchExp) {
+  Eigen::Matrix4Xd logs = 3 * Eigen::Matrix4Xd::Random(4, 37);
+  logs.row(3).setZero();
+  logs.col(0).setZero();
+  logs.col(1) << 1e-5, 0, 0, 0;
+  logs.col(2) << 1e4, -2e4, 0, 0;
+  logs.col(3) << 1e6, 0, 0, 0;
+  for (double lambda: {1.0, 0.3, -2.5}) {
+    Eigen::Matrix4Xd result(4, logs.cols());
+    math_tools::exp(logs, result, lambda);
+    for (Eigen::Index i = 0; i < logs.cols(); ++i) {
+      auto expected = math_tools::exp(Eigen::Quaterniond(logs.col(i)), lambda);
+      EXPECT_TRUE(result.col(i).isApprox(expected.coeffs(), 1e-12))
+                << i << ": " << result.col(i).transpose() << " != " << expected.coeffs().transpose();
+    }
+  }
+}
+
+TEST(MathToolsTest, BatchMultiply) {
+  Eigen::Matrix4Xd lhs = random_quaternions(21);
+  Eigen::Matrix4Xd rhs = random_quaternions(21).rowwise().reverse();
+  Eigen::Matrix4Xd result(4, lhs.cols());
+  math_tools::multiply(lhs, rhs, result);
+  for (Eigen::Index i = 0; i < lhs.cols(); ++i) {
+    auto expected = Eigen::Quaterniond(lhs.col(i)) * Eigen::Quaterniond(rhs.col(i));
+    EXPECT_TRUE(result.col(i).isApprox(expected.coeffs()));
+  }
+  Eigen::Matrix4Xd wrong_size(4, 3);
+  EXPECT_THROW(math_tools::multiply(lhs, wrong_size, result), exceptions::IncompatibleSizeException);
+
+  // a contiguous array of quaternions can be used directly
+  std::vector<Eigen::Quaterniond> quaternions;
+  for (int i = 0; i < 5; ++i) {
+    quaternions.push_back(Eigen::Quaterniond::UnitRandom());
+  }
+  auto expected = quaternions;
+  Eigen::Map<Eigen::Matrix4Xd> array(quaternions.front().coeffs().data(), 4, 5);
+  math_tools::multiply(array, array, array);
+  for (int i = 0; i < 5; ++i) {
+    EXPECT_TRUE(quaternions.at(i).coeffs().isApprox((expected.at(i) * expected.at(i)).coeffs()));
+  }
+}
+
+TEST(MathToolsTest, BatchSlerp) {
+  Eigen::Matrix4Xd start = random_quaternions(41);
+  Eigen::Matrix4Xd end = random_quaternions(41);
+  end.col(0) = start.col(0);
+  end.col(1) = -start.col(1);
+  end.col(5) = (Eigen::Quaterniond(start.col(5)) * Eigen::AngleAxisd(1e-9, Eigen::Vector3d::UnitY())).coeffs();
+  Eigen::VectorXd t = Eigen::VectorXd::Random(start.cols()).cwiseAbs();
+  t(0) = 0;
+  t(1) = 1;
+  t(2) = -0.5;
+  t(3) = 1.5;
+  Eigen::Matrix4Xd result(4, start.cols());
+  math_tools::slerp(start, end, t, result);
+  for (Eigen::Index i = 0; i < start.cols(); ++i) {
+    auto expected = Eigen::Quaterniond(start.col(i)).slerp(t(i), Eigen::Quaterniond(end.col(i)));
+    EXPECT_TRUE(result.col(i).isApprox(expected.coeffs(), 1e-12))
+              << i << ": " << result.col(i).transpose() << " != " << expected.coeffs().transpose();
+  }
+  EXPECT_THROW(math_tools::slerp(start, end, t.head(3), result), exceptions::IncompatibleSizeException);
+}
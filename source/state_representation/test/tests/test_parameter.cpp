@@ -167,6 +167,7 @@ TYPED_TEST_P(ParameterTest, Construction) {
     EXPECT_FALSE(param.is_empty());
     EXPECT_TRUE(param);
     expect_values_equal(param.get_value(), std::get<0>(test_case));
+    EXPECT_EQ(&param.get_value_unchecked(), &param.get_value());
 
     new_param = param;
     EXPECT_FALSE(new_param.is_empty());
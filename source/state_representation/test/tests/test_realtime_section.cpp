@@ -0,0 +1,137 @@
+#include <array>
+#include <gtest/gtest.h>
+
+#include "state_representation/DigitalIOState.hpp"
+#include "state_representation/RealtimeSection.hpp"
+#include "state_representation/geometry/Ellipsoid.hpp"
+#include "state_representation/parameters/Parameter.hpp"
+#include "state_representation/space/cartesian/CartesianPose.hpp"
+#include "state_representation/space/joint/JointPositions.hpp"
+#include "state_representation/space/Jacobian.hpp"
+#include "state_representation/trajectories/Trajectory.hpp"
+
+using namespace state_representation;
+
+TEST(RealtimeSectionTest, Nesting) {
+  EXPECT_FALSE(RealtimeSection::is_active());
+  {
+    RealtimeSection section;
+    EXPECT_TRUE(RealtimeSection::is_active());
+    {
+      RealtimeSection nested;
+      EXPECT_TRUE(RealtimeSection::is_active());
+    }
+    EXPECT_TRUE(RealtimeSection::is_active());
+  }
+  EXPECT_FALSE(RealtimeSection::is_active());
+}
+
+TEST(RealtimeSectionTest, AssignmentWithoutAllocation) {
+  std::vector<std::string> joint_names{"a_long_joint_name_1", "a_long_joint_name_2", "a_long_joint_name_3"};
+  JointPositions input = JointPositions::Random("a_long_robot_name", joint_names);
+  JointPositions output("a_long_robot_name", joint_names);
+  CartesianState pose = CartesianState::Random("a_long_frame_name", "a_long_reference_frame");
+  CartesianState pose_output("a_long_frame_name", "a_long_reference_frame");
+  Jacobian jacobian = Jacobian::Random("a_long_robot_name", joint_names, "a_long_frame_name");
+  Jacobian jacobian_output("a_long_robot_name", joint_names, "a_long_frame_name");
+  {
+    // any heap allocation aborts the test program as it is linked with the allocation check
+    RealtimeSection section;
+    output = input;
+    output += input;
+    pose_output = pose;
+    jacobian_output = jacobian;
+  }
+  EXPECT_TRUE(output.data().isApprox(2 * input.data()));
+  EXPECT_TRUE(pose_output.data().isApprox(pose.data()));
+  EXPECT_TRUE(jacobian_output.data().isApprox(jacobian.data()));
+}
+
+TEST(RealtimeSectionTest, MoveWithoutAllocation) {
+  static_assert(std::is_nothrow_move_constructible_v<JointPositions>);
+  static_assert(std::is_nothrow_move_assignable_v<JointPositions>);
+  static_assert(std::is_nothrow_move_constructible_v<CartesianPose>);
+  static_assert(std::is_nothrow_move_assignable_v<CartesianPose>);
+  static_assert(std::is_nothrow_move_constructible_v<Jacobian>);
+
+  std::vector<std::string> joint_names{"a_long_joint_name_1", "a_long_joint_name_2", "a_long_joint_name_3"};
+  JointPositions positions = JointPositions::Random("a_long_robot_name", joint_names);
+  Eigen::VectorXd expected_positions = positions.data();
+  CartesianPose pose = CartesianPose::Random("a_long_frame_name", "a_long_reference_frame");
+  Eigen::VectorXd expected_pose = pose.data();
+  Jacobian jacobian = Jacobian::Random("a_long_robot_name", joint_names, "a_long_frame_name");
+  Parameter<JointPositions> parameter("a_long_parameter_name", positions);
+  Ellipsoid ellipsoid("a_long_ellipsoid_name", "a_long_reference_frame");
+  DigitalIOState io = DigitalIOState::Random("a_long_io_name", {"a_long_io_name_1", "a_long_io_name_2"});
+  Trajectory<JointPositions> trajectory("a_long_trajectory_name");
+  trajectory.add_point(positions, std::chrono::seconds(1));
+  std::vector<JointPositions> buffer;
+  buffer.reserve(2);
+
+  JointPositions moved_positions;
+  CartesianPose moved_pose;
+  Jacobian moved_jacobian;
+  {
+    // any heap allocation aborts the test program as it is linked with the allocation check
+    RealtimeSection section;
+    moved_positions = std::move(positions);
+    JointPositions constructed_positions(std::move(moved_positions));
+    buffer.push_back(std::move(constructed_positions));
+    moved_pose = std::move(pose);
+    CartesianPose constructed_pose(std::move(moved_pose));
+    moved_pose = std::move(constructed_pose);
+    moved_jacobian = std::move(jacobian);
+    Parameter<JointPositions> moved_parameter(std::move(parameter));
+    parameter = std::move(moved_parameter);
+    Ellipsoid moved_ellipsoid(std::move(ellipsoid));
+    ellipsoid = std::move(moved_ellipsoid);
+    DigitalIOState moved_io(std::move(io));
+    io = std::move(moved_io);
+    Trajectory<JointPositions> moved_trajectory(std::move(trajectory));
+    trajectory = std::move(moved_trajectory);
+  }
+
+  EXPECT_EQ(buffer[0].get_type(), StateType::JOINT_POSITIONS);
+  EXPECT_EQ(buffer[0].get_names(), joint_names);
+  EXPECT_TRUE(buffer[0].data().cwiseEqual(expected_positions).all());
+  EXPECT_TRUE(positions.is_empty());
+  EXPECT_EQ(positions.get_size(), 0);
+  EXPECT_TRUE(moved_positions.is_empty());
+  EXPECT_EQ(moved_pose.get_type(), StateType::CARTESIAN_POSE);
+  EXPECT_EQ(moved_pose.get_reference_frame(), "a_long_reference_frame");
+  EXPECT_TRUE(moved_pose.data().cwiseEqual(expected_pose).all());
+  EXPECT_TRUE(pose.is_empty());
+  EXPECT_EQ(moved_jacobian.get_type(), StateType::JACOBIAN);
+  EXPECT_EQ(moved_jacobian.cols(), 3);
+  EXPECT_TRUE(jacobian.is_empty());
+  EXPECT_EQ(jacobian.cols(), 0);
+  EXPECT_EQ(parameter.get_type(), StateType::PARAMETER);
+  EXPECT_TRUE(parameter.get_value().data().cwiseEqual(expected_positions).all());
+  EXPECT_EQ(ellipsoid.get_type(), StateType::GEOMETRY_ELLIPSOID);
+  EXPECT_EQ(io.get_type(), StateType::DIGITAL_IO_STATE);
+  EXPECT_EQ(io.get_size(), 2);
+  EXPECT_EQ(trajectory.get_type(), StateType::TRAJECTORY);
+  EXPECT_EQ(trajectory.get_size(), 1);
+}
+
+TEST(RealtimeSectionTest, AllocationAborts) {
+  EXPECT_DEATH({
+    RealtimeSection section;
+    JointPositions state("robot", 3);
+  }, "heap allocation inside a real-time section");
+}
+
+TEST(RealtimeSectionTest, SharedStateFromMemoryResource) {
+  std::array<std::byte, 1024> buffer{};
+  std::pmr::monotonic_buffer_resource resource(buffer.data(), buffer.size(), std::pmr::null_memory_resource());
+  auto state = make_shared_state(CartesianState::Random("test"), &resource);
+  auto address = reinterpret_cast<std::byte*>(state.get());
+  EXPECT_TRUE(address >= buffer.data() && address < buffer.data() + buffer.size());
+  EXPECT_EQ(state->get_type(), StateType::CARTESIAN_STATE);
+  // the resource does not fall back on the heap once the buffer is exhausted
+  EXPECT_THROW({
+    for (int i = 0; i < 10; ++i) {
+      make_shared_state(CartesianState::Identity("test"), &resource);
+    }
+  }, std::bad_alloc);
+}
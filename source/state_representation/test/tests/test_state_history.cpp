@@ -0,0 +1,126 @@
+#include <gtest/gtest.h>
+
+#include "state_representation/RealtimeSection.hpp"
+#include "state_representation/trajectories/StateHistory.hpp"
+#include "state_representation/space/cartesian/CartesianPose.hpp"
+#include "state_representation/space/joint/JointPositions.hpp"
+#include "state_representation/exceptions/EmptyStateException.hpp"
+#include "state_representation/exceptions/ExtrapolationException.hpp"
+#include "state_representation/exceptions/IncompatibleReferenceFramesException.hpp"
+#include "state_representation/exceptions/IncompatibleSizeException.hpp"
+#include "state_representation/exceptions/IncompatibleStatesException.hpp"
+
+using namespace state_representation;
+using namespace std::chrono_literals;
+
+TEST(StateHistoryTest, PushAndOverwrite) {
+  StateHistory<JointPositions> history(JointPositions::Zero("robot", 2), 3);
+  EXPECT_TRUE(history.empty());
+  EXPECT_EQ(history.get_capacity(), 3);
+  EXPECT_EQ(history.get_window(), 3);
+  EXPECT_EQ(history.get_dimension(), 8);
+
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < 5; ++i) {
+    history.push(JointPositions("robot", Eigen::Vector2d(i, -i)), start + i * 10ms);
+  }
+  EXPECT_EQ(history.size(), 3);
+  for (std::size_t i = 0; i < history.size(); ++i) {
+    EXPECT_EQ(history.get_time(i), start + (i + 2) * 10ms);
+    EXPECT_EQ(history.get_data(i)(0), static_cast<double>(i + 2));
+    auto sample = history.get_state(i);
+    EXPECT_EQ(sample.get_timestamp(), history.get_time(i));
+    EXPECT_EQ(sample.get_position(1), -static_cast<double>(i + 2));
+  }
+  EXPECT_THROW(history.get_state(3), std::out_of_range);
+
+  EXPECT_THROW(history.push(JointPositions("robot", 2)), exceptions::EmptyStateException);
+  EXPECT_THROW(history.push(JointPositions::Zero("robot", 3), start + 1s), exceptions::IncompatibleSizeException);
+  EXPECT_THROW(history.push(JointPositions::Zero("robot", 2), start), exceptions::IncompatibleStatesException);
+  JointPositions renamed("robot", std::vector<std::string>{"a", "b"}, Eigen::Vector2d(1, 2));
+  EXPECT_THROW(history.push(renamed, start + 1s), exceptions::IncompatibleStatesException);
+  EXPECT_THROW(history.get_state(0, renamed), exceptions::IncompatibleStatesException);
+  EXPECT_THROW(StateHistory<JointPositions>(JointPositions::Zero("robot", 2), 3, 4),
+               exceptions::IncompatibleSizeException);
+
+  history.clear();
+  EXPECT_TRUE(history.empty());
+  EXPECT_THROW(history.interpolate(start), exceptions::EmptyStateException);
+}
+
+TEST(StateHistoryTest, InterpolateJointState) {
+  StateHistory<JointPositions> history(JointPositions::Zero("robot", 2), 10);
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < 10; ++i) {
+    history.push(JointPositions("robot", Eigen::Vector2d(i, 2 * i)), start + i * 10ms);
+  }
+  EXPECT_EQ(history.get_index(start + 35ms), 3);
+  EXPECT_EQ(history.get_index(start + 40ms), 4);
+  auto state = history.interpolate(start + 35ms);
+  EXPECT_EQ(state.get_name(), "robot");
+  EXPECT_EQ(state.get_timestamp(), start + 35ms);
+  EXPECT_TRUE(state.get_positions().isApprox(Eigen::Vector2d(3.5, 7)));
+  EXPECT_TRUE(history.interpolate(start + 1s).get_positions().isApprox(Eigen::Vector2d(9, 18)));
+  EXPECT_THROW(history.interpolate(start - 1ms), exceptions::ExtrapolationException);
+}
+
+TEST(StateHistoryTest, InterpolateCartesianState) {
+  StateHistory<CartesianPose> history(CartesianPose::Identity("tool", "base"), 4);
+  auto start = std::chrono::steady_clock::now();
+  history.push(CartesianPose("tool", Eigen::Vector3d(0, 0, 0), Eigen::Quaterniond::Identity(), "base"), start);
+  history.push(
+      CartesianPose(
+          "tool", Eigen::Vector3d(2, 0, 0), Eigen::Quaterniond(Eigen::AngleAxisd(M_PI / 2, Eigen::Vector3d::UnitX())),
+          "base"
+      ), start + 1s
+  );
+  auto pose = history.interpolate(start + 500ms);
+  EXPECT_EQ(pose.get_reference_frame(), "base");
+  EXPECT_TRUE(pose.get_position().isApprox(Eigen::Vector3d(1, 0, 0)));
+  EXPECT_TRUE(pose.get_orientation().isApprox(
+      Eigen::Quaterniond(Eigen::AngleAxisd(M_PI / 4, Eigen::Vector3d::UnitX()))));
+  EXPECT_THROW(history.push(CartesianPose::Random("tool", "world"), start + 2s),
+               exceptions::IncompatibleReferenceFramesException);
+}
+
+TEST(StateHistoryTest, WindowStatistics) {
+  StateHistory<JointPositions> history(JointPositions::Zero("robot", 2), 20, 5);
+  auto start = std::chrono::steady_clock::now();
+  // positions moving at 2 and -1 rad/s, sampled every 10 ms
+  for (int i = 0; i < 100; ++i) {
+    double t = 0.01 * i;
+    history.push(JointPositions("robot", Eigen::Vector2d(1 + 2 * t, -t)), start + i * 10ms);
+    auto count = std::min(i + 1, 5);
+    double mean_t = 0.01 * (i - (count - 1) / 2.0);
+    EXPECT_NEAR(history.get_mean()(0), 1 + 2 * mean_t, 1e-9);
+    EXPECT_NEAR(history.get_mean()(1), -mean_t, 1e-9);
+    if (i > 0) {
+      EXPECT_NEAR(history.get_derivative()(0), 2, 1e-6);
+      EXPECT_NEAR(history.get_derivative()(1), -1, 1e-6);
+    }
+    // the velocities are zero for all the samples
+    EXPECT_NEAR(history.get_derivative()(2), 0, 1e-9);
+  }
+}
+
+TEST(StateHistoryTest, PushAndInterpolateWithoutAllocation) {
+  StateHistory<JointPositions> joint_history(JointPositions::Zero("robot", 7), 100);
+  StateHistory<CartesianPose> cartesian_history(CartesianPose::Identity("tool"), 100);
+  auto positions = JointPositions::Random("robot", 7);
+  auto pose = CartesianPose::Random("tool");
+  auto joint_result = JointPositions::Zero("robot", 7);
+  auto cartesian_result = CartesianPose::Identity("tool");
+  auto start = std::chrono::steady_clock::now();
+  {
+    // any heap allocation aborts the test program as it is linked with the allocation check
+    RealtimeSection section;
+    for (int i = 0; i < 150; ++i) {
+      joint_history.push(positions, start + i * 1ms);
+      cartesian_history.push(pose, start + i * 1ms);
+    }
+    joint_history.interpolate(start + 120500us, joint_result);
+    cartesian_history.interpolate(start + 120500us, cartesian_result);
+  }
+  EXPECT_TRUE(joint_result.get_positions().isApprox(positions.get_positions()));
+  EXPECT_TRUE(cartesian_result.get_position().isApprox(pose.get_position()));
+}
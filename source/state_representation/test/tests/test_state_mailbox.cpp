@@ -0,0 +1,131 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+
+#include "state_representation/RealtimeSection.hpp"
+#include "state_representation/StateMailbox.hpp"
+#include "state_representation/space/cartesian/CartesianPose.hpp"
+#include "state_representation/space/joint/JointPositions.hpp"
+#include "state_representation/exceptions/IncompatibleSizeException.hpp"
+#include "state_representation/exceptions/IncompatibleStatesException.hpp"
+
+using namespace state_representation;
+using namespace std::chrono_literals;
+
+TEST(StateMailboxTest, CartesianState) {
+  StateMailbox<CartesianState> mailbox(CartesianState("robot"), 2);
+  EXPECT_EQ(mailbox.get_readers(), 2);
+  EXPECT_FALSE(mailbox.has_new_data());
+  EXPECT_TRUE(mailbox.read().is_empty());
+
+  auto state = CartesianState::Random("robot", "base");
+  mailbox.write(state);
+  EXPECT_TRUE(mailbox.has_new_data(0));
+  EXPECT_TRUE(mailbox.has_new_data(1));
+  const auto& latest = mailbox.read();
+  EXPECT_FALSE(mailbox.has_new_data(0));
+  EXPECT_TRUE(mailbox.has_new_data(1));
+  EXPECT_FALSE(latest.is_empty());
+  EXPECT_EQ(latest.get_reference_frame(), "base");
+  EXPECT_EQ(latest.get_timestamp(), state.get_timestamp());
+  EXPECT_TRUE(latest.data().isApprox(state.data()));
+
+  CartesianState copy("robot");
+  EXPECT_TRUE(mailbox.read(copy, 1));
+  EXPECT_FALSE(mailbox.read(copy, 1));
+  EXPECT_TRUE(copy.data().isApprox(state.data()));
+  EXPECT_EQ(copy.get_timestamp(), state.get_timestamp());
+  EXPECT_THROW(mailbox.read(2), std::out_of_range);
+}
+
+TEST(StateMailboxTest, LatestValue) {
+  StateMailbox<CartesianPose> mailbox(CartesianPose::Identity("robot"));
+  for (int i = 0; i < 5; ++i) {
+    mailbox.write(CartesianPose("robot", i, 0, 0));
+  }
+  EXPECT_EQ(mailbox.read().get_position().x(), 4);
+  EXPECT_EQ(mailbox.read().get_position().x(), 4);
+  mailbox.write(CartesianPose("robot", 5, 0, 0));
+  EXPECT_EQ(mailbox.read().get_position().x(), 5);
+}
+
+TEST(StateMailboxTest, JointState) {
+  auto prototype = JointPositions::Zero("robot", 3);
+  StateMailbox<JointPositions> mailbox(prototype);
+  JointPositions positions("robot", Eigen::Vector3d(1, 2, 3));
+  mailbox.write(positions);
+  EXPECT_EQ(mailbox.read().get_names(), prototype.get_names());
+  EXPECT_TRUE(mailbox.read().get_positions().isApprox(positions.get_positions()));
+  EXPECT_EQ(mailbox.read().get_timestamp(), positions.get_timestamp());
+
+  EXPECT_THROW(mailbox.write(JointPositions::Zero("robot", 4)), exceptions::IncompatibleSizeException);
+  auto wrong_size = JointPositions::Zero("robot", 2);
+  EXPECT_THROW(mailbox.read(wrong_size), exceptions::IncompatibleSizeException);
+  // the joint names are not copied, such that states with other joint names are rejected
+  JointPositions renamed("robot", std::vector<std::string>{"a", "b", "c"}, Eigen::Vector3d(1, 2, 3));
+  EXPECT_THROW(mailbox.write(renamed), exceptions::IncompatibleStatesException);
+  EXPECT_THROW(mailbox.read(renamed), exceptions::IncompatibleStatesException);
+}
+
+TEST(StateMailboxTest, StaleData) {
+  StateMailbox<JointPositions> mailbox(JointPositions::Zero("robot", 3));
+  mailbox.write(JointPositions::Random("robot", 3));
+  std::this_thread::sleep_for(20ms);
+  // the timestamp of the written state is kept, such that its age is the age of the data
+  EXPECT_TRUE(mailbox.read().is_deprecated(10ms));
+  mailbox.write(JointPositions::Random("robot", 3));
+  EXPECT_FALSE(mailbox.read().is_deprecated(10s));
+}
+
+TEST(StateMailboxTest, ReadWriteWithoutAllocation) {
+  StateMailbox<JointPositions> joint_mailbox(JointPositions::Zero("robot", 7));
+  StateMailbox<CartesianPose> cartesian_mailbox(CartesianPose::Identity("robot"));
+  auto positions = JointPositions::Random("robot", 7);
+  auto pose = CartesianPose::Random("robot");
+  auto joint_copy = JointPositions::Zero("robot", 7);
+  CartesianPose cartesian_copy("robot");
+  {
+    // any heap allocation aborts the test program as it is linked with the allocation check
+    RealtimeSection section;
+    joint_mailbox.write(positions);
+    cartesian_mailbox.write(pose);
+    joint_mailbox.read(joint_copy);
+    cartesian_mailbox.read(cartesian_copy);
+  }
+  EXPECT_TRUE(joint_copy.get_positions().isApprox(positions.get_positions()));
+  EXPECT_TRUE(cartesian_copy.get_position().isApprox(pose.get_position()));
+}
+
+TEST(StateMailboxTest, ConcurrentReaders) {
+  StateMailbox<JointPositions> mailbox(JointPositions::Zero("robot", 7), 2);
+  std::atomic<bool> done(false);
+  std::atomic<int> inconsistent(0);
+  std::vector<std::thread> readers;
+  for (std::size_t r = 0; r < mailbox.get_readers(); ++r) {
+    readers.emplace_back([&mailbox, &done, &inconsistent, r] {
+      auto positions = JointPositions::Zero("robot", 7);
+      double last = 0;
+      while (!done) {
+        mailbox.read(positions, r);
+        const auto& values = positions.get_positions();
+        // a torn read would mix the values of different writes, and values never go back in time
+        if ((values.array() != values(0)).any() || values(0) < last) {
+          ++inconsistent;
+        }
+        last = values(0);
+      }
+    });
+  }
+  auto positions = JointPositions::Zero("robot", 7);
+  for (int i = 1; i <= 20000; ++i) {
+    positions.set_positions(Eigen::VectorXd::Constant(7, i));
+    mailbox.write(positions);
+  }
+  done = true;
+  for (auto& reader: readers) {
+    reader.join();
+  }
+  EXPECT_EQ(inconsistent, 0);
+  EXPECT_EQ(mailbox.read(0).get_positions()(0), 20000);
+}
@@ -2,13 +2,15 @@
 #include <fstream>
 #include <unistd.h>
 #include "state_representation/trajectories/Trajectory.hpp"
+#include "state_representation/trajectories/TrajectoryInterpolator.hpp"
 #include "state_representation/space/cartesian/CartesianState.hpp"
+#include "state_representation/space/joint/JointPositions.hpp"
 #include "state_representation/space/joint/JointState.hpp"
 
 TEST(TrajectoryTest, CreateTrajectory) {
   state_representation::Trajectory<state_representation::JointState> trajectory;
-  std::deque<state_representation::JointState> points = trajectory.get_points();
-  std::deque<std::chrono::nanoseconds> times = trajectory.get_times();
+  std::vector<state_representation::JointState> points = trajectory.get_points();
+  std::vector<std::chrono::nanoseconds> times = trajectory.get_times();
   EXPECT_TRUE(points.empty());
   EXPECT_TRUE(times.empty());
 }
@@ -17,8 +19,8 @@ TEST(TrajectoryTest, AddPoint) {
   state_representation::Trajectory<state_representation::JointState> trajectory;
   state_representation::JointState point("robot", 1);
 
-  std::deque<state_representation::JointState> points = trajectory.get_points();
-  std::deque<std::chrono::nanoseconds> times = trajectory.get_times();
+  std::vector<state_representation::JointState> points = trajectory.get_points();
+  std::vector<std::chrono::nanoseconds> times = trajectory.get_times();
 
   unsigned int prev_size_points = points.size();
   unsigned int prev_size_times = times.size();
@@ -49,8 +51,8 @@ TEST(TrajectoryTest, ClearPoint) {
   point.set_positions(positions);
   trajectory.add_point(point, period);
 
-  std::deque<state_representation::JointState> points = trajectory.get_points();
-  std::deque<std::chrono::nanoseconds> times = trajectory.get_times();
+  std::vector<state_representation::JointState> points = trajectory.get_points();
+  std::vector<std::chrono::nanoseconds> times = trajectory.get_times();
 
   unsigned int size_points = points.size();
   unsigned int size_times = times.size();
@@ -88,42 +90,213 @@ TEST(TrajectoryTest, OverloadIndex) {
   EXPECT_TRUE(point1.second == 2 * period);
 }
 
-// TEST(TrajectoryTest, InsertPoint)
-// {
-// 	state_representation::Trajectory<state_representation::JointState> trajectory;
-// 	state_representation::JointState point("robot", 1);
-
-// 	std::chrono::nanoseconds period(100);
-// 	Eigen::ArrayXd positions(1);
-// 	positions << 0.2;
-// 	point.set_positions(positions);
-// 	trajectory.add_point(point, period);
-// 	positions << 0.7;
-// 	point.set_positions(positions);
-// 	trajectory.add_point(point, period);
-
-// 	std::pair<state_representation::JointState, std::chrono::nanoseconds> last_point = trajectory[1];
-// 	std::deque<state_representation::JointState> points = trajectory.get_points();
-// 	std::deque<std::chrono::nanoseconds> times = trajectory.get_times();
-
-// 	EXPECT_TRUE(points.size() == 2);
-// 	EXPECT_TRUE(times.size() == 2);
-// 	EXPECT_TRUE(last_point.first.get_positions()[0] == 0.7);
-// 	EXPECT_TRUE(last_point.second == 2*period);
-
-// 	positions << 0.8;
-// 	point.set_positions(positions);
-// 	trajectory.insert_point(point, period, 1);
-
-// 	std::pair<state_representation::JointState, std::chrono::nanoseconds> inserted_point = trajectory[1];
-// 	last_point = trajectory[2];
-// 	points = trajectory.get_points();
-// 	times = trajectory.get_times();
-
-// 	EXPECT_TRUE(points.size() == 3);
-// 	EXPECT_TRUE(times.size() == 3);
-// 	EXPECT_TRUE(inserted_point.first.get_positions()[0] == 0.8);
-// 	EXPECT_TRUE(inserted_point.second == 2*period);
-// 	EXPECT_TRUE(last_point.first.get_positions()[0] == 0.7);
-// 	EXPECT_TRUE(last_point.second == 3*period);
-// }
+TEST(TrajectoryTest, InsertPoint) {
+  state_representation::Trajectory<state_representation::JointState> trajectory;
+  state_representation::JointState point("robot", 1);
+
+  std::chrono::nanoseconds period(100);
+  Eigen::ArrayXd positions(1);
+  positions << 0.2;
+  point.set_positions(positions);
+  trajectory.add_point(point, period);
+  positions << 0.7;
+  point.set_positions(positions);
+  trajectory.add_point(point, period);
+
+  positions << 0.8;
+  point.set_positions(positions);
+  trajectory.insert_point(point, period, 1);
+
+  std::pair<state_representation::JointState, std::chrono::nanoseconds> inserted_point = trajectory[1];
+  std::pair<state_representation::JointState, std::chrono::nanoseconds> last_point = trajectory[2];
+
+  EXPECT_EQ(trajectory.get_size(), 3);
+  EXPECT_EQ(trajectory.get_times().size(), 3);
+  EXPECT_EQ(inserted_point.first.get_positions()[0], 0.8);
+  EXPECT_EQ(inserted_point.second, 2 * period);
+  EXPECT_EQ(last_point.first.get_positions()[0], 0.7);
+  EXPECT_EQ(last_point.second, 3 * period);
+  EXPECT_THROW(trajectory.insert_point(point, period, 4), std::out_of_range);
+}
+
+TEST(TrajectoryTest, PointViews) {
+  state_representation::Trajectory<state_representation::JointState> trajectory;
+  auto point = state_representation::JointState::Random("robot", 3);
+  trajectory.add_point(point, std::chrono::milliseconds(10));
+  trajectory.add_point(state_representation::JointState::Random("robot", 3), std::chrono::milliseconds(10));
+
+  EXPECT_EQ(trajectory.get_data().rows(), point.data().size());
+  EXPECT_EQ(trajectory.get_data().cols(), 2);
+  EXPECT_TRUE(trajectory.get_point_data(0).isApprox(point.data()));
+  EXPECT_EQ(trajectory.get_point(1).get_names(), point.get_names());
+
+  trajectory.get_point_data(1).setZero();
+  EXPECT_TRUE(trajectory.get_point(1).data().isZero());
+  trajectory.set_point(1, point);
+  EXPECT_TRUE(trajectory.get_data().col(1).isApprox(point.data()));
+
+  EXPECT_THROW(trajectory.add_point(state_representation::JointState::Random("robot", 2), std::chrono::milliseconds(10)),
+               state_representation::exceptions::IncompatibleStatesException);
+  EXPECT_THROW(trajectory.get_point(2), std::out_of_range);
+}
+
+TEST(TrajectoryTest, PointNames) {
+  state_representation::Trajectory<state_representation::CartesianPose> trajectory;
+  trajectory.add_point(state_representation::CartesianPose::Random("start"), std::chrono::milliseconds(10));
+  trajectory.add_point(state_representation::CartesianPose::Random("end"), std::chrono::milliseconds(10));
+  trajectory.insert_point(state_representation::CartesianPose::Random("middle"), std::chrono::milliseconds(10), 1);
+  trajectory.add_point_data(trajectory.get_point_data(0), std::chrono::milliseconds(10));
+
+  auto points = trajectory.get_points();
+  ASSERT_EQ(points.size(), 4);
+  EXPECT_EQ(points[0].get_name(), "start");
+  EXPECT_EQ(points[1].get_name(), "middle");
+  EXPECT_EQ(points[2].get_name(), "end");
+  EXPECT_EQ(points[3].get_name(), "end");
+  EXPECT_EQ(trajectory[1].first.get_name(), "middle");
+
+  trajectory.set_point(3, state_representation::CartesianPose::Random("last"));
+  EXPECT_EQ(trajectory.get_point(3).get_name(), "last");
+  trajectory.delete_point();
+  EXPECT_EQ(trajectory.get_point(2).get_name(), "end");
+
+  auto copy = trajectory;
+  EXPECT_EQ(copy.get_point(1).get_name(), "middle");
+}
+
+TEST(TrajectoryTest, PointFrames) {
+  state_representation::Trajectory<state_representation::CartesianPose> trajectory;
+  trajectory.add_point(state_representation::CartesianPose::Random("ee", "world"), std::chrono::milliseconds(10));
+  // a point expressed in the frame of the first point is compatible with it but not in the same reference frame
+  EXPECT_THROW(trajectory.add_point(state_representation::CartesianPose::Random("tool", "ee"),
+                                    std::chrono::milliseconds(10)),
+               state_representation::exceptions::IncompatibleStatesException);
+  EXPECT_THROW(trajectory.insert_point(state_representation::CartesianPose::Random("tool", "ee"),
+                                       std::chrono::milliseconds(10), 0),
+               state_representation::exceptions::IncompatibleStatesException);
+  trajectory.add_point(state_representation::CartesianPose::Random("tool", "world"), std::chrono::milliseconds(10));
+  EXPECT_EQ(trajectory.get_point(1).get_name(), "tool");
+  EXPECT_EQ(trajectory.get_point(1).get_reference_frame(), "world");
+
+  state_representation::Trajectory<state_representation::JointState> joint_trajectory;
+  joint_trajectory.add_point(
+      state_representation::JointState::Random("robot", {"a", "b"}), std::chrono::milliseconds(10));
+  EXPECT_THROW(joint_trajectory.add_point(
+      state_representation::JointState::Random("robot", {"b", "a"}), std::chrono::milliseconds(10)),
+               state_representation::exceptions::IncompatibleStatesException);
+}
+
+TEST(TrajectoryTest, NegativeTimes) {
+  state_representation::Trajectory<state_representation::CartesianPose> trajectory;
+  auto point = state_representation::CartesianPose::Random("ee", "world");
+  EXPECT_THROW(trajectory.add_point(point, std::chrono::milliseconds(-10)), std::invalid_argument);
+  EXPECT_EQ(trajectory.get_size(), 0);
+  trajectory.add_point(point, std::chrono::milliseconds(10));
+  EXPECT_THROW(trajectory.add_point_data(point.data(), std::chrono::milliseconds(-1)), std::invalid_argument);
+  EXPECT_THROW(trajectory.insert_point(point, std::chrono::milliseconds(-1), 0), std::invalid_argument);
+  EXPECT_EQ(trajectory.get_size(), 1);
+  trajectory.add_point_data(point.data(), std::chrono::milliseconds(0));
+  EXPECT_EQ(trajectory.get_times().back(), std::chrono::milliseconds(10));
+}
+
+TEST(TrajectoryTest, TimeLookup) {
+  state_representation::Trajectory<state_representation::CartesianState> trajectory;
+  EXPECT_THROW(trajectory.get_index(std::chrono::milliseconds(0)), state_representation::exceptions::EmptyStateException);
+  for (int i = 0; i < 5; ++i) {
+    trajectory.add_point(state_representation::CartesianState::Random("robot"), std::chrono::milliseconds(10));
+  }
+
+  EXPECT_EQ(trajectory.get_index(std::chrono::milliseconds(0)), 0);
+  EXPECT_EQ(trajectory.get_index(std::chrono::milliseconds(10)), 0);
+  EXPECT_EQ(trajectory.get_index(std::chrono::milliseconds(15)), 0);
+  EXPECT_EQ(trajectory.get_index(std::chrono::milliseconds(20)), 1);
+  EXPECT_EQ(trajectory.get_index(std::chrono::milliseconds(45)), 3);
+  EXPECT_EQ(trajectory.get_index(std::chrono::seconds(1)), 4);
+}
+
+TEST(TrajectoryTest, LinearInterpolation) {
+  state_representation::Trajectory<state_representation::JointState> trajectory;
+  auto start = state_representation::JointState::Random("robot", 3);
+  auto end = state_representation::JointState::Random("robot", 3);
+  trajectory.add_point(start, std::chrono::seconds(1));
+  trajectory.add_point(end, std::chrono::seconds(2));
+
+  state_representation::TrajectoryInterpolator<state_representation::JointState> interpolator(trajectory);
+  EXPECT_TRUE(interpolator.get_state(std::chrono::seconds(0)).data().isApprox(start.data()));
+  EXPECT_TRUE(interpolator.get_state(std::chrono::seconds(2)).data().isApprox(0.5 * (start.data() + end.data())));
+  EXPECT_TRUE(interpolator.get_state(std::chrono::milliseconds(2500)).data().isApprox(
+      0.25 * start.data() + 0.75 * end.data()));
+  EXPECT_TRUE(interpolator.get_state(std::chrono::seconds(4)).data().isApprox(end.data()));
+  EXPECT_EQ(interpolator.get_state(std::chrono::seconds(2)).get_names(), start.get_names());
+}
+
+TEST(TrajectoryTest, CubicSplineInterpolation) {
+  state_representation::Trajectory<state_representation::JointPositions> trajectory;
+  std::vector<double> times = {0.0, 0.5, 1.5, 2.0, 3.0};
+  std::chrono::milliseconds previous(0);
+  for (auto t: times) {
+    std::chrono::milliseconds time(static_cast<int64_t>(t * 1000));
+    trajectory.add_point(state_representation::JointPositions("robot", Eigen::Vector2d(2 * t + 1, std::sin(t))),
+                         time - previous);
+    previous = time;
+  }
+
+  state_representation::TrajectoryInterpolator<state_representation::JointPositions>
+      interpolator(trajectory, state_representation::InterpolationMethod::CUBIC_SPLINE);
+  for (unsigned int i = 0; i < times.size(); ++i) {
+    EXPECT_TRUE(interpolator.get_state(trajectory.get_times()[i]).data().isApprox(trajectory.get_point_data(i)));
+  }
+  // a natural cubic spline reproduces linear functions and approximates smooth ones
+  for (int ms = 0; ms <= 3000; ms += 100) {
+    auto positions = interpolator.get_state(std::chrono::milliseconds(ms)).get_positions();
+    EXPECT_NEAR(positions(0), 2 * ms * 1e-3 + 1, 1e-9);
+    EXPECT_NEAR(positions(1), std::sin(ms * 1e-3), 0.05);
+  }
+  // queries backward in time are found as well
+  EXPECT_NEAR(interpolator.get_state(std::chrono::milliseconds(700)).get_positions()(0), 2.4, 1e-9);
+}
+
+TEST(TrajectoryTest, OrientationInterpolation) {
+  state_representation::Trajectory<state_representation::CartesianPose> trajectory;
+  std::vector<state_representation::CartesianPose> poses;
+  for (int i = 0; i < 4; ++i) {
+    poses.push_back(state_representation::CartesianPose::Random("robot"));
+    trajectory.add_point(poses.back(), std::chrono::milliseconds(100));
+  }
+
+  state_representation::TrajectoryInterpolator<state_representation::CartesianPose> linear(trajectory);
+  auto pose = linear.get_state(std::chrono::milliseconds(130));
+  EXPECT_EQ(pose.get_reference_frame(), poses[0].get_reference_frame());
+  EXPECT_TRUE(pose.get_position().isApprox(0.7 * poses[0].get_position() + 0.3 * poses[1].get_position()));
+  EXPECT_NEAR(pose.get_orientation().angularDistance(poses[0].get_orientation().slerp(0.3, poses[1].get_orientation())),
+              0, 1e-6);
+
+  state_representation::TrajectoryInterpolator<state_representation::CartesianPose>
+      cubic(trajectory, state_representation::InterpolationMethod::CUBIC_SPLINE);
+  for (unsigned int i = 0; i < poses.size(); ++i) {
+    pose = cubic.get_state(trajectory.get_times()[i]);
+    EXPECT_NEAR(pose.get_orientation().angularDistance(poses[i].get_orientation()), 0, 1e-6);
+  }
+  pose = cubic.get_state(std::chrono::milliseconds(250));
+  EXPECT_NEAR(pose.get_orientation().norm(), 1, 1e-9);
+}
+
+TEST(TrajectoryTest, Resample) {
+  state_representation::Trajectory<state_representation::CartesianState> trajectory("trajectory");
+  for (int i = 0; i < 5; ++i) {
+    trajectory.add_point(state_representation::CartesianState::Random("robot"), std::chrono::milliseconds(100));
+  }
+  state_representation::TrajectoryInterpolator<state_representation::CartesianState>
+      interpolator(trajectory, state_representation::InterpolationMethod::CUBIC_SPLINE);
+  auto resampled = interpolator.resample(std::chrono::milliseconds(1));
+
+  EXPECT_EQ(resampled.get_name(), "trajectory");
+  ASSERT_EQ(resampled.get_size(), 401);
+  EXPECT_EQ(resampled.get_times().front(), std::chrono::milliseconds(100));
+  EXPECT_EQ(resampled.get_times().back(), std::chrono::milliseconds(500));
+  for (int i = 0; i < resampled.get_size(); i += 37) {
+    EXPECT_EQ(resampled.get_times()[i], std::chrono::milliseconds(100 + i));
+    EXPECT_TRUE(resampled.get_point(i).data().isApprox(interpolator.get_state(resampled.get_times()[i]).data()));
+  }
+  EXPECT_THROW(interpolator.resample(std::chrono::milliseconds(0)), std::invalid_argument);
+}